@@ -46,10 +46,27 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+struct Dma3Stats
+{
+    u32 bytesMoved;
+    u32 peakBytesMoved;
+    u16 requestsProcessed;
+    u16 requestsDeferred;
+    u8 queueHighWater;
+    u8 peakQueueHighWater;
+    u8 endLine;
+    u32 framesDeferred;
+    u32 requestsMerged;
+    u32 overflowFlushes;
+};
+
+extern struct Dma3Stats gDma3Stats;
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 s16 CheckForSpaceForDma3Request(s16 index);
+void DebugPrintDma3Stats(void);
 
 #endif // GUARD_DMA3_H
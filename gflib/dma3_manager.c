@@ -8,6 +8,26 @@
 #define DMA_REQUEST_COPY16 3
 #define DMA_REQUEST_FILL16 4
 
+// Palette and OAM uploads are small and visibly wrong if they land a frame
+// late, so they are always sent before any queued tile or tilemap data.
+enum
+{
+    DMA3_PRIORITY_CRITICAL,
+    DMA3_PRIORITY_BULK,
+    DMA3_PRIORITY_COUNT,
+};
+
+// Conservative DMA3 throughput from EWRAM/ROM into VRAM, used to decide
+// whether a request still fits in the vblank time that is left.
+#define DMA3_BYTES_PER_LINE 512
+// Last scanline a transfer may finish on before the next frame starts drawing.
+#define DMA3_LAST_VBLANK_LINE 224
+// Queued requests that continue each other are merged up to this size.
+#define DMA3_MAX_MERGED_SIZE 0x4000
+// After this many frames without any vblank time left, the oldest request is
+// sent anyway so a long vblank callback cannot starve the queue.
+#define DMA3_MAX_STARVED_FRAMES 2
+
 struct Dma3Request
 {
     const u8 *src;
@@ -18,9 +38,16 @@ struct Dma3Request
 };
 
 static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
+static u8 sDma3Queues[DMA3_PRIORITY_COUNT][MAX_DMA_REQUESTS];
+static u8 sDma3QueueHead[DMA3_PRIORITY_COUNT];
+static u8 sDma3QueueCount[DMA3_PRIORITY_COUNT];
 
 static vbool8 sDma3ManagerLocked;
 static u8 sDma3RequestCursor;
+static u8 sDma3FrameHighWater;
+static u8 sDma3StarvedFrames;
+
+EWRAM_DATA struct Dma3Stats gDma3Stats = {0};
 
 void ClearDma3Requests(void)
 {
@@ -35,129 +62,230 @@ void ClearDma3Requests(void)
         sDma3Requests[i].src = NULL;
         sDma3Requests[i].dest = NULL;
     }
+    for (i = 0; i < DMA3_PRIORITY_COUNT; i++)
+    {
+        sDma3QueueHead[i] = 0;
+        sDma3QueueCount[i] = 0;
+    }
+    sDma3FrameHighWater = 0;
+    sDma3StarvedFrames = 0;
 
     sDma3ManagerLocked = FALSE;
 }
 
+static void ExecuteDma3Request(struct Dma3Request *request)
+{
+    switch (request->mode)
+    {
+    case DMA_REQUEST_COPY32: // regular 32-bit copy
+        Dma3CopyLarge32_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
+        Dma3FillLarge32_(request->value, request->dest, request->size);
+        break;
+    case DMA_REQUEST_COPY16: // regular 16-bit copy
+        Dma3CopyLarge16_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
+        Dma3FillLarge16_(request->value, request->dest, request->size);
+        break;
+    }
+
+    // Free the request
+    request->src = NULL;
+    request->dest = NULL;
+    request->size = 0;
+    request->mode = 0;
+    request->value = 0;
+}
+
+static bool32 HasVBlankTimeForDma3(u16 size, u32 bytesTransferred)
+{
+    u32 vcount = REG_VCOUNT & 0xFF;
+
+    if (vcount < DISPLAY_HEIGHT || vcount > DMA3_LAST_VBLANK_LINE)
+        return bytesTransferred == 0 && sDma3StarvedFrames >= DMA3_MAX_STARVED_FRAMES;
+
+    // Always send at least one request per frame, even if it is larger than
+    // the time left, so big uploads still go through.
+    if (bytesTransferred == 0)
+        return TRUE;
+
+    return size <= (DMA3_LAST_VBLANK_LINE - vcount) * DMA3_BYTES_PER_LINE;
+}
+
+static u32 GetQueuedDma3RequestCount(void)
+{
+    u32 i;
+    u32 count = 0;
+
+    for (i = 0; i < DMA3_PRIORITY_COUNT; i++)
+        count += sDma3QueueCount[i];
+    return count;
+}
+
+// Sends queued requests in priority order until the vblank time runs out.
+// If ignoreBudget is set, the whole queue is sent regardless of VCOUNT.
+static u32 RunDma3Queues(bool32 ignoreBudget, u16 *requestsRun)
+{
+    u32 bytesTransferred = 0;
+    u32 priority;
+
+    for (priority = 0; priority < DMA3_PRIORITY_COUNT; priority++)
+    {
+        u8 *queue = sDma3Queues[priority];
+
+        while (sDma3QueueCount[priority] != 0)
+        {
+            struct Dma3Request *request = &sDma3Requests[queue[sDma3QueueHead[priority]]];
+            u16 size = request->size;
+
+            if (!ignoreBudget && !HasVBlankTimeForDma3(size, bytesTransferred))
+                return bytesTransferred;
+
+            ExecuteDma3Request(request);
+            bytesTransferred += size;
+            (*requestsRun)++;
+            sDma3QueueHead[priority] = (sDma3QueueHead[priority] + 1) % MAX_DMA_REQUESTS;
+            sDma3QueueCount[priority]--;
+        }
+    }
+    return bytesTransferred;
+}
+
 void ProcessDma3Requests(void)
 {
-    u16 bytesTransferred;
+    u32 bytesTransferred;
+    u16 requestsRun = 0;
 
     if (sDma3ManagerLocked)
         return;
 
-    bytesTransferred = 0;
+    bytesTransferred = RunDma3Queues(FALSE, &requestsRun);
 
-    // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
-    while (sDma3Requests[sDma3RequestCursor].size != 0)
-    {
-        bytesTransferred += sDma3Requests[sDma3RequestCursor].size;
+    gDma3Stats.bytesMoved = bytesTransferred;
+    gDma3Stats.requestsProcessed = requestsRun;
+    gDma3Stats.requestsDeferred = GetQueuedDma3RequestCount();
+    gDma3Stats.queueHighWater = sDma3FrameHighWater;
+    gDma3Stats.endLine = REG_VCOUNT & 0xFF;
+    if (bytesTransferred > gDma3Stats.peakBytesMoved)
+        gDma3Stats.peakBytesMoved = bytesTransferred;
+    if (sDma3FrameHighWater > gDma3Stats.peakQueueHighWater)
+        gDma3Stats.peakQueueHighWater = sDma3FrameHighWater;
+    if (gDma3Stats.requestsDeferred != 0)
+        gDma3Stats.framesDeferred++;
 
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+    if (requestsRun == 0 && gDma3Stats.requestsDeferred != 0)
+        sDma3StarvedFrames++;
+    else
+        sDma3StarvedFrames = 0;
+    sDma3FrameHighWater = gDma3Stats.requestsDeferred;
+}
 
-        switch (sDma3Requests[sDma3RequestCursor].mode)
-        {
-        case DMA_REQUEST_COPY32: // regular 32-bit copy
-            Dma3CopyLarge32_(sDma3Requests[sDma3RequestCursor].src,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
-            Dma3FillLarge32_(sDma3Requests[sDma3RequestCursor].value,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_COPY16:    // regular 16-bit copy
-            Dma3CopyLarge16_(sDma3Requests[sDma3RequestCursor].src,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
-            Dma3FillLarge16_(sDma3Requests[sDma3RequestCursor].value,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        }
+static bool32 TryMergeDma3Request(u8 priority, const u8 *src, u32 value, u8 *dest, u16 size, u16 mode)
+{
+    struct Dma3Request *tail;
+    u32 count = sDma3QueueCount[priority];
 
-        // Free the request
-        sDma3Requests[sDma3RequestCursor].src = NULL;
-        sDma3Requests[sDma3RequestCursor].dest = NULL;
-        sDma3Requests[sDma3RequestCursor].size = 0;
-        sDma3Requests[sDma3RequestCursor].mode = 0;
-        sDma3Requests[sDma3RequestCursor].value = 0;
-        sDma3RequestCursor++;
+    // Only the newest queued request may be extended, so the order of
+    // overlapping writes is unchanged.
+    if (count == 0)
+        return FALSE;
 
-        if (sDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
-            sDma3RequestCursor = 0;
+    tail = &sDma3Requests[sDma3Queues[priority][(sDma3QueueHead[priority] + count - 1) % MAX_DMA_REQUESTS]];
+    if (tail->mode != mode || tail->dest + tail->size != dest || tail->size + size > DMA3_MAX_MERGED_SIZE)
+        return FALSE;
+
+    if (mode == DMA_REQUEST_COPY32 || mode == DMA_REQUEST_COPY16)
+    {
+        if (tail->src + tail->size != src)
+            return FALSE;
     }
+    else if (tail->value != value)
+    {
+        return FALSE;
+    }
+
+    tail->size += size;
+    gDma3Stats.requestsMerged++;
+    return TRUE;
 }
 
-s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+static s16 QueueDma3Request(const void *src, u32 value, void *dest, u16 size, u16 mode)
 {
     int cursor;
-    int i = 0;
+    int i;
+    u8 priority;
+    u32 queued;
 
-    sDma3ManagerLocked = TRUE;
-    cursor = sDma3RequestCursor;
+    if ((u32)dest >> 24 == PLTT >> 24 || (u32)dest >> 24 == OAM >> 24)
+        priority = DMA3_PRIORITY_CRITICAL;
+    else
+        priority = DMA3_PRIORITY_BULK;
 
-    while (i < MAX_DMA_REQUESTS)
+    if (size != 0 && TryMergeDma3Request(priority, src, value, dest, size, mode))
     {
-        if (sDma3Requests[cursor].size == 0) // an empty request was found.
-        {
-            sDma3Requests[cursor].src = src;
-            sDma3Requests[cursor].dest = dest;
-            sDma3Requests[cursor].size = size;
+        u32 count = sDma3QueueCount[priority];
+        return sDma3Queues[priority][(sDma3QueueHead[priority] + count - 1) % MAX_DMA_REQUESTS];
+    }
 
-            if (mode == 1)
-                sDma3Requests[cursor].mode = DMA_REQUEST_COPY32;
-            else
-                sDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
+    if (GetQueuedDma3RequestCount() >= MAX_DMA_REQUESTS)
+    {
+        // The queue is full. Rather than drop the upload, send everything
+        // that is already queued now, accepting possible tearing.
+        u16 requestsRun = 0;
 
-            sDma3ManagerLocked = FALSE;
-            return cursor;
-        }
+        RunDma3Queues(TRUE, &requestsRun);
+        gDma3Stats.overflowFlushes++;
+        DebugPrintf("dma3: queue full, flushed %d requests", requestsRun);
+    }
+
+    cursor = sDma3RequestCursor;
+    for (i = 0; i < MAX_DMA_REQUESTS; i++)
+    {
+        if (sDma3Requests[cursor].size == 0) // an empty request was found.
+            break;
         if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
             cursor = 0;
-        i++;
     }
+
+    sDma3Requests[cursor].src = src;
+    sDma3Requests[cursor].dest = dest;
+    sDma3Requests[cursor].size = size;
+    sDma3Requests[cursor].mode = mode;
+    sDma3Requests[cursor].value = value;
+    sDma3RequestCursor = (cursor + 1) % MAX_DMA_REQUESTS;
+
+    if (size != 0)
+    {
+        sDma3Queues[priority][(sDma3QueueHead[priority] + sDma3QueueCount[priority]) % MAX_DMA_REQUESTS] = cursor;
+        sDma3QueueCount[priority]++;
+        queued = GetQueuedDma3RequestCount();
+        if (queued > sDma3FrameHighWater)
+            sDma3FrameHighWater = queued;
+    }
+
+    return cursor;
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    s16 cursor;
+
+    sDma3ManagerLocked = TRUE;
+    cursor = QueueDma3Request(src, 0, dest, size, mode == 1 ? DMA_REQUEST_COPY32 : DMA_REQUEST_COPY16);
     sDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+    return cursor;
 }
 
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
 {
-    int cursor;
-    int i = 0;
+    s16 cursor;
 
-    cursor = sDma3RequestCursor;
     sDma3ManagerLocked = TRUE;
-
-    while (i < MAX_DMA_REQUESTS)
-    {
-        if (sDma3Requests[cursor].size == 0) // an empty request was found.
-        {
-            sDma3Requests[cursor].dest = dest;
-            sDma3Requests[cursor].size = size;
-            sDma3Requests[cursor].mode = mode;
-            sDma3Requests[cursor].value = value;
-
-            if(mode == 1)
-                sDma3Requests[cursor].mode = DMA_REQUEST_FILL32;
-            else
-                sDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
-
-            sDma3ManagerLocked = FALSE;
-            return cursor;
-        }
-        if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
-            cursor = 0;
-        i++;
-    }
+    cursor = QueueDma3Request(NULL, value, dest, size, mode == 1 ? DMA_REQUEST_FILL32 : DMA_REQUEST_FILL16);
     sDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+    return cursor;
 }
 
 s16 CheckForSpaceForDma3Request(s16 index)
@@ -181,3 +309,15 @@ s16 CheckForSpaceForDma3Request(s16 index)
         return 0;
     }
 }
+
+void DebugPrintDma3Stats(void)
+{
+#ifndef NDEBUG
+    DebugPrintf("dma3: last frame bytes=%d requests=%d deferred=%d high water=%d end line=%d",
+                gDma3Stats.bytesMoved, gDma3Stats.requestsProcessed, gDma3Stats.requestsDeferred,
+                gDma3Stats.queueHighWater, gDma3Stats.endLine);
+    DebugPrintf("dma3: peak bytes=%d peak high water=%d frames deferred=%d merged=%d overflows=%d",
+                gDma3Stats.peakBytesMoved, gDma3Stats.peakQueueHighWater, gDma3Stats.framesDeferred,
+                gDma3Stats.requestsMerged, gDma3Stats.overflowFlushes);
+#endif
+}
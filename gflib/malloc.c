@@ -8,6 +8,17 @@ EWRAM_DATA u8 gHeap[HEAP_SIZE] = {0};
 
 #define MALLOC_SYSTEM_ID 0xA3A3
 
+// Free blocks are kept in segregated lists by size class so that Alloc does
+// not have to walk every block in the heap. Class n holds blocks whose size
+// is in [MIN_BLOCK_SIZE << n, MIN_BLOCK_SIZE << (n + 1)), so any block from
+// a higher class than the request's is guaranteed to fit.
+#define NUM_SIZE_CLASSES 16
+
+// Small, often long-lived allocations (tasks, sprite data) are placed at the
+// top of the heap and large screen buffers at the bottom, so closing a menu
+// leaves one large free area instead of a heap pinned by small blocks.
+#define SMALL_ALLOC_SIZE 1024
+
 struct MemBlock {
     // Whether this block is currently allocated.
     bool16 flag;
@@ -28,6 +39,115 @@ struct MemBlock {
     u8 data[0];
 };
 
+// Stored in the data of a free block to link it into its size class list.
+struct FreeLinks {
+    struct MemBlock *prev;
+    struct MemBlock *next;
+};
+
+#define FREE_LINKS(block) ((struct FreeLinks *)(block)->data)
+#define MIN_BLOCK_SIZE sizeof(struct FreeLinks)
+
+static struct MemBlock *sFreeLists[NUM_SIZE_CLASSES];
+static u32 sFreeListMask;
+static u32 sLiveBytes;
+static u32 sPeakBytes;
+static u32 sFailedAllocs;
+
+#ifdef TRACK_HEAP_CALL_SITES
+#define NUM_HEAP_CALL_SITES 32
+
+struct HeapCallSite {
+    void *caller;
+    u32 allocs;
+    u16 fails;
+    u32 maxSize;
+};
+
+static struct HeapCallSite sHeapCallSites[NUM_HEAP_CALL_SITES];
+#endif
+
+static u32 GetSizeClass(u32 size)
+{
+    u32 sizeClass = 0;
+
+    size /= 2 * MIN_BLOCK_SIZE;
+    while (size != 0 && sizeClass < NUM_SIZE_CLASSES - 1) {
+        size >>= 1;
+        sizeClass++;
+    }
+
+    return sizeClass;
+}
+
+static void InsertFreeBlock(struct MemBlock *block)
+{
+    u32 sizeClass = GetSizeClass(block->size);
+    struct FreeLinks *links = FREE_LINKS(block);
+
+    links->prev = NULL;
+    links->next = sFreeLists[sizeClass];
+    if (links->next != NULL)
+        FREE_LINKS(links->next)->prev = block;
+    sFreeLists[sizeClass] = block;
+    sFreeListMask |= 1 << sizeClass;
+}
+
+static void RemoveFreeBlock(struct MemBlock *block)
+{
+    u32 sizeClass = GetSizeClass(block->size);
+    struct FreeLinks *links = FREE_LINKS(block);
+
+    if (links->prev != NULL)
+        FREE_LINKS(links->prev)->next = links->next;
+    else
+        sFreeLists[sizeClass] = links->next;
+
+    if (links->next != NULL)
+        FREE_LINKS(links->next)->prev = links->prev;
+
+    if (sFreeLists[sizeClass] == NULL)
+        sFreeListMask &= ~(1 << sizeClass);
+}
+
+static bool32 IsPreferredBlock(u32 size, struct MemBlock *block, struct MemBlock *best)
+{
+    if (best == NULL)
+        return TRUE;
+    if (size < SMALL_ALLOC_SIZE)
+        return block > best;
+    return block < best;
+}
+
+static struct MemBlock *FindFreeBlock(u32 size)
+{
+    u32 sizeClass = GetSizeClass(size);
+    struct MemBlock *pos;
+    struct MemBlock *best = NULL;
+
+    // Blocks in the request's own class may be too small.
+    for (pos = sFreeLists[sizeClass]; pos != NULL; pos = FREE_LINKS(pos)->next) {
+        if (pos->size >= size && IsPreferredBlock(size, pos, best))
+            best = pos;
+    }
+
+    if (best != NULL)
+        return best;
+
+    // Otherwise any block from the smallest non-empty larger class fits.
+    for (sizeClass++; sizeClass < NUM_SIZE_CLASSES; sizeClass++) {
+        if (sFreeListMask & (1 << sizeClass)) {
+            for (pos = sFreeLists[sizeClass]; pos != NULL; pos = FREE_LINKS(pos)->next) {
+                if (IsPreferredBlock(size, pos, best))
+                    best = pos;
+            }
+            return best;
+        }
+    }
+
+    return NULL;
+}
+
 void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next, u32 size)
 {
     struct MemBlock *header = (struct MemBlock *)block;
@@ -46,8 +166,8 @@ void PutFirstMemBlockHeader(void *block, u32 size)
 
 void *AllocInternal(void *heapStart, u32 size)
 {
-    struct MemBlock *pos = (struct MemBlock *)heapStart;
-    struct MemBlock *head = pos;
+    struct MemBlock *head = (struct MemBlock *)heapStart;
+    struct MemBlock *pos;
     struct MemBlock *splitBlock;
     u32 foundBlockSize;
 
@@ -55,45 +175,70 @@ void *AllocInternal(void *heapStart, u32 size)
     if (size & 3)
         size = 4 * ((size / 4) + 1);
 
-    for (;;) {
-        // Loop through the blocks looking for unused block that's big enough.
+    // Free blocks need room for their free list links.
+    if (size < MIN_BLOCK_SIZE)
+        size = MIN_BLOCK_SIZE;
 
-        if (!pos->flag) {
-            foundBlockSize = pos->size;
+    pos = FindFreeBlock(size);
+    if (pos == NULL) {
+        sFailedAllocs++;
+        return NULL;
+    }
 
-            if (foundBlockSize >= size) {
-                if (foundBlockSize - size < 2 * sizeof(struct MemBlock)) {
-                    // The block isn't much bigger than the requested size,
-                    // so just use it.
-                    pos->flag = TRUE;
-                } else {
-                    // The block is significantly bigger than the requested
-                    // size, so split the rest into a separate block.
-                    foundBlockSize -= sizeof(struct MemBlock);
-                    foundBlockSize -= size;
+    RemoveFreeBlock(pos);
+    foundBlockSize = pos->size;
 
-                    splitBlock = (struct MemBlock *)(pos->data + size);
+    if (foundBlockSize - size < 2 * sizeof(struct MemBlock)) {
+        // The block isn't much bigger than the requested size,
+        // so just use it.
+        pos->flag = TRUE;
+    } else if (size < SMALL_ALLOC_SIZE) {
+        // The block is significantly bigger than the requested
+        // size, so split off its end for the allocation and keep
+        // the rest free.
+        foundBlockSize -= sizeof(struct MemBlock);
+        foundBlockSize -= size;
 
-                    pos->flag = TRUE;
-                    pos->size = size;
+        splitBlock = (struct MemBlock *)(pos->data + foundBlockSize);
 
-                    PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
+        pos->size = foundBlockSize;
 
-                    pos->next = splitBlock;
+        PutMemBlockHeader(splitBlock, pos, pos->next, size);
 
-                    if (splitBlock->next != head)
-                        splitBlock->next->prev = splitBlock;
-                }
+        splitBlock->flag = TRUE;
+        pos->next = splitBlock;
 
-                return pos->data;
-            }
-        }
+        if (splitBlock->next != head)
+            splitBlock->next->prev = splitBlock;
 
-        if (pos->next == head)
-            return NULL;
+        InsertFreeBlock(pos);
+        pos = splitBlock;
+    } else {
+        // The block is significantly bigger than the requested
+        // size, so split the rest into a separate block.
+        foundBlockSize -= sizeof(struct MemBlock);
+        foundBlockSize -= size;
 
-        pos = pos->next;
+        splitBlock = (struct MemBlock *)(pos->data + size);
+
+        pos->flag = TRUE;
+        pos->size = size;
+
+        PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
+
+        pos->next = splitBlock;
+
+        if (splitBlock->next != head)
+            splitBlock->next->prev = splitBlock;
+
+        InsertFreeBlock(splitBlock);
     }
+
+    sLiveBytes += pos->size;
+    if (sLiveBytes > sPeakBytes)
+        sPeakBytes = sLiveBytes;
+
+    return pos->data;
 }
 
 void FreeInternal(void *heapStart, void *pointer)
@@ -102,11 +247,13 @@ void FreeInternal(void *heapStart, void *pointer)
         struct MemBlock *head = (struct MemBlock *)heapStart;
         struct MemBlock *block = (struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
         block->flag = FALSE;
+        sLiveBytes -= block->size;
 
         // If the freed block isn't the last one, merge with the next block
         // if it's not in use.
         if (block->next != head) {
             if (!block->next->flag) {
+                RemoveFreeBlock(block->next);
                 block->size += sizeof(struct MemBlock) + block->next->size;
                 block->next->magic = 0;
                 block->next = block->next->next;
@@ -119,6 +266,7 @@ void FreeInternal(void *heapStart, void *pointer)
         // if it's not in use.
         if (block != head) {
             if (!block->prev->flag) {
+                RemoveFreeBlock(block->prev);
                 block->prev->next = block->next;
 
                 if (block->next != head)
@@ -126,8 +274,11 @@ void FreeInternal(void *heapStart, void *pointer)
 
                 block->magic = 0;
                 block->prev->size += sizeof(struct MemBlock) + block->size;
+                block = block->prev;
             }
         }
+
+        InsertFreeBlock(block);
     }
 }
 
@@ -173,19 +324,65 @@ bool32 CheckMemBlockInternal(void *heapStart, void *pointer)
 
 void InitHeap(void *heapStart, u32 heapSize)
 {
+    u32 i;
+
     sHeapStart = heapStart;
     sHeapSize = heapSize;
+    for (i = 0; i < NUM_SIZE_CLASSES; i++)
+        sFreeLists[i] = NULL;
+    sFreeListMask = 0;
+    sLiveBytes = 0;
+    sPeakBytes = 0;
+    sFailedAllocs = 0;
+#ifdef TRACK_HEAP_CALL_SITES
+    CpuFill32(0, sHeapCallSites, sizeof(sHeapCallSites));
+#endif
+
     PutFirstMemBlockHeader(heapStart, heapSize);
+    InsertFreeBlock((struct MemBlock *)heapStart);
 }
 
+#ifdef TRACK_HEAP_CALL_SITES
+static void RecordHeapCallSite(void *caller, u32 size, void *mem)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_HEAP_CALL_SITES; i++) {
+        struct HeapCallSite *site = &sHeapCallSites[i];
+
+        if (site->caller == NULL)
+            site->caller = caller;
+
+        if (site->caller == caller) {
+            site->allocs++;
+            if (mem == NULL)
+                site->fails++;
+            if (size > site->maxSize)
+                site->maxSize = size;
+            return;
+        }
+    }
+}
+#endif
+
 void *Alloc(u32 size)
 {
-    return AllocInternal(sHeapStart, size);
+    void *mem = AllocInternal(sHeapStart, size);
+
+#ifdef TRACK_HEAP_CALL_SITES
+    RecordHeapCallSite(__builtin_return_address(0), size, mem);
+#endif
+    return mem;
 }
 
 void *AllocZeroed(u32 size)
 {
-    return AllocZeroedInternal(sHeapStart, size);
+    void *mem = AllocZeroedInternal(sHeapStart, size);
+
+#ifdef TRACK_HEAP_CALL_SITES
+    RecordHeapCallSite(__builtin_return_address(0), size, mem);
+#endif
+    return mem;
 }
 
 void Free(void *pointer)
@@ -198,15 +395,79 @@ bool32 CheckMemBlock(void *pointer)
     return CheckMemBlockInternal(sHeapStart, pointer);
 }
 
-bool32 CheckHeap()
+bool32 CheckHeap(void)
 {
     struct MemBlock *pos = (struct MemBlock *)sHeapStart;
+    u32 freeBlocks = 0;
+    u32 listedBlocks = 0;
+    u32 i;
 
     do {
         if (!CheckMemBlockInternal(sHeapStart, pos->data))
             return FALSE;
+        if (!pos->flag) {
+            // Neighbouring free blocks should always have been merged.
+            if (pos->next != (struct MemBlock *)sHeapStart && !pos->next->flag)
+                return FALSE;
+            freeBlocks++;
+        }
         pos = pos->next;
     } while (pos != (struct MemBlock *)sHeapStart);
 
-    return TRUE;
+    for (i = 0; i < NUM_SIZE_CLASSES; i++) {
+        for (pos = sFreeLists[i]; pos != NULL; pos = FREE_LINKS(pos)->next) {
+            if (pos->flag || pos->magic != MALLOC_SYSTEM_ID || GetSizeClass(pos->size) != i)
+                return FALSE;
+            listedBlocks++;
+        }
+    }
+
+    return freeBlocks == listedBlocks;
+}
+
+void GetHeapStats(struct HeapStats *stats)
+{
+    struct MemBlock *pos = (struct MemBlock *)sHeapStart;
+
+    stats->heapSize = sHeapSize;
+    stats->liveBytes = sLiveBytes;
+    stats->peakBytes = sPeakBytes;
+    stats->freeBytes = 0;
+    stats->largestFreeBlock = 0;
+    stats->usedBlocks = 0;
+    stats->freeBlocks = 0;
+    stats->failedAllocs = sFailedAllocs;
+
+    do {
+        if (pos->flag) {
+            stats->usedBlocks++;
+        } else {
+            stats->freeBlocks++;
+            stats->freeBytes += pos->size;
+            if (pos->size > stats->largestFreeBlock)
+                stats->largestFreeBlock = pos->size;
+        }
+        pos = pos->next;
+    } while (pos != (struct MemBlock *)sHeapStart);
+}
+
+void DebugPrintHeapStats(void)
+{
+#ifndef NDEBUG
+    struct HeapStats stats;
+#ifdef TRACK_HEAP_CALL_SITES
+    u32 i;
+#endif
+
+    GetHeapStats(&stats);
+    DebugPrintf("heap: live=%d peak=%d free=%d largest=%d size=%d", stats.liveBytes, stats.peakBytes, stats.freeBytes, stats.largestFreeBlock, stats.heapSize);
+    DebugPrintf("heap: used blocks=%d free blocks=%d failed allocs=%d ok=%d", stats.usedBlocks, stats.freeBlocks, stats.failedAllocs, CheckHeap());
+
+#ifdef TRACK_HEAP_CALL_SITES
+    for (i = 0; i < NUM_HEAP_CALL_SITES && sHeapCallSites[i].caller != NULL; i++) {
+        struct HeapCallSite *site = &sHeapCallSites[i];
+        DebugPrintf("heap: caller=%x allocs=%d fails=%d max=%d", site->caller, site->allocs, site->fails, site->maxSize);
+    }
+#endif
+#endif
 }
@@ -12,9 +12,25 @@
 #define HEAP_SIZE 0x1C000
 extern u8 gHeap[HEAP_SIZE];
 
+struct HeapStats
+{
+    u32 heapSize;
+    u32 liveBytes;
+    u32 peakBytes;
+    u32 freeBytes;
+    u32 largestFreeBlock;
+    u16 usedBlocks;
+    u16 freeBlocks;
+    u32 failedAllocs;
+};
+
 void *Alloc(u32 size);
 void *AllocZeroed(u32 size);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
+bool32 CheckMemBlock(void *pointer);
+bool32 CheckHeap(void);
+void GetHeapStats(struct HeapStats *stats);
+void DebugPrintHeapStats(void);
 
 #endif // GUARD_ALLOC_H
@@ -2,6 +2,7 @@
 #include "sprite.h"
 #include "main.h"
 #include "palette.h"
+#include "profiler.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
@@ -50,7 +51,7 @@ struct OamDimensions
 
 static void UpdateOamCoords(void);
 static void BuildSpritePriorities(void);
-static void SortSprites(void);
+static IWRAM_FUNC(SortSprites) void SortSprites(void);
 static void CopyMatricesToOamBuffer(void);
 static void AddSpritesToOamBuffer(void);
 static u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
@@ -279,8 +280,9 @@ u32 gOamMatrixAllocBitmap;
 u8 gReservedSpritePaletteCount;
 
 EWRAM_DATA struct Sprite gSprites[MAX_SPRITES + 1] = {0};
-EWRAM_DATA static u16 sSpritePriorities[MAX_SPRITES] = {0};
+EWRAM_DATA static u32 sSpriteSortKeys[MAX_SPRITES] = {0};
 EWRAM_DATA static u8 sSpriteOrder[MAX_SPRITES] = {0};
+EWRAM_DATA static u8 sSpriteOrderVisibleCount = 0;
 EWRAM_DATA static bool8 sShouldProcessSpriteCopyRequests = 0;
 EWRAM_DATA static u8 sSpriteCopyRequestCount = 0;
 EWRAM_DATA static struct SpriteCopyRequest sSpriteCopyRequests[MAX_SPRITES] = {0};
@@ -309,6 +311,7 @@ void ResetSpriteData(void)
 void AnimateSprites(void)
 {
     u8 i;
+    ProfilerBeginZone(PROFILE_ZONE_ANIMATE_SPRITES);
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
@@ -321,11 +324,13 @@ void AnimateSprites(void)
                 AnimateSprite(sprite);
         }
     }
+    ProfilerEndZone(PROFILE_ZONE_ANIMATE_SPRITES);
 }
 
 void BuildOamBuffer(void)
 {
     u8 temp;
+    ProfilerBeginZone(PROFILE_ZONE_BUILD_OAM);
     UpdateOamCoords();
     BuildSpritePriorities();
     SortSprites();
@@ -335,6 +340,7 @@ void BuildOamBuffer(void)
     CopyMatricesToOamBuffer();
     gMain.oamLoadDisabled = temp;
     sShouldProcessSpriteCopyRequests = TRUE;
+    ProfilerEndZone(PROFILE_ZONE_BUILD_OAM);
 }
 
 void UpdateOamCoords(void)
@@ -359,112 +365,76 @@ void UpdateOamCoords(void)
     }
 }
 
+// Sprites are ordered by priority, then subpriority, then lowest on screen
+// first. The key packs all three so sorting needs a single compare.
+static u32 GetSpriteSortKey(struct Sprite *sprite)
+{
+    s16 y = sprite->oam.y;
+
+    if (y >= DISPLAY_HEIGHT)
+        y = y - 256;
+
+    if (sprite->oam.affineMode == ST_OAM_AFFINE_DOUBLE
+     && sprite->oam.size == ST_OAM_SIZE_3)
+    {
+        u32 shape = sprite->oam.shape;
+        if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
+        {
+            if (y > 128)
+                y = y - 256;
+        }
+    }
+
+    // y is in [-127, DISPLAY_HEIGHT - 1] here, so this fits in 9 bits.
+    return ((sprite->subpriority | (sprite->oam.priority << 8)) << 9) | (DISPLAY_HEIGHT - 1 - y);
+}
+
 void BuildSpritePriorities(void)
 {
     u16 i;
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
-        u16 priority = sprite->subpriority | (sprite->oam.priority << 8);
-        sSpritePriorities[i] = priority;
+        if (sprite->inUse && !sprite->invisible)
+            sSpriteSortKeys[i] = GetSpriteSortKey(sprite);
     }
 }
 
-void SortSprites(void)
+// Stable insertion sort of the visible sprites, starting from last frame's
+// order. That order is almost always still sorted, so this is close to a
+// single pass. Hidden sprites keep their relative order after the visible ones.
+IWRAM_FUNC(SortSprites) void SortSprites(void)
 {
-    u8 i;
-    for (i = 1; i < MAX_SPRITES; i++)
-    {
-        u8 j = i;
-        struct Sprite *sprite1 = &gSprites[sSpriteOrder[i - 1]];
-        struct Sprite *sprite2 = &gSprites[sSpriteOrder[i]];
-        u16 sprite1Priority = sSpritePriorities[sSpriteOrder[i - 1]];
-        u16 sprite2Priority = sSpritePriorities[sSpriteOrder[i]];
-        s16 sprite1Y = sprite1->oam.y;
-        s16 sprite2Y = sprite2->oam.y;
+    u8 i, j;
+    u8 visibleCount = 0;
+    u8 hiddenCount = 0;
+    u8 hidden[MAX_SPRITES];
 
-        if (sprite1Y >= DISPLAY_HEIGHT)
-            sprite1Y = sprite1Y - 256;
-
-        if (sprite2Y >= DISPLAY_HEIGHT)
-            sprite2Y = sprite2Y - 256;
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        u8 spriteId = sSpriteOrder[i];
+        struct Sprite *sprite = &gSprites[spriteId];
 
-        if (sprite1->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-         && sprite1->oam.size == ST_OAM_SIZE_3)
+        if (sprite->inUse && !sprite->invisible)
         {
-            u32 shape = sprite1->oam.shape;
-            if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-            {
-                if (sprite1Y > 128)
-                    sprite1Y = sprite1Y - 256;
-            }
-        }
+            u32 key = sSpriteSortKeys[spriteId];
 
-        if (sprite2->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-         && sprite2->oam.size == ST_OAM_SIZE_3)
-        {
-            u32 shape = sprite2->oam.shape;
-            if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-            {
-                if (sprite2Y > 128)
-                    sprite2Y = sprite2Y - 256;
-            }
+            // visibleCount <= i, so this only overwrites entries already read.
+            for (j = visibleCount; j > 0 && sSpriteSortKeys[sSpriteOrder[j - 1]] > key; j--)
+                sSpriteOrder[j] = sSpriteOrder[j - 1];
+            sSpriteOrder[j] = spriteId;
+            visibleCount++;
         }
-
-        while (j > 0
-            && ((sprite1Priority > sprite2Priority)
-             || (sprite1Priority == sprite2Priority && sprite1Y < sprite2Y)))
+        else
         {
-            u8 temp = sSpriteOrder[j];
-            sSpriteOrder[j] = sSpriteOrder[j - 1];
-            sSpriteOrder[j - 1] = temp;
-
-            // UB: If j equals 1, then j-- makes j equal 0.
-            // Then, sSpriteOrder[-1] gets accessed below.
-            // Although this doesn't result in a bug in the ROM,
-            // the behavior is undefined.
-            j--;
-#ifdef UBFIX
-            if (j == 0)
-                break;
-#endif
-
-            sprite1 = &gSprites[sSpriteOrder[j - 1]];
-            sprite2 = &gSprites[sSpriteOrder[j]];
-            sprite1Priority = sSpritePriorities[sSpriteOrder[j - 1]];
-            sprite2Priority = sSpritePriorities[sSpriteOrder[j]];
-            sprite1Y = sprite1->oam.y;
-            sprite2Y = sprite2->oam.y;
-
-            if (sprite1Y >= DISPLAY_HEIGHT)
-                sprite1Y = sprite1Y - 256;
-
-            if (sprite2Y >= DISPLAY_HEIGHT)
-                sprite2Y = sprite2Y - 256;
-
-            if (sprite1->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-             && sprite1->oam.size == ST_OAM_SIZE_3)
-            {
-                u32 shape = sprite1->oam.shape;
-                if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-                {
-                    if (sprite1Y > 128)
-                        sprite1Y = sprite1Y - 256;
-                }
-            }
-
-            if (sprite2->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-             && sprite2->oam.size == ST_OAM_SIZE_3)
-            {
-                u32 shape = sprite2->oam.shape;
-                if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-                {
-                    if (sprite2Y > 128)
-                        sprite2Y = sprite2Y - 256;
-                }
-            }
+            hidden[hiddenCount++] = spriteId;
         }
     }
+
+    for (i = 0; i < hiddenCount; i++)
+        sSpriteOrder[visibleCount + i] = hidden[i];
+
+    sSpriteOrderVisibleCount = visibleCount;
 }
 
 void CopyMatricesToOamBuffer(void)
@@ -485,10 +455,10 @@ void AddSpritesToOamBuffer(void)
     u8 i = 0;
     u8 oamIndex = 0;
 
-    while (i < MAX_SPRITES)
+    // SortSprites puts every in use, visible sprite first.
+    while (i < sSpriteOrderVisibleCount)
     {
-        struct Sprite *sprite = &gSprites[sSpriteOrder[i]];
-        if (sprite->inUse && !sprite->invisible && AddSpriteToOamBuffer(sprite, &oamIndex))
+        if (AddSpriteToOamBuffer(&gSprites[sSpriteOrder[i]], &oamIndex))
             return;
         i++;
     }
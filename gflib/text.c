@@ -2,6 +2,7 @@
 #include "battle.h"
 #include "main.h"
 #include "m4a.h"
+#include "malloc.h"
 #include "palette.h"
 #include "sound.h"
 #include "constants/songs.h"
@@ -29,6 +30,7 @@ static void DecompressGlyph_Short(u16, bool32);
 static void DecompressGlyph_Narrow(u16, bool32);
 static void DecompressGlyph_SmallNarrow(u16, bool32);
 static void DecompressGlyph_Bold(u16);
+static void DecompressGlyph(u8, u16, bool32);
 static u32 GetGlyphWidth_Small(u16, bool32);
 static u32 GetGlyphWidth_Normal(u16, bool32);
 static u32 GetGlyphWidth_Short(u16, bool32);
@@ -43,6 +45,21 @@ static u16 sLastTextBgColor;
 static u16 sLastTextFgColor;
 static u16 sLastTextShadowColor;
 
+// Decompressed glyphs are cached by font, glyph and text colors, since
+// menus and instant text redraw the same few characters over and over.
+#define GLYPH_CACHE_SETS 8
+#define GLYPH_CACHE_WAYS 4
+
+struct GlyphCacheEntry
+{
+    struct TextGlyph glyph;
+    u32 key;
+    u32 lastUse;
+};
+
+static EWRAM_DATA struct GlyphCacheEntry sGlyphCache[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS] = {0};
+static EWRAM_DATA u32 sGlyphCacheClock = 0;
+
 const struct FontInfo *gFonts;
 bool8 gDisableTextPrinters;
 struct TextGlyph gCurGlyph;
@@ -570,83 +587,92 @@ static u8 UNUSED GetLastTextColor(u8 colorType)
     }
 }
 
-inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u32 *glyphPixels, s32 width, s32 height)
+// Copies the opaque pixels of an up to 8 pixel wide glyph tile column into
+// the window, one row of 8 pixels at a time. A row that does not start on a
+// tile boundary is split across two destination words by shifting.
+static inline IWRAM_FUNC(BlitGlyphColumn) void BlitGlyphColumn(u8 *windowTiles, u32 widthOffset, u32 x, u32 y, const u32 *glyphPixels, s32 width, s32 height)
 {
-    u32 xAdd, yAdd, pixelData, bits, toOrr, dummyX;
-    u8 *dst;
+    u32 shift, widthMask, pixels, mask;
+    u32 *dst;
+
+    if (width <= 0 || height <= 0)
+        return;
 
-    xAdd = j + width;
-    yAdd = i + height;
-    dummyX = j;
-    for (; i < yAdd; i++)
+    widthMask = (width >= 8) ? 0xFFFFFFFF : (1 << (width * 4)) - 1;
+    shift = (x % 8) * 4;
+    windowTiles += (x / 8) * 32;
+
+    for (; height > 0; height--, y++)
     {
-        pixelData = *glyphPixels++;
-        for (j = dummyX; j < xAdd; j++)
-        {
-            if ((toOrr = pixelData & 0xF))
-            {
-                dst = windowTiles + ((j / 8) * 32) + ((j % 8) / 2) + ((i / 8) * widthOffset) + ((i % 8) * 4);
-                bits = ((j & 1) * 4);
-                *dst = (toOrr << bits) | (*dst & (0xF0 >> bits));
-            }
-            pixelData >>= 4;
-        }
+        pixels = *glyphPixels++ & widthMask;
+
+        // Set every nibble of the mask whose pixel is not transparent
+        mask = pixels | (pixels >> 1);
+        mask |= mask >> 2;
+        mask = (mask & 0x11111111) * 0xF;
+        if (mask == 0)
+            continue;
+
+        dst = (u32 *)(windowTiles + ((y / 8) * widthOffset) + ((y % 8) * 4));
+        dst[0] = (dst[0] & ~(mask << shift)) | (pixels << shift);
+        if (shift != 0 && (mask >> (32 - shift)) != 0)
+            dst[8] = (dst[8] & ~(mask >> (32 - shift))) | (pixels >> (32 - shift));
     }
 }
 
-void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+static void BlitGlyphToTiles(u8 *windowTiles, u32 widthOffset, u32 currX, u32 currY, s32 glyphWidth, s32 glyphHeight)
 {
-    struct Window *window;
-    struct WindowTemplate *template;
-    u32 *glyphPixels;
-    u32 currX, currY, widthOffset;
-    s32 glyphWidth, glyphHeight;
-    u8 *windowTiles;
-
-    window = &gWindows[textPrinter->printerTemplate.windowId];
-    template = &window->window;
-
-    if ((glyphWidth = (template->width * 8) - textPrinter->printerTemplate.currentX) > gCurGlyph.width)
-        glyphWidth = gCurGlyph.width;
-
-    if ((glyphHeight = (template->height * 8) - textPrinter->printerTemplate.currentY) > gCurGlyph.height)
-        glyphHeight = gCurGlyph.height;
-
-    currX = textPrinter->printerTemplate.currentX;
-    currY = textPrinter->printerTemplate.currentY;
-    glyphPixels = gCurGlyph.gfxBufferTop;
-    windowTiles = window->tileData;
-    widthOffset = template->width * 32;
+    u32 *glyphPixels = gCurGlyph.gfxBufferTop;
 
     if (glyphWidth < 9)
     {
         if (glyphHeight < 9)
         {
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY, glyphPixels, glyphWidth, glyphHeight);
+            BlitGlyphColumn(windowTiles, widthOffset, currX, currY, glyphPixels, glyphWidth, glyphHeight);
         }
         else
         {
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY, glyphPixels, glyphWidth, 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY + 8, glyphPixels + 16, glyphWidth, glyphHeight - 8);
+            BlitGlyphColumn(windowTiles, widthOffset, currX, currY, glyphPixels, glyphWidth, 8);
+            BlitGlyphColumn(windowTiles, widthOffset, currX, currY + 8, glyphPixels + 16, glyphWidth, glyphHeight - 8);
         }
     }
     else
     {
         if (glyphHeight < 9)
         {
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY, glyphPixels, 8, glyphHeight);
-            GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY, glyphPixels + 8, glyphWidth - 8, glyphHeight);
+            BlitGlyphColumn(windowTiles, widthOffset, currX, currY, glyphPixels, 8, glyphHeight);
+            BlitGlyphColumn(windowTiles, widthOffset, currX + 8, currY, glyphPixels + 8, glyphWidth - 8, glyphHeight);
         }
         else
         {
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY, glyphPixels, 8, 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY, glyphPixels + 8, glyphWidth - 8, 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY + 8, glyphPixels + 16, 8, glyphHeight - 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY + 8, glyphPixels + 24, glyphWidth - 8, glyphHeight - 8);
+            BlitGlyphColumn(windowTiles, widthOffset, currX, currY, glyphPixels, 8, 8);
+            BlitGlyphColumn(windowTiles, widthOffset, currX + 8, currY, glyphPixels + 8, glyphWidth - 8, 8);
+            BlitGlyphColumn(windowTiles, widthOffset, currX, currY + 8, glyphPixels + 16, 8, glyphHeight - 8);
+            BlitGlyphColumn(windowTiles, widthOffset, currX + 8, currY + 8, glyphPixels + 24, glyphWidth - 8, glyphHeight - 8);
         }
     }
 }
 
+void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+{
+    struct Window *window;
+    struct WindowTemplate *template;
+    s32 glyphWidth, glyphHeight;
+
+    window = &gWindows[textPrinter->printerTemplate.windowId];
+    template = &window->window;
+
+    if ((glyphWidth = (template->width * 8) - textPrinter->printerTemplate.currentX) > gCurGlyph.width)
+        glyphWidth = gCurGlyph.width;
+
+    if ((glyphHeight = (template->height * 8) - textPrinter->printerTemplate.currentY) > gCurGlyph.height)
+        glyphHeight = gCurGlyph.height;
+
+    BlitGlyphToTiles(window->tileData, template->width * 32,
+                     textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY,
+                     glyphWidth, glyphHeight);
+}
+
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
 {
     struct Window *window;
@@ -1140,30 +1166,7 @@ static u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
-        switch (subStruct->fontId)
-        {
-        case FONT_SMALL:
-            DecompressGlyph_Small(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL:
-            DecompressGlyph_Normal(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT:
-        case FONT_SHORT_COPY_1:
-        case FONT_SHORT_COPY_2:
-        case FONT_SHORT_COPY_3:
-            DecompressGlyph_Short(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROW:
-            DecompressGlyph_Narrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROW:
-            DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_BRAILLE:
-            break;
-        }
-
+        DecompressGlyph(subStruct->fontId, currChar, textPrinter->japanese);
         CopyGlyphToWindow(textPrinter);
 
         if (textPrinter->minLetterSpacing)
@@ -1717,6 +1720,136 @@ u8 GetMenuCursorDimensionByFont(u8 fontId, u8 whichDimension)
     return sMenuCursorDimensions[fontId][whichDimension];
 }
 
+static void DecompressGlyph_Uncached(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_SHORT:
+    case FONT_SHORT_COPY_1:
+    case FONT_SHORT_COPY_2:
+    case FONT_SHORT_COPY_3:
+        DecompressGlyph_Short(glyphId, isJapanese);
+        break;
+    case FONT_NARROW:
+        DecompressGlyph_Narrow(glyphId, isJapanese);
+        break;
+    case FONT_SMALL_NARROW:
+        DecompressGlyph_SmallNarrow(glyphId, isJapanese);
+        break;
+    }
+}
+
+void ClearGlyphCache(void)
+{
+    CpuFill32(0, sGlyphCache, sizeof(sGlyphCache));
+    sGlyphCacheClock = 0;
+}
+
+// Decompresses a glyph into gCurGlyph with the current text colors,
+// reusing a cached copy if this glyph was drawn recently.
+static void DecompressGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    struct GlyphCacheEntry *set, *entry;
+    u32 key, i;
+
+    // Braille glyphs are drawn by the braille font function itself.
+    if (fontId == FONT_BRAILLE)
+        return;
+
+    // Bit 31 marks the key as used, so an empty entry never matches.
+    key = (1u << 31)
+        | ((sLastTextShadowColor & 0xF) << 23)
+        | ((sLastTextBgColor & 0xF) << 19)
+        | ((sLastTextFgColor & 0xF) << 15)
+        | ((isJapanese != FALSE) << 14)
+        | ((fontId & 0x1F) << 9)
+        | (glyphId & 0x1FF);
+    set = sGlyphCache[(glyphId ^ (glyphId >> 3) ^ fontId) % GLYPH_CACHE_SETS];
+    sGlyphCacheClock++;
+
+    entry = &set[0];
+    for (i = 0; i < GLYPH_CACHE_WAYS; i++)
+    {
+        if (set[i].key == key)
+        {
+            set[i].lastUse = sGlyphCacheClock;
+            CpuFastCopy(&set[i].glyph, &gCurGlyph, sizeof(gCurGlyph.gfxBufferTop) + sizeof(gCurGlyph.gfxBufferBottom));
+            gCurGlyph.width = set[i].glyph.width;
+            gCurGlyph.height = set[i].glyph.height;
+            return;
+        }
+        if (set[i].lastUse < entry->lastUse)
+            entry = &set[i];
+    }
+
+    // Miss: decompress and replace the least recently used entry in the set
+    DecompressGlyph_Uncached(fontId, glyphId, isJapanese);
+    CpuFastCopy(&gCurGlyph, &entry->glyph, sizeof(gCurGlyph.gfxBufferTop) + sizeof(gCurGlyph.gfxBufferBottom));
+    entry->glyph.width = gCurGlyph.width;
+    entry->glyph.height = gCurGlyph.height;
+    entry->key = key;
+    entry->lastUse = sGlyphCacheClock;
+}
+
+#define TEXT_BENCHMARK_WIDTH_TILES 30
+#define TEXT_BENCHMARK_CHARS 100
+
+// Prints how many cycles it takes to decompress and draw 100 characters in
+// each font, once with an empty glyph cache and once with a warm one.
+void DebugBenchmarkTextRendering(void)
+{
+#ifndef NDEBUG
+    static const u8 sBenchmarkFonts[] = {FONT_SMALL, FONT_NORMAL, FONT_SHORT, FONT_NARROW, FONT_SMALL_NARROW};
+    u8 colors[3];
+    u8 *tiles;
+    u32 i, j, pass, x, cycles[2];
+
+    tiles = AllocZeroed(TEXT_BENCHMARK_WIDTH_TILES * 32 * 2);
+    if (tiles == NULL)
+        return;
+
+    SaveTextColors(&colors[0], &colors[1], &colors[2]);
+    GenerateFontHalfRowLookupTable(TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY);
+
+    for (i = 0; i < ARRAY_COUNT(sBenchmarkFonts); i++)
+    {
+        for (pass = 0; pass < 2; pass++)
+        {
+            if (pass == 0)
+                ClearGlyphCache();
+
+            x = 0;
+            REG_TM2CNT_H = 0;
+            REG_TM2CNT_L = 0;
+            REG_TM2CNT_H = TIMER_ENABLE | TIMER_64CLK;
+            for (j = 0; j < TEXT_BENCHMARK_CHARS; j++)
+            {
+                // Cycle through the 52 Latin letters
+                u16 glyphId = (j % 52 < 26) ? CHAR_A + j % 26 : CHAR_a + j % 26;
+
+                DecompressGlyph(sBenchmarkFonts[i], glyphId, FALSE);
+                BlitGlyphToTiles(tiles, TEXT_BENCHMARK_WIDTH_TILES * 32, x, 0, gCurGlyph.width, gCurGlyph.height);
+                x += gCurGlyph.width;
+                if (x > TEXT_BENCHMARK_WIDTH_TILES * 8 - 16)
+                    x = 0;
+            }
+            cycles[pass] = REG_TM2CNT_L * 64;
+            REG_TM2CNT_H = 0;
+        }
+        DebugPrintf("text: font %d cold=%d warm=%d cycles per %d chars", sBenchmarkFonts[i], cycles[0], cycles[1], TEXT_BENCHMARK_CHARS);
+    }
+
+    RestoreTextColors(&colors[0], &colors[1], &colors[2]);
+    Free(tiles);
+#endif
+}
+
 static void DecompressGlyph_Small(u16 glyphId, bool32 isJapanese)
 {
     const u16 *glyphs;
@@ -51,6 +51,8 @@ struct TrainerBall
 #define BOUNCE_MON          0x0
 #define BOUNCE_HEALTHBOX    0x1
 
+void BuildTypeEffectivenessMatrix(void);
+u8 GetTypeEffectivenessMultipliers(u8 moveType, u8 defType1, u8 defType2, bool8 foresight, u8 *multipliers);
 void CB2_InitBattle(void);
 void BattleMainCB2(void);
 void CB2_QuitRecordedBattle(void);
@@ -32,6 +32,10 @@
 //       AGB_PRINT is supported on respective debug units.
 
 #define LOG_HANDLER (LOG_HANDLER_MGBA_PRINT)
+
+// Uncomment to have DebugPrintHeapStats list the callers of Alloc and
+// AllocZeroed. Every allocation then scans a table of call sites.
+//#define TRACK_HEAP_CALL_SITES
 #endif
 
 #define ENGLISH
@@ -28,5 +28,7 @@ void SetCameraPanning(s16 horizontal, s16 vertical);
 void InstallCameraPanAheadCallback(void);
 void UpdateCameraPanning(void);
 void FieldUpdateBgTilemapScroll(void);
+bool32 IsTileRangeInFieldView(u16 firstTile, u16 numTiles);
+void TransferFieldTilemapStrips(void);
 
 #endif //GUARD_FIELD_CAMERA_H
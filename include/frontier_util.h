@@ -1,6 +1,18 @@
 #ifndef GUARD_FRONTIER_UTIL_H
 #define GUARD_FRONTIER_UTIL_H
 
+#include "constants/battle_frontier_mons.h"
+
+#define FRONTIER_POOL_WORDS ((NUM_FRONTIER_MONS + 31) / 32)
+
+// Bitmasks over gFacilityTrainerMons indices, so a pool needs no heap.
+struct FrontierMonPool
+{
+    u32 added[FRONTIER_POOL_WORDS];
+    u32 remaining[FRONTIER_POOL_WORDS];
+    u16 count;
+};
+
 void CallFrontierUtilFunc(void);
 u8 GetFrontierBrainStatus(void);
 void CopyFrontierTrainerText(u8 whichText, u16 trainerId);
@@ -24,6 +36,11 @@ u16 GetFrontierBrainMonMove(u8 monId, u8 moveSlotId);
 u8 GetFrontierBrainMonNature(u8 monId);
 u8 GetFrontierBrainMonEvs(u8 monId, u8 evStatId);
 s32 GetFronterBrainSymbol(void);
+void InitFrontierMonPool(struct FrontierMonPool *pool);
+void AddFrontierMonToPool(struct FrontierMonPool *pool, u16 monId);
+void ClearFrontierPartyExclusions(void);
+void ExcludeFrontierPartySpeciesAndItem(u16 species, u16 heldItem);
+u16 DrawFrontierMonFromPool(struct FrontierMonPool *pool);
 
 extern const u16 gFrontierBannedSpeciesEasy[];
 extern const u16 gFrontierBannedSpeciesNormal[];
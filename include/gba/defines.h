@@ -18,6 +18,29 @@
 
 #define ALIGNED(n) __attribute__((aligned(n)))
 
+// Compiles a function as ARM and places it in IWRAM, where it runs without
+// ROM waitstates. crt0 copies the section there at boot. Calls into it go
+// through a register, as IWRAM is out of reach of a bl from ROM, and for the
+// same reason the function itself must not call back into ROM.
+#if MODERN && !defined(HOST_BUILD)
+#define IWRAM_CODE __attribute__((section(".iwram_code"), target("arm"), long_call, noinline))
+#else
+#define IWRAM_CODE
+#endif
+
+// IWRAM_FUNC(name) on a function's prototype and definition opts it in: it
+// becomes IWRAM_CODE only while iwram_functions.txt also lists the name, and
+// does nothing otherwise. A function has to be tagged in the source before
+// the list can move it; after that, it can be moved in or out of IWRAM by
+// editing the list alone. The Makefile passes -DIWRAM_LISTED_<name>=1 for
+// each entry.
+#define IWRAM_FUNC(name) IWRAM_FUNC_EXPAND(IWRAM_LISTED_##name)
+#define IWRAM_FUNC_EXPAND(listed) IWRAM_FUNC_PASTE(listed)
+#define IWRAM_FUNC_PASTE(listed) IWRAM_FUNC_SELECT(IWRAM_FUNC_IF_##listed)
+#define IWRAM_FUNC_SELECT(comma) IWRAM_FUNC_PICK(comma IWRAM_CODE, , )
+#define IWRAM_FUNC_PICK(ignored, attr, ...) attr
+#define IWRAM_FUNC_IF_1 ,
+
 #define SOUND_INFO_PTR (*(struct SoundInfo **)0x3007FF0)
 #define INTR_CHECK     (*(u16 *)0x3007FF8)
 #define INTR_VECTOR    (*(void **)0x3007FFC)
@@ -216,6 +216,22 @@ struct SoundInfo
     s8 ALIGNED(4) pcmBuffer[PCM_DMA_BUF_SIZE * 2];
 };
 
+#define SOUND_MIX_STEAL_QUIETEST 0
+#define SOUND_MIX_STEAL_OLDEST   1
+
+// Cost of the DirectSound mixer in the last vblank, and how often voices
+// were stopped to keep it within the budget set by m4aSoundSetMixBudget.
+struct SoundMixerStats
+{
+    u32 cycles;
+    u32 peakCycles;
+    u32 cyclesPerVoice;
+    u32 steals;
+    u8 activeChans;
+    u8 peakActiveChans;
+    u8 voiceLimit;
+};
+
 struct SongHeader
 {
     u8 trackCount;
@@ -386,6 +402,7 @@ typedef void (*XcmdFunc)(struct MusicPlayerInfo *, struct MusicPlayerTrack *);
 extern const XcmdFunc gXcmdTable[];
 
 extern struct CgbChannel gCgbChans[];
+extern struct SoundMixerStats gSoundMixerStats;
 
 extern const u8 gScaleTable[];
 extern const u32 gFreqTable[];
@@ -423,6 +440,7 @@ void Clear64byte(void *addr);
 void SoundInit(struct SoundInfo *soundInfo);
 void MPlayExtender(struct CgbChannel *cgbChans);
 void m4aSoundMode(u32 mode);
+void m4aSoundSetMixBudget(u8 maxVoices, u32 maxCycles, u8 stealPolicy);
 void MPlayOpen(struct MusicPlayerInfo *mplayInfo, struct MusicPlayerTrack *tracks, u8 trackCount);
 void CgbSound(void);
 void CgbOscOff(u8);
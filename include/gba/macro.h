@@ -90,6 +90,13 @@
 
 #define CpuFastCopy(src, dest, size) CpuFastSet(src, dest, ((size)/(32/8) & 0x1FFFFF))
 
+#ifdef HOST_BUILD
+// Host builds (tools/battle_sim) have no DMA controller; the transfer is
+// carried out immediately by the host runtime.
+void HostDmaSet(int dmaNum, const void *src, void *dest, u32 control);
+#define DmaSetUnchecked(dmaNum, src, dest, control) \
+    HostDmaSet(dmaNum, (const void *)(src), (void *)(dest), (u32)(control))
+#else
 #define DmaSetUnchecked(dmaNum, src, dest, control) \
 {                                                 \
     vu32 *dmaRegs = (vu32 *)REG_ADDR_DMA##dmaNum; \
@@ -101,6 +108,7 @@
     register u32 r_ctl asm("r2") = eval_ctl;      \
     asm volatile("stmia %0!, {%1, %2, %3}" : "+l" (dmaRegs) : "l" (r_src), "l" (r_dst), "l" (r_ctl) : "memory");  \
 }
+#endif // HOST_BUILD
 
 #if MODERN
 // NOTE: Assumes 16-bit DMAs.
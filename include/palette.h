@@ -69,7 +69,14 @@ struct PaletteFadeControl
     u8 deltaY:4; // rate of change of blend coefficient
 };
 
+struct TimeBlendStats
+{
+    u32 palettesBlended;
+    u32 palettesReused;
+};
+
 extern const struct BlendSettings gTimeOfDayBlend[];
+extern struct TimeBlendStats gTimeBlendStats;
 
 extern struct PaletteFadeControl gPaletteFade;
 extern u32 gPlttBufferTransferPending;
@@ -94,12 +101,14 @@ void UnfadePlttBuffer(u32 selectedPalettes);
 void BeginFastPaletteFade(u8 submode);
 void BeginHardwarePaletteFade(u8 blendCnt, u8 delay, u8 y, u8 targetY, u8 shouldResetBlendRegisters);
 void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color);
-void BlendPalettesFine(u32 palettes, u16 *src, u16 *dst, u32 coeff, u32 color);
+IWRAM_FUNC(BlendPalettesFine) void BlendPalettesFine(u32 palettes, u16 *src, u16 *dst, u32 coeff, u32 color);
 void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u16 color);
 void BlendPalettesGradually(u32 selectedPalettes, s8 delay, u8 coeff, u8 coeffTarget, u16 color, u8 priority, u8 id);
-void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor);
+IWRAM_FUNC(TimeBlendPalette) void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor);
 void TintPalette_RGB_Copy(u16 palOffset, u32 blendColor);
 void TimeMixPalettes(u32, u16 *, u16 *, struct BlendSettings *, struct BlendSettings *, u16);
+void TimeMixPalettesCached(u32 palettes, struct BlendSettings *blend0, struct BlendSettings *blend1, u16 weight0);
+void DebugPrintTimeBlendStats(void);
 void AvgPaletteWeighted(u16 *src0, u16 *src1, u16 *dst, u16 weight0);
 void TintPalette_GrayScale(u16 *palette, u16 count);
 void TintPalette_GrayScale2(u16 *palette, u16 count);
@@ -241,6 +241,25 @@ struct Pokemon
     u16 spDefense;
 };
 
+// The fields list views need from a box mon, filled in by GetBoxMonSummary.
+// personality, checksum and the sanity flags are the mon's plaintext header,
+// so a copy can be checked against the mon without decrypting it.
+struct BoxMonSummary
+{
+    u32 personality;
+    u16 checksum;
+    u16 species;
+    u16 speciesOrEgg;
+    u16 heldItem;
+    u8 level;
+    u8 isEgg:1;
+    u8 isBadEgg:1;
+    u8 hasSpecies:1;
+    u8 sanityIsEgg:1;
+    u8 nuzlockeRibbon:1;
+    u8 unused:3;
+};
+
 struct MonSpritesGfxManager
 {
     u32 numSprites:4;
@@ -445,6 +464,7 @@ u16 GetUnionRoomTrainerClass(void);
 void CreateEnemyEventMon(void);
 void CalculateMonStats(struct Pokemon *mon);
 void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest);
+u8 GetLevelFromSpeciesExp(u16 species, u32 exp);
 u8 GetLevelFromMonExp(struct Pokemon *mon);
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon);
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move);
@@ -477,6 +497,9 @@ u32 GetMonData3(struct Pokemon *mon, s32 field, u8 *data);
 u32 GetMonData2(struct Pokemon *mon, s32 field);
 u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data);
 u32 GetBoxMonData2(struct BoxPokemon *boxMon, s32 field);
+void GetBoxMonDataFields(struct BoxPokemon *boxMon, const s32 *fields, u32 *values, u32 count);
+void GetBoxMonSummary(struct BoxPokemon *boxMon, struct BoxMonSummary *summary);
+void DebugBenchmarkCreateMon(void);
 
 void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg);
 void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg);
@@ -584,6 +607,8 @@ u16 PickRandomStarter(u16 *speciesList, u8 starterId);
 u8 GetTypeBySpecies(u16 species, u8 typeNum);
 u16 GetSpeciesRandomSeeded(u16 species, u8 type, u16 additionalOffset);
 u16 GetRandomMove(u16 input_move, u16 species);
+void BuildRandomizerTables(void);
+void DebugPrintRandomizerTables(void);
 u8 GetRandomType(void);
 u8 EvolutionBlockedByEvoLimit(u16 species);
 
@@ -40,6 +40,9 @@ void ResetPokemonStorageSystem(void);
 s16 CompactPartySlots(void);
 u8 StorageGetCurrentBox(void);
 u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request);
+void InvalidateBoxMonSummaryAt(u8 boxId, u8 boxPosition);
+void InvalidateBoxMonSummaries(void);
+const struct BoxMonSummary *GetBoxMonSummaryAt(u8 boxId, u8 boxPosition);
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value);
 u32 GetCurrentBoxMonData(u8 boxPosition, s32 request);
 void SetCurrentBoxMonData(u8 boxPosition, s32 request, const void *value);
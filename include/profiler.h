@@ -0,0 +1,65 @@
+#ifndef GUARD_PROFILER_H
+#define GUARD_PROFILER_H
+
+// Frame profiler for debug builds. A zone times the code between
+// ProfilerBeginZone and ProfilerEndZone, or the statements given to
+// PROFILE_ZONE. Each zone's total for a frame (one pass of the main loop,
+// with the vblank that ends it) is folded into min/avg/max over
+// PROFILER_WINDOW_FRAMES frames, which is logged with DebugPrintf and kept
+// for the debug menu's HUD. Zones include the time of any nested zone or
+// interrupt, so the idle zone around WaitForVBlank also counts the vblank.
+
+enum ProfileZone
+{
+    PROFILE_ZONE_FRAME, // The whole frame, filled in by ProfilerEndFrame
+    PROFILE_ZONE_CB1,
+    PROFILE_ZONE_CB2,
+    PROFILE_ZONE_RUN_TASKS,
+    PROFILE_ZONE_ANIMATE_SPRITES,
+    PROFILE_ZONE_BUILD_OAM,
+    PROFILE_ZONE_WAIT_VBLANK,
+    PROFILE_ZONE_VBLANK,
+    PROFILE_ZONE_VBLANK_CB,
+    PROFILE_ZONE_TRANSFER_PLTT,
+    PROFILE_ZONE_DMA3,
+    PROFILE_ZONE_M4A,
+    // New zones go here, with a name in sProfileZoneNames.
+    PROFILE_ZONE_COUNT
+};
+
+#define PROFILER_WINDOW_FRAMES 60
+
+// In CPU cycles, per frame.
+struct ProfileZoneStats
+{
+    u32 min;
+    u32 avg;
+    u32 max;
+};
+
+#define PROFILE_ZONE(zone, ...)     \
+do {                                \
+    ProfilerBeginZone(zone);        \
+    __VA_ARGS__;                    \
+    ProfilerEndZone(zone);          \
+} while (0)
+
+#ifndef NDEBUG
+void ProfilerBeginZone(u32 zone);
+void ProfilerEndZone(u32 zone);
+void ProfilerEndFrame(void);
+#else
+#define ProfilerBeginZone(zone)
+#define ProfilerEndZone(zone)
+#define ProfilerEndFrame()
+#endif
+
+void EnableProfiler(bool32 log);
+void DisableProfiler(void);
+bool32 IsProfilerEnabled(void);
+bool32 IsProfilerLogging(void);
+u32 GetProfilerReportCount(void);
+const struct ProfileZoneStats *GetProfilerReport(void);
+const char *GetProfileZoneName(u32 zone);
+
+#endif // GUARD_PROFILER_H
@@ -98,6 +98,19 @@ extern struct SaveSectorLocation gRamSaveSectorLocations[];
 
 extern struct SaveSector gSaveDataBuffer;
 
+// Sector counts and timing of normal saves, which skip unchanged sectors
+struct SaveWriteStats
+{
+    u32 numSaves;
+    u32 totalSectorsWritten;
+    u32 totalSectorsSkipped;
+    u32 lastFrames;
+    u8 lastSectorsWritten;
+    u8 lastSectorsSkipped;
+};
+
+extern struct SaveWriteStats gSaveWriteStats;
+
 void ClearSaveData(void);
 void Save_ResetSaveCounters(void);
 u8 HandleSavingData(u8 saveType);
@@ -45,5 +45,6 @@ void SE12PanpotControl(s8 pan);
 bool8 IsSEPlaying(void);
 bool8 IsBGMPlaying(void);
 bool8 IsSpecialSEPlaying(void);
+void DebugPrintSoundMixerStats(void);
 
 #endif // GUARD_SOUND_H
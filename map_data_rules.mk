@@ -3,20 +3,32 @@
 MAPS_DIR = $(DATA_ASM_SUBDIR)/maps
 LAYOUTS_DIR = $(DATA_ASM_SUBDIR)/layouts
 
-MAP_DIRS := $(dir $(wildcard $(MAPS_DIR)/*/map.json))
+# mapjson maps-all only generates the maps listed in map_groups.json, so a
+# map directory that isn't in any group has no outputs to wait for.
+MAP_GROUP_ENTRIES := $(shell sed -n 's/^ *"\([A-Za-z0-9_]*\)",\{0,1\} *$$/\1/p' $(MAPS_DIR)/map_groups.json)
+MAP_DIRS := $(filter $(addprefix $(MAPS_DIR)/,$(addsuffix /,$(MAP_GROUP_ENTRIES))),$(dir $(wildcard $(MAPS_DIR)/*/map.json)))
 MAP_CONNECTIONS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/connections.inc,$(MAP_DIRS))
 MAP_EVENTS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/events.inc,$(MAP_DIRS))
 MAP_HEADERS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/header.inc,$(MAP_DIRS))
+MAP_JSONS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/map.json,$(MAP_DIRS))
+MAPS_STAMP := $(MAPS_DIR)/maps_all.stamp
+MAP_OUTPUTS := $(MAP_CONNECTIONS) $(MAP_EVENTS) $(MAP_HEADERS)
+# The stamp alone can't tell that an output was deleted, so rerun mapjson
+# when any is missing.
+MISSING_MAP_OUTPUTS := $(filter-out $(wildcard $(MAP_OUTPUTS)),$(MAP_OUTPUTS))
 
 $(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAP_CONNECTIONS) $(MAP_HEADERS)
 	$(PREPROC) $< charmap.txt | $(CPP) -I include - | $(AS) $(ASFLAGS) -o $@
 $(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAP_EVENTS)
 	$(PREPROC) $< charmap.txt | $(CPP) -I include - | $(AS) $(ASFLAGS) -o $@
 
-$(MAPS_DIR)/%/header.inc: $(MAPS_DIR)/%/map.json
-	$(MAPJSON) map emerald $< $(LAYOUTS_DIR)/layouts.json
-$(MAPS_DIR)/%/events.inc: $(MAPS_DIR)/%/header.inc ;
-$(MAPS_DIR)/%/connections.inc: $(MAPS_DIR)/%/events.inc ;
+# All map header/events/connections files are generated by one mapjson run, which
+# only rewrites the files whose contents changed.
+$(MAPS_STAMP): $(MAPS_DIR)/map_groups.json $(LAYOUTS_DIR)/layouts.json $(MAP_JSONS) $(if $(MISSING_MAP_OUTPUTS),maps-all-force)
+	$(MAPJSON) maps-all emerald $(MAPS_DIR)/map_groups.json $(LAYOUTS_DIR)/layouts.json
+	@touch $@
+$(MAP_OUTPUTS): $(MAPS_STAMP) ;
+.PHONY: maps-all-force
 
 $(MAPS_DIR)/groups.inc: $(MAPS_DIR)/map_groups.json
 	$(MAPJSON) groups emerald $<
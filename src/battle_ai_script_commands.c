@@ -624,6 +624,13 @@ static void RecordLastUsedMoveByTarget(void)
 {
     s32 i;
 
+    // BUG: A battler whose move failed to execute has MOVE_UNAVAILABLE as its last
+    // move, which gets recorded and later indexes gBattleMoves out of bounds.
+    #ifdef BUGFIX
+    if (gLastMoves[gBattlerTarget] == MOVE_UNAVAILABLE)
+        return;
+    #endif
+
     for (i = 0; i < MAX_MON_MOVES; i++)
     {
         if (BATTLE_HISTORY->usedMoves[gBattlerTarget].moves[i] == gLastMoves[gBattlerTarget])
@@ -2136,6 +2143,16 @@ static void Cmd_get_used_held_item(void)
 
 static void Cmd_get_move_type_from_result(void)
 {
+    // BUG: The result may be MOVE_UNAVAILABLE from get_last_used_move.
+    #ifdef BUGFIX
+    if (AI_THINKING_STRUCT->funcResult >= MOVES_COUNT)
+    {
+        AI_THINKING_STRUCT->funcResult = 0;
+        gAIScriptPtr += 1;
+        return;
+    }
+    #endif
+
     AI_THINKING_STRUCT->funcResult = gBattleMoves[AI_THINKING_STRUCT->funcResult].type;
 
     gAIScriptPtr += 1;
@@ -2143,6 +2160,16 @@ static void Cmd_get_move_type_from_result(void)
 
 static void Cmd_get_move_power_from_result(void)
 {
+    // BUG: The result may be MOVE_UNAVAILABLE from get_last_used_move.
+    #ifdef BUGFIX
+    if (AI_THINKING_STRUCT->funcResult >= MOVES_COUNT)
+    {
+        AI_THINKING_STRUCT->funcResult = 0;
+        gAIScriptPtr += 1;
+        return;
+    }
+    #endif
+
     AI_THINKING_STRUCT->funcResult = gBattleMoves[AI_THINKING_STRUCT->funcResult].power;
 
     gAIScriptPtr += 1;
@@ -2150,6 +2177,16 @@ static void Cmd_get_move_power_from_result(void)
 
 static void Cmd_get_move_effect_from_result(void)
 {
+    // BUG: The result may be MOVE_UNAVAILABLE from get_last_used_move.
+    #ifdef BUGFIX
+    if (AI_THINKING_STRUCT->funcResult >= MOVES_COUNT)
+    {
+        AI_THINKING_STRUCT->funcResult = 0;
+        gAIScriptPtr += 1;
+        return;
+    }
+    #endif
+
     AI_THINKING_STRUCT->funcResult = gBattleMoves[AI_THINKING_STRUCT->funcResult].effect;
 
     gAIScriptPtr += 1;
@@ -606,49 +606,13 @@ void AI_TrySwitchOrUseItem(void)
 
 static void ModulateByTypeEffectiveness(u8 atkType, u8 defType1, u8 defType2, u8 *var)
 {
-    s32 i = 0;
-    if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
-    {
-        while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
-        {
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-            {
-                i += 3;
-                continue;
-            }
-            else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == atkType)
-            {
-                // Check type1.
-                if (TYPE_EFFECT_DEF_TYPE(i) == defType1)
-                    *var = (*var * TYPE_EFFECT_MULTIPLIER(i)) / TYPE_MUL_NORMAL;
-                // Check type2.
-                if (TYPE_EFFECT_DEF_TYPE(i) == defType2 && defType1 != defType2)
-                    *var = (*var * TYPE_EFFECT_MULTIPLIER(i)) / TYPE_MUL_NORMAL;
-            }
-            i += 3;
-        }
-    }
-    else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-    {
-        while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-        {
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-            {
-                i += 3;
-                continue;
-            }
-            else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == atkType)
-            {
-                // Check type1.
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == defType1)
-                    *var = (*var * TYPE_EFFECT_MULTIPLIER_OLD(i)) / TYPE_MUL_NORMAL;
-                // Check type2.
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == defType2 && defType1 != defType2)
-                    *var = (*var * TYPE_EFFECT_MULTIPLIER_OLD(i)) / TYPE_MUL_NORMAL;
-            }
-            i += 3;
-        }
-    }
+    s32 i;
+    u8 multipliers[2];
+    u8 count;
+
+    count = GetTypeEffectivenessMultipliers(atkType, defType1, defType2, FALSE, multipliers);
+    for (i = 0; i < count; i++)
+        *var = (*var * multipliers[i]) / TYPE_MUL_NORMAL;
 }
 
 u8 GetMostSuitableMonToSwitchInto(void)
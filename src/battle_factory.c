@@ -35,10 +35,11 @@ static void SetPlayerAndOpponentParties(void);
 static void SetOpponentGfxVar(void);
 static void GenerateOpponentMons(void);
 static void GenerateInitialRentalMons(void);
+static void InitFactoryRentalPool(struct FrontierMonPool *pool, u8 lvlMode, u8 challengeNum, bool8 useBetterRange);
 static void GetOpponentMostCommonMonType(void);
 static void GetOpponentBattleStyle(void);
 static void RestorePlayerPartyHeldItems(void);
-static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange);
+static const u16 *GetFactoryMonIdRange(u8 lvlMode, u8 challengeNum, bool8 useBetterRange);
 static u8 GetMoveBattleStyle(u16 move);
 
 // Number of moves needed on the team to be considered using a certain battle style
@@ -302,11 +303,11 @@ static void SetPerformedRentalSwap(void)
 
 static void GenerateOpponentMons(void)
 {
-    int i, j, k;
-    u16 species[FRONTIER_PARTY_SIZE];
-    u16 heldItems[FRONTIER_PARTY_SIZE];
-    int firstMonId = 0;
+    int i;
+    u16 monId;
     u16 trainerId = 0;
+    const u16 *range;
+    struct FrontierMonPool pool;
     u32 lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     u32 battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
     u32 winStreak = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode];
@@ -328,52 +329,29 @@ static void GenerateOpponentMons(void)
     if (gSaveBlock2Ptr->frontier.curChallengeBattleNum < FRONTIER_STAGES_PER_CHALLENGE - 1)
         gSaveBlock2Ptr->frontier.trainerIds[gSaveBlock2Ptr->frontier.curChallengeBattleNum] = trainerId;
 
-    i = 0;
-    while (i != FRONTIER_PARTY_SIZE)
+    range = GetFactoryMonIdRange(lvlMode, challengeNum, FALSE);
+    InitFrontierMonPool(&pool);
+    for (monId = range[0]; monId <= range[1]; monId++)
     {
-        u16 monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
-
         // Unown (FRONTIER_MON_UNOWN) is forbidden on opponent Factory teams.
         if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
             continue;
 
-        // Ensure none of the opponent's Pokémon are the same as the potential rental Pokémon for the player
-        for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
-        {
-            if (gFacilityTrainerMons[monId].species == gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[j].monId].species)
-                break;
-        }
-        if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
-            continue;
-
         // "High tier" pokemon are only allowed on open level mode
         if (lvlMode == FRONTIER_LVL_OPEN && monId > FRONTIER_MONS_HIGH_TIER)
             continue;
 
-        // Ensure this species hasn't already been chosen for the opponent
-        for (k = firstMonId; k < firstMonId + i; k++)
-        {
-            if (species[k] == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (k != firstMonId + i)
-            continue;
+        AddFrontierMonToPool(&pool, monId);
+    }
 
-        // Ensure held items don't repeat on the opponent's team
-        for (k = firstMonId; k < firstMonId + i; k++)
-        {
-            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (k != firstMonId + i)
-            continue;
+    // Ensure none of the opponent's Pokémon are the same as the potential rental Pokémon for the player.
+    // Species and held items also can't repeat on the opponent's team.
+    ClearFrontierPartyExclusions();
+    for (i = 0; i < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); i++)
+        ExcludeFrontierPartySpeciesAndItem(gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[i].monId].species, ITEM_NONE);
 
-        // Successful selection
-        species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
-        gFrontierTempParty[i] = monId;
-        i++;
-    }
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+        gFrontierTempParty[i] = DrawFrontierMonFromPool(&pool);
 }
 
 static void SetOpponentGfxVar(void)
@@ -522,8 +500,7 @@ static void SetPlayerAndOpponentParties(void)
 
 static void GenerateInitialRentalMons(void)
 {
-    int i, j;
-    u8 firstMonId;
+    int i;
     u8 battleMode;
     u8 lvlMode;
     u8 challengeNum;
@@ -531,18 +508,10 @@ static void GenerateInitialRentalMons(void)
     u8 factoryBattleMode;
     u8 rentalRank;
     u16 monId;
-    u16 currSpecies;
-    u16 species[PARTY_SIZE];
-    u16 monIds[PARTY_SIZE];
-    u16 heldItems[PARTY_SIZE];
+    struct FrontierMonPool betterPool;
+    struct FrontierMonPool pool;
 
     gFacilityTrainers = gBattleFrontierTrainers;
-    for (i = 0; i < PARTY_SIZE; i++)
-    {
-        species[i] = SPECIES_NONE;
-        monIds[i] = 0;
-        heldItems[i] = ITEM_NONE;
-    }
     lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
     challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / FRONTIER_STAGES_PER_CHALLENGE;
@@ -556,64 +525,38 @@ static void GenerateInitialRentalMons(void)
     else if (gSaveBlock2Ptr->optionStyle == 0) //on
         gFacilityTrainerMons = gBattleFrontierMonsSplit;
     if (gSaveBlock2Ptr->frontier.lvlMode != FRONTIER_LVL_50)
-    {
         factoryLvlMode = FRONTIER_LVL_OPEN;
-        firstMonId = 0;
-    }
     else
-    {
         factoryLvlMode = FRONTIER_LVL_50;
-        firstMonId = 0;
-    }
     rentalRank = GetNumPastRentalsRank(factoryBattleMode, factoryLvlMode);
 
-    currSpecies = SPECIES_NONE;
-    i = 0;
-    while (i != PARTY_SIZE)
+    // The more times the player has rented, the more initial rentals are generated from a better set of Pokémon
+    InitFactoryRentalPool(&betterPool, factoryLvlMode, challengeNum, TRUE);
+    InitFactoryRentalPool(&pool, factoryLvlMode, challengeNum, FALSE);
+
+    // Cannot have two Pokémon of the same species or two same held items.
+    // Both pools draw against the same exclusions.
+    ClearFrontierPartyExclusions();
+    for (i = 0; i < PARTY_SIZE; i++)
     {
-        if (i < rentalRank) // The more times the player has rented, the more initial rentals are generated from a better set of Pokémon
-            monId = GetFactoryMonId(factoryLvlMode, challengeNum, TRUE);
+        if (i < rentalRank)
+            monId = DrawFrontierMonFromPool(&betterPool);
         else
-            monId = GetFactoryMonId(factoryLvlMode, challengeNum, FALSE);
-
-        if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
-            continue;
-
-        // Cannot have two Pokémon of the same species.
-        for (j = firstMonId; j < firstMonId + i; j++)
-        {
-            u16 existingMonId = monIds[j];
-            if (existingMonId == monId)
-                break;
-            if (species[j] == gFacilityTrainerMons[monId].species)
-            {
-                if (currSpecies == SPECIES_NONE)
-                    currSpecies = gFacilityTrainerMons[monId].species;
-                else
-                    break;
-            }
-        }
-        if (j != firstMonId + i)
-            continue;
+            monId = DrawFrontierMonFromPool(&pool);
+        gSaveBlock2Ptr->frontier.rentalMons[i].monId = monId;
+    }
+}
 
-        // Cannot have two same held items.
-        for (j = firstMonId; j < firstMonId + i; j++)
-        {
-            if (heldItems[j] != ITEM_NONE && heldItems[j] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-            {
-                if (gFacilityTrainerMons[monId].species == currSpecies)
-                    currSpecies = SPECIES_NONE;
-                break;
-            }
-        }
-        if (j != firstMonId + i)
-            continue;
+static void InitFactoryRentalPool(struct FrontierMonPool *pool, u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
+{
+    u16 monId;
+    const u16 *range = GetFactoryMonIdRange(lvlMode, challengeNum, useBetterRange);
 
-        gSaveBlock2Ptr->frontier.rentalMons[i].monId = monId;
-        species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
-        monIds[i] = monId;
-        i++;
+    InitFrontierMonPool(pool);
+    for (monId = range[0]; monId <= range[1]; monId++)
+    {
+        if (gFacilityTrainerMons[monId].species != SPECIES_UNOWN)
+            AddFrontierMonToPool(pool, monId);
     }
 }
 
@@ -790,8 +733,9 @@ u8 GetFactoryMonFixedIV(u8 challengeNum, bool8 isLastBattle)
 void FillFactoryBrainParty(void)
 {
     int i, j, k;
-    u16 species[FRONTIER_PARTY_SIZE];
-    u16 heldItems[FRONTIER_PARTY_SIZE];
+    u16 monId;
+    const u16 *range;
+    struct FrontierMonPool pool;
     u8 friendship;
     int monLevel;
     u8 fixedIV;
@@ -802,13 +746,12 @@ void FillFactoryBrainParty(void)
     u8 challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / FRONTIER_STAGES_PER_CHALLENGE;
     fixedIV = GetFactoryMonFixedIV(challengeNum + 2, FALSE);
     monLevel = SetFacilityPtrsGetLevel();
-    i = 0;
     otId = T1_READ_32(gSaveBlock2Ptr->playerTrainerId);
 
-    while (i != FRONTIER_PARTY_SIZE)
+    range = GetFactoryMonIdRange(lvlMode, challengeNum, FALSE);
+    InitFrontierMonPool(&pool);
+    for (monId = range[0]; monId <= range[1]; monId++)
     {
-        u16 monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
-
         if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
             continue;
         if (lvlMode == FRONTIER_LVL_OPEN && monId > FRONTIER_MONS_HIGH_TIER)
@@ -822,24 +765,13 @@ void FillFactoryBrainParty(void)
         if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
             continue;
 
-        for (k = 0; k < i; k++)
-        {
-            if (species[k] == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (k != i)
-            continue;
-
-        for (k = 0; k < i; k++)
-        {
-            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (k != i)
-            continue;
+        AddFrontierMonToPool(&pool, monId);
+    }
 
-        species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+    ClearFrontierPartyExclusions();
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        monId = DrawFrontierMonFromPool(&pool);
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i],
                                              gFacilityTrainerMons[monId].species,
                                              monLevel,
@@ -853,13 +785,12 @@ void FillFactoryBrainParty(void)
             SetMonMoveAvoidReturn(&gEnemyParty[i], gFacilityTrainerMons[monId].moves[k], k);
         SetMonData(&gEnemyParty[i], MON_DATA_FRIENDSHIP, &friendship);
         SetMonData(&gEnemyParty[i], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
-        i++;
     }
 }
 
-static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
+// Returns the first and last mon the Factory draws from for this challenge.
+static const u16 *GetFactoryMonIdRange(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
 {
-    u16 numMons, monId;
     u16 adder; // Used to skip past early mons for open level
 
     if (lvlMode == FRONTIER_LVL_50)
@@ -867,33 +798,12 @@ static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
     else
         adder = 8;
 
-    if (challengeNum < 7)
-    {
-        if (useBetterRange)
-        {
-            numMons = (sInitialRentalMonRanges[adder + challengeNum + 1][1] - sInitialRentalMonRanges[adder + challengeNum + 1][0]) + 1;
-            monId = Random() % numMons;
-            monId += sInitialRentalMonRanges[adder + challengeNum + 1][0];
-        }
-        else
-        {
-            numMons = (sInitialRentalMonRanges[adder + challengeNum][1] - sInitialRentalMonRanges[adder + challengeNum][0]) + 1;
-            monId = Random() % numMons;
-            monId += sInitialRentalMonRanges[adder + challengeNum][0];
-        }
-    }
+    if (challengeNum >= 7)
+        return sInitialRentalMonRanges[adder + 7];
+    else if (useBetterRange)
+        return sInitialRentalMonRanges[adder + challengeNum + 1];
     else
-    {
-        u16 challenge = challengeNum;
-        if (challenge != 7)
-            challenge = 7; // why bother assigning it above at all
-
-        numMons = (sInitialRentalMonRanges[adder + challenge][1] - sInitialRentalMonRanges[adder + challenge][0]) + 1;
-        monId = Random() % numMons;
-        monId += sInitialRentalMonRanges[adder + challenge][0];
-    }
-
-    return monId;
+        return sInitialRentalMonRanges[adder + challengeNum];
 }
 
 u8 GetNumPastRentalsRank(u8 battleMode, u8 lvlMode)
@@ -249,6 +249,13 @@ EWRAM_DATA u16 gLastThrownBall = 0;
 EWRAM_DATA u16 gBallToDisplay = 0;
 EWRAM_DATA bool8 gLastUsedBallMenuPresent = FALSE;
 
+// Dense copy of the active type chart, indexed by [attacking type][defending type].
+// sTypeChartPositions holds each entry's 1-based position in the chart (0 if the pair
+// has no entry), so that a dual type's multipliers are still applied in chart order.
+EWRAM_DATA static u8 sTypeChartMultipliers[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES] = {0};
+EWRAM_DATA static u8 sTypeChartPositions[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES] = {0};
+EWRAM_DATA static u8 sTypeChartForesightPosition = 0;
+
 void (*gPreBattleCallback1)(void);
 void (*gBattleMainFunc)(void);
 struct BattleResults gBattleResults;
@@ -792,6 +799,83 @@ const u8 gTypeEffectiveness_Old[366] = //Gen 6 type chart, and it's the one read
     TYPE_ENDTABLE, TYPE_ENDTABLE, TYPE_MUL_NO_EFFECT
 };*/
 
+// Rebuilds the type chart matrix from the chart selected by tx_Mode_TypeEffectiveness,
+// with attacking types passed through the type effectiveness randomizer.
+// Must be called again whenever either option changes.
+void BuildTypeEffectivenessMatrix(void)
+{
+    const u8 *chart;
+    u8 atkType, defType, position;
+    s32 i;
+
+    memset(sTypeChartPositions, 0, sizeof(sTypeChartPositions));
+    sTypeChartForesightPosition = 0xFF;
+
+    if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
+        chart = gTypeEffectiveness;
+    else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
+        chart = gTypeEffectiveness_Old;
+    else
+        return;
+
+    // The charts have at most one entry per (attacking, defending) pair.
+    for (i = 0, position = 1; chart[i] != TYPE_ENDTABLE; i += 3, position++)
+    {
+        if (chart[i] == TYPE_FORESIGHT)
+        {
+            sTypeChartForesightPosition = position;
+            continue;
+        }
+
+        atkType = GetTypeEffectivenessRandom(chart[i]);
+        defType = chart[i + 1];
+        if (atkType < NUMBER_OF_MON_TYPES && defType < NUMBER_OF_MON_TYPES)
+        {
+            sTypeChartMultipliers[atkType][defType] = chart[i + 2];
+            sTypeChartPositions[atkType][defType] = position;
+        }
+    }
+}
+
+// Writes the multipliers the type chart applies to a move of moveType against a target
+// with defType1/defType2 into multipliers, in chart order, and returns their count (0-2).
+// When foresight is set, the entries listed after TYPE_FORESIGHT are left out.
+u8 GetTypeEffectivenessMultipliers(u8 moveType, u8 defType1, u8 defType2, bool8 foresight, u8 *multipliers)
+{
+    u8 position1 = 0, position2 = 0, count = 0;
+
+    if (moveType >= NUMBER_OF_MON_TYPES)
+        return 0;
+
+    if (defType1 < NUMBER_OF_MON_TYPES)
+        position1 = sTypeChartPositions[moveType][defType1];
+    if (defType2 < NUMBER_OF_MON_TYPES && defType1 != defType2)
+        position2 = sTypeChartPositions[moveType][defType2];
+
+    if (foresight)
+    {
+        if (position1 > sTypeChartForesightPosition)
+            position1 = 0;
+        if (position2 > sTypeChartForesightPosition)
+            position2 = 0;
+    }
+
+    if (position1 != 0 && (position2 == 0 || position1 < position2))
+    {
+        multipliers[count++] = sTypeChartMultipliers[moveType][defType1];
+        if (position2 != 0)
+            multipliers[count++] = sTypeChartMultipliers[moveType][defType2];
+    }
+    else if (position2 != 0)
+    {
+        multipliers[count++] = sTypeChartMultipliers[moveType][defType2];
+        if (position1 != 0)
+            multipliers[count++] = sTypeChartMultipliers[moveType][defType1];
+    }
+
+    return count;
+}
+
 const u8 gTypeNames[NUMBER_OF_MON_TYPES][TYPE_NAME_LENGTH + 1] =
 {
     [TYPE_NORMAL] = _("NORMAL"),
@@ -934,6 +1018,7 @@ const u8 * const gStatusConditionStringsTable[][2] =
 
 void CB2_InitBattle(void)
 {
+    BuildTypeEffectivenessMatrix();
     MoveSaveBlocks_ResetHeap();
     AllocateBattleResources();
     AllocateBattleSpritesData();
@@ -1466,103 +1466,40 @@ s32 GetTypeEffectiveness(struct Pokemon *mon, u8 moveType) {
     u16 species = GetMonData(mon, MON_DATA_SPECIES);
     u8 type1 = GetTypeBySpecies(species, 1);
     u8 type2 = GetTypeBySpecies(species, 2);
-    s32 i = 0;
-    u8 multiplier;
+    s32 i;
+    u8 multipliers[2];
+    u8 count;
     s32 flags = 0;
     if (GetMonAbility(mon) == ABILITY_LEVITATE && moveType == TYPE_GROUND)
         return MOVE_RESULT_NOT_VERY_EFFECTIVE;
-    if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
+    count = GetTypeEffectivenessMultipliers(moveType, type1, type2, FALSE, multipliers);
+    for (i = 0; i < count; i++)
     {
-        while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE) {
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT) {
-                i += 3;
-                continue;
-            }
-            else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType) {
-                // check type1
-                if (TYPE_EFFECT_DEF_TYPE(i) == type1)
-                    multiplier = TYPE_EFFECT_MULTIPLIER(i);
-                else if (TYPE_EFFECT_DEF_TYPE(i) == type2 && type1 != type2)
-                    multiplier = TYPE_EFFECT_MULTIPLIER(i);
-                else {
-                    i += 3;
-                    continue;
-                }
-                switch (multiplier)
-                {
-                case TYPE_MUL_NO_EFFECT:
-                    flags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                    flags &= ~MOVE_RESULT_NOT_VERY_EFFECTIVE;
+        switch (multipliers[i])
+        {
+        case TYPE_MUL_NO_EFFECT:
+            flags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
+            flags &= ~MOVE_RESULT_NOT_VERY_EFFECTIVE;
+            flags &= ~MOVE_RESULT_SUPER_EFFECTIVE;
+            break;
+        case TYPE_MUL_NOT_EFFECTIVE:
+            if (!(flags & MOVE_RESULT_NO_EFFECT))
+            {
+                if (flags & MOVE_RESULT_SUPER_EFFECTIVE)
                     flags &= ~MOVE_RESULT_SUPER_EFFECTIVE;
-                    break;
-                case TYPE_MUL_NOT_EFFECTIVE:
-                    if (!(flags & MOVE_RESULT_NO_EFFECT))
-                    {
-                        if (flags & MOVE_RESULT_SUPER_EFFECTIVE)
-                            flags &= ~MOVE_RESULT_SUPER_EFFECTIVE;
-                        else
-                            flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                    }
-                    break;
-                case TYPE_MUL_SUPER_EFFECTIVE:
-                    if (!(flags & MOVE_RESULT_NO_EFFECT))
-                    {
-                        if (flags & MOVE_RESULT_NOT_VERY_EFFECTIVE)
-                            flags &= ~MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                        else
-                            flags |= MOVE_RESULT_SUPER_EFFECTIVE;
-                    }
-                    break;
-                }
-            }
-            i += 3;
-        }
-    }
-    else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-    {
-        while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE) {
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT) {
-                i += 3;
-                continue;
+                else
+                    flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
             }
-            else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType) {
-                // check type1
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == type1)
-                    multiplier = TYPE_EFFECT_MULTIPLIER_OLD(i);
-                else if (TYPE_EFFECT_DEF_TYPE_OLD(i) == type2 && type1 != type2)
-                    multiplier = TYPE_EFFECT_MULTIPLIER_OLD(i);
-                else {
-                    i += 3;
-                    continue;
-                }
-                switch (multiplier)
-                {
-                case TYPE_MUL_NO_EFFECT:
-                    flags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
+            break;
+        case TYPE_MUL_SUPER_EFFECTIVE:
+            if (!(flags & MOVE_RESULT_NO_EFFECT))
+            {
+                if (flags & MOVE_RESULT_NOT_VERY_EFFECTIVE)
                     flags &= ~MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                    flags &= ~MOVE_RESULT_SUPER_EFFECTIVE;
-                    break;
-                case TYPE_MUL_NOT_EFFECTIVE:
-                    if (!(flags & MOVE_RESULT_NO_EFFECT))
-                    {
-                        if (flags & MOVE_RESULT_SUPER_EFFECTIVE)
-                            flags &= ~MOVE_RESULT_SUPER_EFFECTIVE;
-                        else
-                            flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                    }
-                    break;
-                case TYPE_MUL_SUPER_EFFECTIVE:
-                    if (!(flags & MOVE_RESULT_NO_EFFECT))
-                    {
-                        if (flags & MOVE_RESULT_NOT_VERY_EFFECTIVE)
-                            flags &= ~MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                        else
-                            flags |= MOVE_RESULT_SUPER_EFFECTIVE;
-                    }
-                    break;
-                }
+                else
+                    flags |= MOVE_RESULT_SUPER_EFFECTIVE;
             }
-            i += 3;
+            break;
         }
     }
     return flags;
@@ -1604,8 +1541,10 @@ u8 getHiddenPowerType2(void)
 
 static void Cmd_typecalc(void)
 {
-    s32 i = 0;
+    s32 i;
     u8 moveType;
+    u8 multipliers[2];
+    u8 count;
 
     if (gCurrentMove == MOVE_STRUGGLE)
     {
@@ -1637,54 +1576,10 @@ static void Cmd_typecalc(void)
     }
     else
     {
-        if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-                {
-                    if (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT)
-                        break;
-                    i += 3;
-                    continue;
-                }
-                else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type1)
-                        ModulateDmgByType(TYPE_EFFECT_MULTIPLIER(i));
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2 &&
-                        gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2)
-                        ModulateDmgByType(TYPE_EFFECT_MULTIPLIER(i));
-                }
-                i += 3;
-            }
-        }
-        else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-                {
-                    if (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT)
-                        break;
-                    i += 3;
-                    continue;
-                }
-                else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type1)
-                        ModulateDmgByType(TYPE_EFFECT_MULTIPLIER_OLD(i));
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2 &&
-                        gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2)
-                        ModulateDmgByType(TYPE_EFFECT_MULTIPLIER_OLD(i));
-                }
-                i += 3;
-            }
-        }
+        count = GetTypeEffectivenessMultipliers(moveType, gBattleMons[gBattlerTarget].type1, gBattleMons[gBattlerTarget].type2,
+                                                (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT) != 0, multipliers);
+        for (i = 0; i < count; i++)
+            ModulateDmgByType(multipliers[i]);
     }
 
     if (gBattleMons[gBattlerTarget].ability == ABILITY_WONDER_GUARD && AttacksThisTurn(gBattlerAttacker, gCurrentMove) == 2
@@ -1707,8 +1602,10 @@ static void Cmd_typecalc(void)
 static void CheckWonderGuardAndLevitate(void)
 {
     u8 flags = 0;
-    s32 i = 0;
+    s32 i;
     u8 moveType;
+    u8 multipliers[2];
+    u8 count;
 
     if (gCurrentMove == MOVE_STRUGGLE || !gBattleMoves[gCurrentMove].power)
         return;
@@ -1722,99 +1619,24 @@ static void CheckWonderGuardAndLevitate(void)
         RecordAbilityBattle(gBattlerTarget, ABILITY_LEVITATE);
         return;
     }
-    if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
+    count = GetTypeEffectivenessMultipliers(moveType, gBattleMons[gBattlerTarget].type1, gBattleMons[gBattlerTarget].type2,
+                                            (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT) != 0, multipliers);
+    for (i = 0; i < count; i++)
     {
-        while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
+        // check no effect
+        if (multipliers[i] == TYPE_MUL_NO_EFFECT)
         {
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-            {
-                if (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT)
-                    break;
-                i += 3;
-                continue;
-            }
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType)
-            {
-                // check no effect
-                if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type1
-                    && TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NO_EFFECT)
-                {
-                    gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                    gProtectStructs[gBattlerAttacker].targetNotAffected = 1;
-                }
-                if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2 &&
-                    gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2 &&
-                    TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NO_EFFECT)
-                {
-                    gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                    gProtectStructs[gBattlerAttacker].targetNotAffected = 1;
-                }
-
-                // check super effective
-                if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type1 && TYPE_EFFECT_MULTIPLIER(i) == 20)
-                    flags |= 1;
-                if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2
-                && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                && TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_SUPER_EFFECTIVE)
-                    flags |= 1;
-
-                // check not very effective
-                if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type1 && TYPE_EFFECT_MULTIPLIER(i) == 5)
-                    flags |= 2;
-                if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2
-                && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                && TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NOT_EFFECTIVE)
-                    flags |= 2;
-            }
-            i += 3;
+            gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
+            gProtectStructs[gBattlerAttacker].targetNotAffected = 1;
         }
-    }
-    else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-    {
-        while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-        {
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-            {
-                if (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT)
-                    break;
-                i += 3;
-                continue;
-            }
-            if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType)
-            {
-                // check no effect
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type1
-                    && TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NO_EFFECT)
-                {
-                    gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                    gProtectStructs[gBattlerAttacker].targetNotAffected = 1;
-                }
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2 &&
-                    gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2 &&
-                    TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NO_EFFECT)
-                {
-                    gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                    gProtectStructs[gBattlerAttacker].targetNotAffected = 1;
-                }
 
-                // check super effective
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type1 && TYPE_EFFECT_MULTIPLIER_OLD(i) == 20)
-                    flags |= 1;
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2
-                && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                && TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_SUPER_EFFECTIVE)
-                    flags |= 1;
+        // check super effective
+        if (multipliers[i] == TYPE_MUL_SUPER_EFFECTIVE)
+            flags |= 1;
 
-                // check not very effective
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type1 && TYPE_EFFECT_MULTIPLIER_OLD(i) == 5)
-                    flags |= 2;
-                if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2
-                && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                && TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NOT_EFFECTIVE)
-                    flags |= 2;
-            }
-            i += 3;
-        }
+        // check not very effective
+        if (multipliers[i] == TYPE_MUL_NOT_EFFECTIVE)
+            flags |= 2;
     }
 
     if (gBattleMons[gBattlerTarget].ability == ABILITY_WONDER_GUARD && AttacksThisTurn(gBattlerAttacker, gCurrentMove) == 2)
@@ -1865,9 +1687,11 @@ static void ModulateDmgByType2(u8 multiplier, u16 move, u8 *flags)
 
 u8 TypeCalc(u16 move, u8 attacker, u8 defender)
 {
-    s32 i = 0;
+    s32 i;
     u8 flags = 0;
     u8 moveType;
+    u8 multipliers[2];
+    u8 count;
 
     if (move == MOVE_STRUGGLE)
         return 0;
@@ -1887,56 +1711,10 @@ u8 TypeCalc(u16 move, u8 attacker, u8 defender)
     }
     else
     {
-        if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-                {
-                    if (gBattleMons[defender].status2 & STATUS2_FORESIGHT)
-                        break;
-                    i += 3;
-                    continue;
-                }
-
-                else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[defender].type1)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER(i), move, &flags);
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[defender].type2 &&
-                        gBattleMons[defender].type1 != gBattleMons[defender].type2)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER(i), move, &flags);
-                }
-                i += 3;
-            }
-        }
-        else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-                {
-                    if (gBattleMons[defender].status2 & STATUS2_FORESIGHT)
-                        break;
-                    i += 3;
-                    continue;
-                }
-
-                else if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[defender].type1)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER_OLD(i), move, &flags);
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[defender].type2 &&
-                        gBattleMons[defender].type1 != gBattleMons[defender].type2)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER_OLD(i), move, &flags);
-                }
-                i += 3;
-            }
-        }
+        count = GetTypeEffectivenessMultipliers(moveType, gBattleMons[defender].type1, gBattleMons[defender].type2,
+                                                (gBattleMons[defender].status2 & STATUS2_FORESIGHT) != 0, multipliers);
+        for (i = 0; i < count; i++)
+            ModulateDmgByType2(multipliers[i], move, &flags);
     }
 
     if (gBattleMons[defender].ability == ABILITY_WONDER_GUARD && !(flags & MOVE_RESULT_MISSED)
@@ -1951,10 +1729,12 @@ u8 TypeCalc(u16 move, u8 attacker, u8 defender)
 
 u8 AI_TypeCalc(u16 move, u16 targetSpecies, u8 targetAbility)
 {
-    s32 i = 0;
+    s32 i;
     u8 flags = 0;
     u8 type1 = GetTypeBySpecies(targetSpecies, 1), type2 = GetTypeBySpecies(targetSpecies, 2);
     u8 moveType;
+    u8 multipliers[2];
+    u8 count;
 
     if (move == MOVE_STRUGGLE)
         return 0;
@@ -1971,48 +1751,9 @@ u8 AI_TypeCalc(u16 move, u16 targetSpecies, u8 targetAbility)
     }
     else
     {
-        if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-                {
-                    i += 3;
-                    continue;
-                }
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE(i) == type1)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER(i), move, &flags);
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE(i) == type2 && type1 != type2)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER(i), move, &flags);
-                }
-                i += 3;
-            }
-        }
-        else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-                {
-                    i += 3;
-                    continue;
-                }
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == type1)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER_OLD(i), move, &flags);
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == type2 && type1 != type2)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER_OLD(i), move, &flags);
-                }
-                i += 3;
-            }
-        }
+        count = GetTypeEffectivenessMultipliers(moveType, type1, type2, FALSE, multipliers);
+        for (i = 0; i < count; i++)
+            ModulateDmgByType2(multipliers[i], move, &flags);
     }
     if (targetAbility == ABILITY_WONDER_GUARD
      && (!(flags & MOVE_RESULT_SUPER_EFFECTIVE) || ((flags & (MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE)) == (MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE)))
@@ -2024,10 +1765,12 @@ u8 AI_TypeCalc(u16 move, u16 targetSpecies, u8 targetAbility)
 // used to properly display type effectiveness on battle menu ui without breaking existing functions of AI_TypeCalc
 u8 AI_TypeDisplay(u16 move, u16 targetSpecies, u8 targetAbility)
 {
-    s32 i = 0;
+    s32 i;
     u8 flags = 0;
     u8 type1 = GetTypeBySpecies(targetSpecies, 1), type2 = GetTypeBySpecies(targetSpecies, 2);
     u8 moveType;
+    u8 multipliers[2];
+    u8 count;
 
     if (move == MOVE_STRUGGLE)
         return 0;
@@ -2044,48 +1787,9 @@ u8 AI_TypeDisplay(u16 move, u16 targetSpecies, u8 targetAbility)
     }
     else
     {
-        if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-                {
-                    i += 3;
-                    continue;
-                }
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE(i) == type1)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER(i), move, &flags);
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE(i) == type2 && type1 != type2)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER(i), move, &flags);
-                }
-                i += 3;
-            }
-        }
-        else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-                {
-                    i += 3;
-                    continue;
-                }
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == type1)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER_OLD(i), move, &flags);
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == type2 && type1 != type2)
-                        ModulateDmgByType2(TYPE_EFFECT_MULTIPLIER_OLD(i), move, &flags);
-                }
-                i += 3;
-            }
-        }
+        count = GetTypeEffectivenessMultipliers(moveType, type1, type2, FALSE, multipliers);
+        for (i = 0; i < count; i++)
+            ModulateDmgByType2(multipliers[i], move, &flags);
     }
     if (targetAbility == ABILITY_WONDER_GUARD
      && (!(flags & MOVE_RESULT_SUPER_EFFECTIVE) || ((flags & (MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE)) == (MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE)))
@@ -5199,8 +4903,10 @@ static void Cmd_moveend(void)
 static void Cmd_typecalc2(void)
 {
     u8 flags = 0;
-    s32 i = 0;
+    s32 i;
     u8 moveType = CheckAbilityChangeMoveType(gCurrentMove);
+    u8 multipliers[2];
+    u8 count;
 
     if (gBattleMons[gBattlerTarget].ability == ABILITY_LEVITATE && moveType == TYPE_GROUND)
     {
@@ -5212,129 +4918,19 @@ static void Cmd_typecalc2(void)
     }
     else
     {
-        if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 1) //Modern type effectiveness
+        count = GetTypeEffectivenessMultipliers(moveType, gBattleMons[gBattlerTarget].type1, gBattleMons[gBattlerTarget].type2,
+                                                (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT) != 0, multipliers);
+        for (i = 0; i < count; i++)
         {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) != TYPE_ENDTABLE)
+            if (multipliers[i] == TYPE_MUL_NO_EFFECT)
             {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == TYPE_FORESIGHT)
-                {
-                    if (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT)
-                    {
-                        break;
-                    }
-                    else
-                    {
-                        i += 3;
-                        continue;
-                    }
-                }
-
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type1)
-                    {
-                        if (TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NO_EFFECT)
-                        {
-                            gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                            break;
-                        }
-                        if (TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NOT_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                        }
-                        if (TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_SUPER_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_SUPER_EFFECTIVE;
-                        }
-                    }
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2)
-                    {
-                        if (gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                            && TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NO_EFFECT)
-                        {
-                            gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                            break;
-                        }
-                        if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2
-                            && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                            && TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_NOT_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                        }
-                        if (TYPE_EFFECT_DEF_TYPE(i) == gBattleMons[gBattlerTarget].type2
-                            && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                            && TYPE_EFFECT_MULTIPLIER(i) == TYPE_MUL_SUPER_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_SUPER_EFFECTIVE;
-                        }
-                    }
-                }
-                i += 3;
-            }
-        }
-        else if (gSaveBlock1Ptr->tx_Mode_TypeEffectiveness == 0) //Old type effectiveness
-        {
-            while (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) != TYPE_ENDTABLE)
-            {
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == TYPE_FORESIGHT)
-                {
-                    if (gBattleMons[gBattlerTarget].status2 & STATUS2_FORESIGHT)
-                    {
-                        break;
-                    }
-                    else
-                    {
-                        i += 3;
-                        continue;
-                    }
-                }
-
-                if (GetTypeEffectivenessRandom(TYPE_EFFECT_ATK_TYPE_OLD(i)) == moveType)
-                {
-                    // check type1
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type1)
-                    {
-                        if (TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NO_EFFECT)
-                        {
-                            gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                            break;
-                        }
-                        if (TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NOT_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                        }
-                        if (TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_SUPER_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_SUPER_EFFECTIVE;
-                        }
-                    }
-                    // check type2
-                    if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2)
-                    {
-                        if (gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                            && TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NO_EFFECT)
-                        {
-                            gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
-                            break;
-                        }
-                        if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2
-                            && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                            && TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_NOT_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
-                        }
-                        if (TYPE_EFFECT_DEF_TYPE_OLD(i) == gBattleMons[gBattlerTarget].type2
-                            && gBattleMons[gBattlerTarget].type1 != gBattleMons[gBattlerTarget].type2
-                            && TYPE_EFFECT_MULTIPLIER_OLD(i) == TYPE_MUL_SUPER_EFFECTIVE)
-                        {
-                            flags |= MOVE_RESULT_SUPER_EFFECTIVE;
-                        }
-                    }
-                }
-                i += 3;
+                gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
+                break;
             }
+            if (multipliers[i] == TYPE_MUL_NOT_EFFECTIVE)
+                flags |= MOVE_RESULT_NOT_VERY_EFFECTIVE;
+            if (multipliers[i] == TYPE_MUL_SUPER_EFFECTIVE)
+                flags |= MOVE_RESULT_SUPER_EFFECTIVE;
         }
     }
 
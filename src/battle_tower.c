@@ -1757,7 +1757,7 @@ void FillFrontierTrainersParties(u8 monsCount)
     FillTrainerParty(gTrainerBattleOpponent_B, 3, monsCount);
 }
 
-static void FillTentTrainerParty(u8 monsCount)
+void FillTentTrainerParty(u8 monsCount)
 {
     ZeroEnemyPartyMons();
     FillTentTrainerParty_(gTrainerBattleOpponent_A, 0, monsCount);
@@ -1766,7 +1766,6 @@ static void FillTentTrainerParty(u8 monsCount)
 static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
-    u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
     u8 friendship = MAX_FRIENDSHIP;
     u8 level = SetFacilityPtrsGetLevel();
     u8 lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
@@ -1774,6 +1773,7 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
     u8 bfMonCount;
     const u16 *monSet = NULL;
     u32 otID = 0;
+    struct FrontierMonPool pool;
 
     if (trainerId < FRONTIER_TRAINERS_COUNT)
     {
@@ -1814,52 +1814,28 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
     }
 
     // Regular battle frontier trainer.
-    // Attempt to fill the trainer's party with random Pokémon until 3 have been
-    // successfully chosen. The trainer's party may not have duplicate Pokémon species
-    // or duplicate held items.
+    // Fill the trainer's party with random Pokémon from its set. The trainer's party
+    // may not have duplicate Pokémon species or duplicate held items, and that includes
+    // the partner's Pokémon already in the enemy party.
     for (bfMonCount = 0; monSet[bfMonCount] != 0xFFFF; bfMonCount++)
         ;
-    i = 0;
-    otID = Random32();
-    while (i != monCount)
+    InitFrontierMonPool(&pool);
+    for (j = 0; j < bfMonCount; j++)
     {
-        u16 monId = monSet[Random() % bfMonCount];
-
         // "High tier" Pokémon are only allowed on open level mode
         // 20 is not a possible value for level here
-        if (lvlMode == FRONTIER_LVL_OPEN && monId > FRONTIER_MONS_HIGH_TIER)
-            continue;
-
-        // Ensure this Pokémon species isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL) == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this Pokemon's held item isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) != ITEM_NONE
-             && GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this exact Pokémon index isn't a duplicate. This check doesn't seem necessary
-        // because the species and held items were already checked directly above.
-        for (j = 0; j < i; j++)
-        {
-            if (chosenMonIndices[j] == monId)
-                break;
-        }
-        if (j != i)
+        if (lvlMode == FRONTIER_LVL_OPEN && monSet[j] > FRONTIER_MONS_HIGH_TIER)
             continue;
+        AddFrontierMonToPool(&pool, monSet[j]);
+    }
+    ClearFrontierPartyExclusions();
+    for (j = 0; j < firstMonId; j++)
+        ExcludeFrontierPartySpeciesAndItem(GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL), GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL));
 
-        chosenMonIndices[i] = monId;
+    otID = Random32();
+    for (i = 0; i < monCount; i++)
+    {
+        u16 monId = DrawFrontierMonFromPool(&pool);
 
         // Place the chosen Pokémon into the trainer's party.
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
@@ -1887,10 +1863,6 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
 
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_FRIENDSHIP, &friendship);
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
-
-        // The Pokémon was successfully added to the trainer's party, so it's safe to move on to
-        // the next party slot.
-        i++;
     }
 }
 
@@ -3584,63 +3556,29 @@ static void SetNextBattleTentOpponent(void)
 static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
-    u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
     u8 friendship;
     u8 level = SetTentPtrsGetLevel();
     u8 fixedIV = 0;
     u8 bfMonCount;
     const u16 *monSet = NULL;
     u32 otID = 0;
-    u16 monId;
+    struct FrontierMonPool pool;
 
     monSet = gFacilityTrainers[gTrainerBattleOpponent_A].monSet;
 
-    bfMonCount = 0;
-    monId = monSet[bfMonCount];
-    while (monId != 0xFFFF)
-    {
-        bfMonCount++;
-        monId = monSet[bfMonCount];
-        if (monId == 0xFFFF)
-            break;
-    }
+    for (bfMonCount = 0; monSet[bfMonCount] != 0xFFFF; bfMonCount++)
+        ;
+    InitFrontierMonPool(&pool);
+    for (j = 0; j < bfMonCount; j++)
+        AddFrontierMonToPool(&pool, monSet[j]);
+    ClearFrontierPartyExclusions();
+    for (j = 0; j < firstMonId; j++)
+        ExcludeFrontierPartySpeciesAndItem(GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL), GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL));
 
-    i = 0;
     otID = Random32();
-    while (i != monCount)
+    for (i = 0; i < monCount; i++)
     {
-        u16 monId = monSet[Random() % bfMonCount];
-
-        // Ensure this Pokémon species isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL) == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this Pokemon's held item isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) != ITEM_NONE
-             && GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this exact Pokémon index isn't a duplicate. This check doesn't seem necessary
-        // because the species and held items were already checked directly above.
-        for (j = 0; j < i; j++)
-        {
-            if (chosenMonIndices[j] == monId)
-                break;
-        }
-        if (j != i)
-            continue;
-
-        chosenMonIndices[i] = monId;
+        u16 monId = DrawFrontierMonFromPool(&pool);
 
         // Place the chosen Pokémon into the trainer's party.
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
@@ -3668,10 +3606,6 @@ static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
 
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_FRIENDSHIP, &friendship);
         SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
-
-        // The Pokémon was successfully added to the trainer's party, so it's safe to move on to
-        // the next party slot.
-        i++;
     }
 }
 
@@ -18,6 +18,14 @@ Init::
 	.if MODERN
 	mov r0, #255 @ RESET_ALL
 	svc #1 << 16
+	@ Copy the IWRAM_CODE functions out of ROM
+	ldr r0, =__iwram_code_lma
+	ldr r1, =__iwram_code_start
+	ldr r2, =__iwram_code_end
+	sub r2, r2, r1
+	lsr r2, r2, #2
+	orr r2, r2, #1 << 26 @ CPU_SET_32BIT
+	svc #0xB << 16 @ CpuSet
 	.endif @ MODERN
 	ldr r1, =AgbMain + 1
 	mov lr, pc
@@ -0,0 +1,464 @@
+    HOENN_TO_NATIONAL(TREECKO),
+    HOENN_TO_NATIONAL(GROVYLE),
+    HOENN_TO_NATIONAL(SCEPTILE),
+    HOENN_TO_NATIONAL(TORCHIC),
+    HOENN_TO_NATIONAL(COMBUSKEN),
+    HOENN_TO_NATIONAL(BLAZIKEN),
+    HOENN_TO_NATIONAL(MUDKIP),
+    HOENN_TO_NATIONAL(MARSHTOMP),
+    HOENN_TO_NATIONAL(SWAMPERT),
+    HOENN_TO_NATIONAL(POOCHYENA),
+    HOENN_TO_NATIONAL(MIGHTYENA),
+    HOENN_TO_NATIONAL(ZIGZAGOON),
+    HOENN_TO_NATIONAL(LINOONE),
+    HOENN_TO_NATIONAL(WURMPLE),
+    HOENN_TO_NATIONAL(SILCOON),
+    HOENN_TO_NATIONAL(BEAUTIFLY),
+    HOENN_TO_NATIONAL(CASCOON),
+    HOENN_TO_NATIONAL(DUSTOX),
+    HOENN_TO_NATIONAL(LOTAD),
+    HOENN_TO_NATIONAL(LOMBRE),
+    HOENN_TO_NATIONAL(LUDICOLO),
+    HOENN_TO_NATIONAL(SEEDOT),
+    HOENN_TO_NATIONAL(NUZLEAF),
+    HOENN_TO_NATIONAL(SHIFTRY),
+    HOENN_TO_NATIONAL(TAILLOW),
+    HOENN_TO_NATIONAL(SWELLOW),
+    HOENN_TO_NATIONAL(WINGULL),
+    HOENN_TO_NATIONAL(PELIPPER),
+    HOENN_TO_NATIONAL(RALTS),
+    HOENN_TO_NATIONAL(KIRLIA),
+    HOENN_TO_NATIONAL(GARDEVOIR),
+    HOENN_TO_NATIONAL(GALLADE),
+    HOENN_TO_NATIONAL(SURSKIT),
+    HOENN_TO_NATIONAL(MASQUERAIN),
+    HOENN_TO_NATIONAL(SHROOMISH),
+    HOENN_TO_NATIONAL(BRELOOM),
+    HOENN_TO_NATIONAL(SLAKOTH),
+    HOENN_TO_NATIONAL(VIGOROTH),
+    HOENN_TO_NATIONAL(SLAKING),
+    HOENN_TO_NATIONAL(ABRA),
+    HOENN_TO_NATIONAL(KADABRA),
+    HOENN_TO_NATIONAL(ALAKAZAM),
+    HOENN_TO_NATIONAL(NINCADA),
+    HOENN_TO_NATIONAL(NINJASK),
+    HOENN_TO_NATIONAL(SHEDINJA),
+    HOENN_TO_NATIONAL(WHISMUR),
+    HOENN_TO_NATIONAL(LOUDRED),
+    HOENN_TO_NATIONAL(EXPLOUD),
+    HOENN_TO_NATIONAL(MAKUHITA),
+    HOENN_TO_NATIONAL(HARIYAMA),
+    HOENN_TO_NATIONAL(GOLDEEN),
+    HOENN_TO_NATIONAL(SEAKING),
+    HOENN_TO_NATIONAL(MAGIKARP),
+    HOENN_TO_NATIONAL(GYARADOS),
+    HOENN_TO_NATIONAL(AZURILL),
+    HOENN_TO_NATIONAL(MARILL),
+    HOENN_TO_NATIONAL(AZUMARILL),
+    HOENN_TO_NATIONAL(GEODUDE),
+    HOENN_TO_NATIONAL(GRAVELER),
+    HOENN_TO_NATIONAL(GOLEM),
+    HOENN_TO_NATIONAL(NOSEPASS),
+    HOENN_TO_NATIONAL(PROBOPASS),
+    HOENN_TO_NATIONAL(SKITTY),
+    HOENN_TO_NATIONAL(DELCATTY),
+    HOENN_TO_NATIONAL(ZUBAT),
+    HOENN_TO_NATIONAL(GOLBAT),
+    HOENN_TO_NATIONAL(CROBAT),
+    HOENN_TO_NATIONAL(TENTACOOL),
+    HOENN_TO_NATIONAL(TENTACRUEL),
+    HOENN_TO_NATIONAL(SABLEYE),
+    HOENN_TO_NATIONAL(MAWILE),
+    HOENN_TO_NATIONAL(ARON),
+    HOENN_TO_NATIONAL(LAIRON),
+    HOENN_TO_NATIONAL(AGGRON),
+    HOENN_TO_NATIONAL(MACHOP),
+    HOENN_TO_NATIONAL(MACHOKE),
+    HOENN_TO_NATIONAL(MACHAMP),
+    HOENN_TO_NATIONAL(MEDITITE),
+    HOENN_TO_NATIONAL(MEDICHAM),
+    HOENN_TO_NATIONAL(ELECTRIKE),
+    HOENN_TO_NATIONAL(MANECTRIC),
+    HOENN_TO_NATIONAL(PLUSLE),
+    HOENN_TO_NATIONAL(MINUN),
+    HOENN_TO_NATIONAL(MAGNEMITE),
+    HOENN_TO_NATIONAL(MAGNETON),
+    HOENN_TO_NATIONAL(MAGNEZONE),
+    HOENN_TO_NATIONAL(VOLTORB),
+    HOENN_TO_NATIONAL(ELECTRODE),
+    HOENN_TO_NATIONAL(VOLBEAT),
+    HOENN_TO_NATIONAL(ILLUMISE),
+    HOENN_TO_NATIONAL(ODDISH),
+    HOENN_TO_NATIONAL(GLOOM),
+    HOENN_TO_NATIONAL(VILEPLUME),
+    HOENN_TO_NATIONAL(BELLOSSOM),
+    HOENN_TO_NATIONAL(DODUO),
+    HOENN_TO_NATIONAL(DODRIO),
+    HOENN_TO_NATIONAL(BUDEW),
+    HOENN_TO_NATIONAL(ROSELIA),
+    HOENN_TO_NATIONAL(ROSERADE),
+
+    HOENN_TO_NATIONAL(GULPIN),
+    HOENN_TO_NATIONAL(SWALOT),
+    HOENN_TO_NATIONAL(CARVANHA),
+    HOENN_TO_NATIONAL(SHARPEDO),
+    HOENN_TO_NATIONAL(WAILMER),
+    HOENN_TO_NATIONAL(WAILORD),
+    HOENN_TO_NATIONAL(NUMEL),
+    HOENN_TO_NATIONAL(CAMERUPT),
+    HOENN_TO_NATIONAL(SLUGMA),
+    HOENN_TO_NATIONAL(MAGCARGO),
+    HOENN_TO_NATIONAL(TORKOAL),
+    HOENN_TO_NATIONAL(GRIMER),
+    HOENN_TO_NATIONAL(MUK),
+    HOENN_TO_NATIONAL(KOFFING),
+    HOENN_TO_NATIONAL(WEEZING),
+    HOENN_TO_NATIONAL(SPOINK),
+    HOENN_TO_NATIONAL(GRUMPIG),
+    HOENN_TO_NATIONAL(SANDSHREW),
+    HOENN_TO_NATIONAL(SANDSLASH),
+    HOENN_TO_NATIONAL(SPINDA),
+    HOENN_TO_NATIONAL(SKARMORY),
+    HOENN_TO_NATIONAL(TRAPINCH),
+    HOENN_TO_NATIONAL(VIBRAVA),
+    HOENN_TO_NATIONAL(FLYGON),
+    HOENN_TO_NATIONAL(CACNEA),
+    HOENN_TO_NATIONAL(CACTURNE),
+    HOENN_TO_NATIONAL(SWABLU),
+    HOENN_TO_NATIONAL(ALTARIA),
+    HOENN_TO_NATIONAL(ZANGOOSE),
+    HOENN_TO_NATIONAL(SEVIPER),
+    HOENN_TO_NATIONAL(LUNATONE),
+    HOENN_TO_NATIONAL(SOLROCK),
+    HOENN_TO_NATIONAL(BARBOACH),
+    HOENN_TO_NATIONAL(WHISCASH),
+    HOENN_TO_NATIONAL(CORPHISH),
+    HOENN_TO_NATIONAL(CRAWDAUNT),
+    HOENN_TO_NATIONAL(BALTOY),
+    HOENN_TO_NATIONAL(CLAYDOL),
+    HOENN_TO_NATIONAL(LILEEP),
+    HOENN_TO_NATIONAL(CRADILY),
+    HOENN_TO_NATIONAL(ANORITH),
+    HOENN_TO_NATIONAL(ARMALDO),
+    HOENN_TO_NATIONAL(IGGLYBUFF),
+    HOENN_TO_NATIONAL(JIGGLYPUFF),
+    HOENN_TO_NATIONAL(WIGGLYTUFF),
+    HOENN_TO_NATIONAL(FEEBAS),
+    HOENN_TO_NATIONAL(MILOTIC),
+    HOENN_TO_NATIONAL(CASTFORM),
+    HOENN_TO_NATIONAL(STARYU),
+    HOENN_TO_NATIONAL(STARMIE),
+    HOENN_TO_NATIONAL(KECLEON),
+    HOENN_TO_NATIONAL(SHUPPET),
+    HOENN_TO_NATIONAL(BANETTE),
+    HOENN_TO_NATIONAL(DUSKULL),
+    HOENN_TO_NATIONAL(DUSCLOPS),
+    HOENN_TO_NATIONAL(DUSKNOIR),
+    HOENN_TO_NATIONAL(TROPIUS),
+    HOENN_TO_NATIONAL(CHINGLING),
+    HOENN_TO_NATIONAL(CHIMECHO),
+    HOENN_TO_NATIONAL(ABSOL),
+    HOENN_TO_NATIONAL(VULPIX),
+    HOENN_TO_NATIONAL(NINETALES),
+    HOENN_TO_NATIONAL(PICHU),
+    HOENN_TO_NATIONAL(PIKACHU),
+    HOENN_TO_NATIONAL(RAICHU),
+    HOENN_TO_NATIONAL(PSYDUCK),
+    HOENN_TO_NATIONAL(GOLDUCK),
+    HOENN_TO_NATIONAL(WYNAUT),
+    HOENN_TO_NATIONAL(WOBBUFFET),
+    HOENN_TO_NATIONAL(NATU),
+    HOENN_TO_NATIONAL(XATU),
+    HOENN_TO_NATIONAL(GIRAFARIG),
+    HOENN_TO_NATIONAL(PHANPY),
+    HOENN_TO_NATIONAL(DONPHAN),
+    HOENN_TO_NATIONAL(PINSIR),
+    HOENN_TO_NATIONAL(HERACROSS),
+    HOENN_TO_NATIONAL(RHYHORN),
+    HOENN_TO_NATIONAL(RHYDON),
+    HOENN_TO_NATIONAL(RHYPERIOR),
+    HOENN_TO_NATIONAL(SNORUNT),
+    HOENN_TO_NATIONAL(GLALIE),
+    HOENN_TO_NATIONAL(FROSLASS),
+    HOENN_TO_NATIONAL(SPHEAL),
+    HOENN_TO_NATIONAL(SEALEO),
+    HOENN_TO_NATIONAL(WALREIN),
+    HOENN_TO_NATIONAL(CLAMPERL),
+    HOENN_TO_NATIONAL(HUNTAIL),
+    HOENN_TO_NATIONAL(GOREBYSS),
+    HOENN_TO_NATIONAL(RELICANTH),
+    HOENN_TO_NATIONAL(CORSOLA),
+    HOENN_TO_NATIONAL(CHINCHOU),
+    HOENN_TO_NATIONAL(LANTURN),
+    HOENN_TO_NATIONAL(LUVDISC),
+    HOENN_TO_NATIONAL(HORSEA),
+    HOENN_TO_NATIONAL(SEADRA),
+    HOENN_TO_NATIONAL(KINGDRA),
+    HOENN_TO_NATIONAL(BAGON),
+    HOENN_TO_NATIONAL(SHELGON),
+    HOENN_TO_NATIONAL(SALAMENCE),
+    HOENN_TO_NATIONAL(BELDUM),
+    HOENN_TO_NATIONAL(METANG),
+    HOENN_TO_NATIONAL(METAGROSS),
+    HOENN_TO_NATIONAL(REGIROCK),
+    HOENN_TO_NATIONAL(REGICE),
+    HOENN_TO_NATIONAL(REGISTEEL),
+    HOENN_TO_NATIONAL(REGIDRAGO),
+    HOENN_TO_NATIONAL(REGIELEKI),
+    HOENN_TO_NATIONAL(REGIGIGAS),
+    HOENN_TO_NATIONAL(LATIAS),
+    HOENN_TO_NATIONAL(LATIOS),
+    HOENN_TO_NATIONAL(KYOGRE),
+    HOENN_TO_NATIONAL(GROUDON),
+    HOENN_TO_NATIONAL(RAYQUAZA),
+    HOENN_TO_NATIONAL(JIRACHI),
+    HOENN_TO_NATIONAL(DEOXYS),
+    HOENN_TO_NATIONAL(BULBASAUR), // Pokémon from here onwards are UNSEEN in the HoennDex.
+    HOENN_TO_NATIONAL(IVYSAUR),
+    HOENN_TO_NATIONAL(VENUSAUR),
+    HOENN_TO_NATIONAL(CHARMANDER),
+    HOENN_TO_NATIONAL(CHARMELEON),
+    HOENN_TO_NATIONAL(CHARIZARD),
+    HOENN_TO_NATIONAL(SQUIRTLE),
+    HOENN_TO_NATIONAL(WARTORTLE),
+    HOENN_TO_NATIONAL(BLASTOISE),
+    HOENN_TO_NATIONAL(CATERPIE),
+    HOENN_TO_NATIONAL(METAPOD),
+    HOENN_TO_NATIONAL(BUTTERFREE),
+    HOENN_TO_NATIONAL(WEEDLE),
+    HOENN_TO_NATIONAL(KAKUNA),
+    HOENN_TO_NATIONAL(BEEDRILL),
+    HOENN_TO_NATIONAL(PIDGEY),
+    HOENN_TO_NATIONAL(PIDGEOTTO),
+    HOENN_TO_NATIONAL(PIDGEOT),
+    HOENN_TO_NATIONAL(RATTATA),
+    HOENN_TO_NATIONAL(RATICATE),
+    HOENN_TO_NATIONAL(SPEAROW),
+    HOENN_TO_NATIONAL(FEAROW),
+    HOENN_TO_NATIONAL(EKANS),
+    HOENN_TO_NATIONAL(ARBOK),
+    HOENN_TO_NATIONAL(NIDORAN_F),
+    HOENN_TO_NATIONAL(NIDORINA),
+    HOENN_TO_NATIONAL(NIDOQUEEN),
+    HOENN_TO_NATIONAL(NIDORAN_M),
+    HOENN_TO_NATIONAL(NIDORINO),
+    HOENN_TO_NATIONAL(NIDOKING),
+    HOENN_TO_NATIONAL(CLEFAIRY),
+    HOENN_TO_NATIONAL(CLEFABLE),
+    HOENN_TO_NATIONAL(PARAS),
+    HOENN_TO_NATIONAL(PARASECT),
+    HOENN_TO_NATIONAL(VENONAT),
+    HOENN_TO_NATIONAL(VENOMOTH),
+    HOENN_TO_NATIONAL(DIGLETT),
+    HOENN_TO_NATIONAL(DUGTRIO),
+    HOENN_TO_NATIONAL(MEOWTH),
+    HOENN_TO_NATIONAL(PERSIAN),
+    HOENN_TO_NATIONAL(MANKEY),
+    HOENN_TO_NATIONAL(PRIMEAPE),
+    HOENN_TO_NATIONAL(GROWLITHE),
+    HOENN_TO_NATIONAL(ARCANINE),
+    HOENN_TO_NATIONAL(POLIWAG),
+    HOENN_TO_NATIONAL(POLIWHIRL),
+    HOENN_TO_NATIONAL(POLIWRATH),
+    HOENN_TO_NATIONAL(BELLSPROUT),
+    HOENN_TO_NATIONAL(WEEPINBELL),
+    HOENN_TO_NATIONAL(VICTREEBEL),
+    HOENN_TO_NATIONAL(PONYTA),
+    HOENN_TO_NATIONAL(RAPIDASH),
+    HOENN_TO_NATIONAL(SLOWPOKE),
+    HOENN_TO_NATIONAL(SLOWBRO),
+    HOENN_TO_NATIONAL(FARFETCHD),
+    HOENN_TO_NATIONAL(SEEL),
+    HOENN_TO_NATIONAL(DEWGONG),
+    HOENN_TO_NATIONAL(SHELLDER),
+    HOENN_TO_NATIONAL(CLOYSTER),
+    HOENN_TO_NATIONAL(GASTLY),
+    HOENN_TO_NATIONAL(HAUNTER),
+    HOENN_TO_NATIONAL(GENGAR),
+    HOENN_TO_NATIONAL(ONIX),
+    HOENN_TO_NATIONAL(DROWZEE),
+    HOENN_TO_NATIONAL(HYPNO),
+    HOENN_TO_NATIONAL(KRABBY),
+    HOENN_TO_NATIONAL(KINGLER),
+    HOENN_TO_NATIONAL(EXEGGCUTE),
+    HOENN_TO_NATIONAL(EXEGGUTOR),
+    HOENN_TO_NATIONAL(CUBONE),
+    HOENN_TO_NATIONAL(MAROWAK),
+    HOENN_TO_NATIONAL(HITMONLEE),
+    HOENN_TO_NATIONAL(HITMONCHAN),
+    HOENN_TO_NATIONAL(LICKITUNG), 
+    HOENN_TO_NATIONAL(CHANSEY),
+    HOENN_TO_NATIONAL(TANGELA),
+    HOENN_TO_NATIONAL(KANGASKHAN),
+    HOENN_TO_NATIONAL(MR_MIME),
+    HOENN_TO_NATIONAL(SCYTHER),
+    HOENN_TO_NATIONAL(JYNX),
+    HOENN_TO_NATIONAL(ELECTABUZZ),
+    HOENN_TO_NATIONAL(MAGMAR),
+    HOENN_TO_NATIONAL(TAUROS),
+    HOENN_TO_NATIONAL(LAPRAS),
+    HOENN_TO_NATIONAL(DITTO),
+    HOENN_TO_NATIONAL(EEVEE),
+    HOENN_TO_NATIONAL(VAPOREON),
+    HOENN_TO_NATIONAL(JOLTEON),
+    HOENN_TO_NATIONAL(FLAREON),
+    HOENN_TO_NATIONAL(PORYGON),
+    HOENN_TO_NATIONAL(OMANYTE),
+    HOENN_TO_NATIONAL(OMASTAR),
+    HOENN_TO_NATIONAL(KABUTO),
+    HOENN_TO_NATIONAL(KABUTOPS),
+    HOENN_TO_NATIONAL(AERODACTYL),
+    HOENN_TO_NATIONAL(SNORLAX),
+    HOENN_TO_NATIONAL(ARTICUNO),
+    HOENN_TO_NATIONAL(ZAPDOS),
+    HOENN_TO_NATIONAL(MOLTRES),
+    HOENN_TO_NATIONAL(DRATINI),
+    HOENN_TO_NATIONAL(DRAGONAIR),
+    HOENN_TO_NATIONAL(DRAGONITE),
+    HOENN_TO_NATIONAL(MEWTWO),
+    HOENN_TO_NATIONAL(MEW),
+    HOENN_TO_NATIONAL(CHIKORITA),
+    HOENN_TO_NATIONAL(BAYLEEF),
+    HOENN_TO_NATIONAL(MEGANIUM),
+    HOENN_TO_NATIONAL(CYNDAQUIL),
+    HOENN_TO_NATIONAL(QUILAVA),
+    HOENN_TO_NATIONAL(TYPHLOSION),
+    HOENN_TO_NATIONAL(TOTODILE),
+    HOENN_TO_NATIONAL(CROCONAW),
+    HOENN_TO_NATIONAL(FERALIGATR),
+    HOENN_TO_NATIONAL(SENTRET),
+    HOENN_TO_NATIONAL(FURRET),
+    HOENN_TO_NATIONAL(HOOTHOOT),
+    HOENN_TO_NATIONAL(NOCTOWL),
+    HOENN_TO_NATIONAL(LEDYBA),
+    HOENN_TO_NATIONAL(LEDIAN),
+    HOENN_TO_NATIONAL(SPINARAK),
+    HOENN_TO_NATIONAL(ARIADOS),
+    HOENN_TO_NATIONAL(CLEFFA),
+    HOENN_TO_NATIONAL(TOGEPI),
+    HOENN_TO_NATIONAL(TOGETIC),
+    HOENN_TO_NATIONAL(MAREEP),
+    HOENN_TO_NATIONAL(FLAAFFY),
+    HOENN_TO_NATIONAL(AMPHAROS),
+    HOENN_TO_NATIONAL(SUDOWOODO),
+    HOENN_TO_NATIONAL(POLITOED),
+    HOENN_TO_NATIONAL(HOPPIP),
+    HOENN_TO_NATIONAL(SKIPLOOM),
+    HOENN_TO_NATIONAL(JUMPLUFF),
+    HOENN_TO_NATIONAL(AIPOM),
+    HOENN_TO_NATIONAL(SUNKERN),
+    HOENN_TO_NATIONAL(SUNFLORA),
+    HOENN_TO_NATIONAL(YANMA),
+    HOENN_TO_NATIONAL(WOOPER),
+    HOENN_TO_NATIONAL(QUAGSIRE),
+    HOENN_TO_NATIONAL(ESPEON),
+    HOENN_TO_NATIONAL(UMBREON),
+    HOENN_TO_NATIONAL(MURKROW),
+    HOENN_TO_NATIONAL(SLOWKING),
+    HOENN_TO_NATIONAL(MISDREAVUS),
+    HOENN_TO_NATIONAL(UNOWN),
+    HOENN_TO_NATIONAL(PINECO),
+    HOENN_TO_NATIONAL(FORRETRESS),
+    HOENN_TO_NATIONAL(DUNSPARCE),
+    HOENN_TO_NATIONAL(GLIGAR),
+    HOENN_TO_NATIONAL(STEELIX),
+    HOENN_TO_NATIONAL(SNUBBULL),
+    HOENN_TO_NATIONAL(GRANBULL),
+    HOENN_TO_NATIONAL(QWILFISH),
+    HOENN_TO_NATIONAL(SCIZOR),
+    HOENN_TO_NATIONAL(SHUCKLE),
+    HOENN_TO_NATIONAL(SNEASEL),
+    HOENN_TO_NATIONAL(TEDDIURSA),
+    HOENN_TO_NATIONAL(URSARING),
+    HOENN_TO_NATIONAL(SWINUB),
+    HOENN_TO_NATIONAL(PILOSWINE),
+    HOENN_TO_NATIONAL(REMORAID),
+    HOENN_TO_NATIONAL(OCTILLERY),
+    HOENN_TO_NATIONAL(DELIBIRD),
+    HOENN_TO_NATIONAL(MANTINE),
+    HOENN_TO_NATIONAL(HOUNDOUR),
+    HOENN_TO_NATIONAL(HOUNDOOM),
+    HOENN_TO_NATIONAL(PORYGON2),
+    HOENN_TO_NATIONAL(STANTLER),
+    HOENN_TO_NATIONAL(SMEARGLE),
+    HOENN_TO_NATIONAL(TYROGUE),
+    HOENN_TO_NATIONAL(HITMONTOP),
+    HOENN_TO_NATIONAL(SMOOCHUM),
+    HOENN_TO_NATIONAL(ELEKID),
+    HOENN_TO_NATIONAL(MAGBY),
+    HOENN_TO_NATIONAL(MILTANK),
+    HOENN_TO_NATIONAL(BLISSEY),
+    HOENN_TO_NATIONAL(RAIKOU),
+    HOENN_TO_NATIONAL(ENTEI),
+    HOENN_TO_NATIONAL(SUICUNE),
+    HOENN_TO_NATIONAL(LARVITAR),
+    HOENN_TO_NATIONAL(PUPITAR),
+    HOENN_TO_NATIONAL(TYRANITAR),
+    HOENN_TO_NATIONAL(LUGIA),
+    HOENN_TO_NATIONAL(HO_OH),
+    HOENN_TO_NATIONAL(CELEBI),
+    HOENN_TO_NATIONAL(OLD_UNOWN_B),
+    HOENN_TO_NATIONAL(OLD_UNOWN_C),
+    HOENN_TO_NATIONAL(OLD_UNOWN_D),
+    HOENN_TO_NATIONAL(OLD_UNOWN_E),
+    HOENN_TO_NATIONAL(OLD_UNOWN_F),
+    HOENN_TO_NATIONAL(OLD_UNOWN_G),
+    HOENN_TO_NATIONAL(OLD_UNOWN_H),
+    HOENN_TO_NATIONAL(OLD_UNOWN_I),
+    HOENN_TO_NATIONAL(OLD_UNOWN_J),
+    HOENN_TO_NATIONAL(OLD_UNOWN_K),
+    HOENN_TO_NATIONAL(OLD_UNOWN_L),
+    HOENN_TO_NATIONAL(OLD_UNOWN_M),
+    HOENN_TO_NATIONAL(OLD_UNOWN_N),
+    HOENN_TO_NATIONAL(OLD_UNOWN_O),
+    HOENN_TO_NATIONAL(OLD_UNOWN_P),
+    HOENN_TO_NATIONAL(OLD_UNOWN_Q),
+    HOENN_TO_NATIONAL(OLD_UNOWN_R),
+    HOENN_TO_NATIONAL(OLD_UNOWN_S),
+    HOENN_TO_NATIONAL(OLD_UNOWN_T),
+    HOENN_TO_NATIONAL(OLD_UNOWN_U),
+    HOENN_TO_NATIONAL(OLD_UNOWN_V),
+    HOENN_TO_NATIONAL(OLD_UNOWN_W),
+    HOENN_TO_NATIONAL(OLD_UNOWN_X),
+    HOENN_TO_NATIONAL(OLD_UNOWN_Y),
+    HOENN_TO_NATIONAL(OLD_UNOWN_Z),
+    HOENN_TO_NATIONAL(MIME_JR),
+    HOENN_TO_NATIONAL(MUNCHLAX),
+    HOENN_TO_NATIONAL(BONSLY),
+    HOENN_TO_NATIONAL(MANTYKE),   
+    HOENN_TO_NATIONAL(AMBIPOM),
+    HOENN_TO_NATIONAL(ELECTIVIRE),
+    HOENN_TO_NATIONAL(GLISCOR),
+    HOENN_TO_NATIONAL(HAPPINY),
+    HOENN_TO_NATIONAL(HONCHKROW),
+    HOENN_TO_NATIONAL(LICKILICKY),
+    HOENN_TO_NATIONAL(MAGMORTAR),
+    HOENN_TO_NATIONAL(MAMOSWINE),
+    HOENN_TO_NATIONAL(MISMAGIUS),
+    HOENN_TO_NATIONAL(PORYGON_Z),
+    HOENN_TO_NATIONAL(TANGROWTH),
+    HOENN_TO_NATIONAL(TOGEKISS),
+    HOENN_TO_NATIONAL(WEAVILE),
+    HOENN_TO_NATIONAL(YANMEGA),
+    HOENN_TO_NATIONAL(LEAFEON),
+    HOENN_TO_NATIONAL(GLACEON),
+    HOENN_TO_NATIONAL(SYLVEON),
+    HOENN_TO_NATIONAL(ARCEUS),
+    HOENN_TO_NATIONAL(ANNIHILAPE),
+    HOENN_TO_NATIONAL(FARIGIRAF),
+    HOENN_TO_NATIONAL(DUDUNSPARCE),
+    HOENN_TO_NATIONAL(WYRDEER),
+    HOENN_TO_NATIONAL(URSALUNA),
+    HOENN_TO_NATIONAL(URSALUNA_BLOODMOON),
+    HOENN_TO_NATIONAL(KLEAVOR),
+    //HOENN_TO_NATIONAL(URSALUNA_BLOODMOON),
+    //HOENN_TO_NATIONAL(KLEAVOR),
+    //HOENN_TO_NATIONAL(UNUSED_SPACE5),
+    //HOENN_TO_NATIONAL(UNUSED_SPACE6),
+    //HOENN_TO_NATIONAL(UNUSED_SPACE7),
+    //HOENN_TO_NATIONAL(UNUSED_SPACE8),
+    //HOENN_TO_NATIONAL(UNUSED_SPACE9),
+    //HOENN_TO_NATIONAL(UNUSED_SPACE10),
+    //HOENN_TO_NATIONAL(DEOXYS_ATTACK),
+    //HOENN_TO_NATIONAL(DEOXYS_DEFENSE),
+    //HOENN_TO_NATIONAL(DEOXYS_SPEED),
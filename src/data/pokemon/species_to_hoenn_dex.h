@@ -0,0 +1,463 @@
+    SPECIES_TO_HOENN(BULBASAUR),
+    SPECIES_TO_HOENN(IVYSAUR),
+    SPECIES_TO_HOENN(VENUSAUR),
+    SPECIES_TO_HOENN(CHARMANDER),
+    SPECIES_TO_HOENN(CHARMELEON),
+    SPECIES_TO_HOENN(CHARIZARD),
+    SPECIES_TO_HOENN(SQUIRTLE),
+    SPECIES_TO_HOENN(WARTORTLE),
+    SPECIES_TO_HOENN(BLASTOISE),
+    SPECIES_TO_HOENN(CATERPIE),
+    SPECIES_TO_HOENN(METAPOD),
+    SPECIES_TO_HOENN(BUTTERFREE),
+    SPECIES_TO_HOENN(WEEDLE),
+    SPECIES_TO_HOENN(KAKUNA),
+    SPECIES_TO_HOENN(BEEDRILL),
+    SPECIES_TO_HOENN(PIDGEY),
+    SPECIES_TO_HOENN(PIDGEOTTO),
+    SPECIES_TO_HOENN(PIDGEOT),
+    SPECIES_TO_HOENN(RATTATA),
+    SPECIES_TO_HOENN(RATICATE),
+    SPECIES_TO_HOENN(SPEAROW),
+    SPECIES_TO_HOENN(FEAROW),
+    SPECIES_TO_HOENN(EKANS),
+    SPECIES_TO_HOENN(ARBOK),
+    SPECIES_TO_HOENN(PIKACHU),
+    SPECIES_TO_HOENN(RAICHU),
+    SPECIES_TO_HOENN(SANDSHREW),
+    SPECIES_TO_HOENN(SANDSLASH),
+    SPECIES_TO_HOENN(NIDORAN_F),
+    SPECIES_TO_HOENN(NIDORINA),
+    SPECIES_TO_HOENN(NIDOQUEEN),
+    SPECIES_TO_HOENN(NIDORAN_M),
+    SPECIES_TO_HOENN(NIDORINO),
+    SPECIES_TO_HOENN(NIDOKING),
+    SPECIES_TO_HOENN(CLEFAIRY),
+    SPECIES_TO_HOENN(CLEFABLE),
+    SPECIES_TO_HOENN(VULPIX),
+    SPECIES_TO_HOENN(NINETALES),
+    SPECIES_TO_HOENN(JIGGLYPUFF),
+    SPECIES_TO_HOENN(WIGGLYTUFF),
+    SPECIES_TO_HOENN(ZUBAT),
+    SPECIES_TO_HOENN(GOLBAT),
+    SPECIES_TO_HOENN(ODDISH),
+    SPECIES_TO_HOENN(GLOOM),
+    SPECIES_TO_HOENN(VILEPLUME),
+    SPECIES_TO_HOENN(PARAS),
+    SPECIES_TO_HOENN(PARASECT),
+    SPECIES_TO_HOENN(VENONAT),
+    SPECIES_TO_HOENN(VENOMOTH),
+    SPECIES_TO_HOENN(DIGLETT),
+    SPECIES_TO_HOENN(DUGTRIO),
+    SPECIES_TO_HOENN(MEOWTH),
+    SPECIES_TO_HOENN(PERSIAN),
+    SPECIES_TO_HOENN(PSYDUCK),
+    SPECIES_TO_HOENN(GOLDUCK),
+    SPECIES_TO_HOENN(MANKEY),
+    SPECIES_TO_HOENN(PRIMEAPE),
+    SPECIES_TO_HOENN(GROWLITHE),
+    SPECIES_TO_HOENN(ARCANINE),
+    SPECIES_TO_HOENN(POLIWAG),
+    SPECIES_TO_HOENN(POLIWHIRL),
+    SPECIES_TO_HOENN(POLIWRATH),
+    SPECIES_TO_HOENN(ABRA),
+    SPECIES_TO_HOENN(KADABRA),
+    SPECIES_TO_HOENN(ALAKAZAM),
+    SPECIES_TO_HOENN(MACHOP),
+    SPECIES_TO_HOENN(MACHOKE),
+    SPECIES_TO_HOENN(MACHAMP),
+    SPECIES_TO_HOENN(BELLSPROUT),
+    SPECIES_TO_HOENN(WEEPINBELL),
+    SPECIES_TO_HOENN(VICTREEBEL),
+    SPECIES_TO_HOENN(TENTACOOL),
+    SPECIES_TO_HOENN(TENTACRUEL),
+    SPECIES_TO_HOENN(GEODUDE),
+    SPECIES_TO_HOENN(GRAVELER),
+    SPECIES_TO_HOENN(GOLEM),
+    SPECIES_TO_HOENN(PONYTA),
+    SPECIES_TO_HOENN(RAPIDASH),
+    SPECIES_TO_HOENN(SLOWPOKE),
+    SPECIES_TO_HOENN(SLOWBRO),
+    SPECIES_TO_HOENN(MAGNEMITE),
+    SPECIES_TO_HOENN(MAGNETON),
+    SPECIES_TO_HOENN(FARFETCHD),
+    SPECIES_TO_HOENN(DODUO),
+    SPECIES_TO_HOENN(DODRIO),
+    SPECIES_TO_HOENN(SEEL),
+    SPECIES_TO_HOENN(DEWGONG),
+    SPECIES_TO_HOENN(GRIMER),
+    SPECIES_TO_HOENN(MUK),
+    SPECIES_TO_HOENN(SHELLDER),
+    SPECIES_TO_HOENN(CLOYSTER),
+    SPECIES_TO_HOENN(GASTLY),
+    SPECIES_TO_HOENN(HAUNTER),
+    SPECIES_TO_HOENN(GENGAR),
+    SPECIES_TO_HOENN(ONIX),
+    SPECIES_TO_HOENN(DROWZEE),
+    SPECIES_TO_HOENN(HYPNO),
+    SPECIES_TO_HOENN(KRABBY),
+    SPECIES_TO_HOENN(KINGLER),
+    SPECIES_TO_HOENN(VOLTORB),
+    SPECIES_TO_HOENN(ELECTRODE),
+    SPECIES_TO_HOENN(EXEGGCUTE),
+    SPECIES_TO_HOENN(EXEGGUTOR),
+    SPECIES_TO_HOENN(CUBONE),
+    SPECIES_TO_HOENN(MAROWAK),
+    SPECIES_TO_HOENN(HITMONLEE),
+    SPECIES_TO_HOENN(HITMONCHAN),
+    SPECIES_TO_HOENN(LICKITUNG),
+    SPECIES_TO_HOENN(KOFFING),
+    SPECIES_TO_HOENN(WEEZING),
+    SPECIES_TO_HOENN(RHYHORN),
+    SPECIES_TO_HOENN(RHYDON),
+    SPECIES_TO_HOENN(CHANSEY),
+    SPECIES_TO_HOENN(TANGELA),
+    SPECIES_TO_HOENN(KANGASKHAN),
+    SPECIES_TO_HOENN(HORSEA),
+    SPECIES_TO_HOENN(SEADRA),
+    SPECIES_TO_HOENN(GOLDEEN),
+    SPECIES_TO_HOENN(SEAKING),
+    SPECIES_TO_HOENN(STARYU),
+    SPECIES_TO_HOENN(STARMIE),
+    SPECIES_TO_HOENN(MR_MIME),
+    SPECIES_TO_HOENN(SCYTHER),
+    SPECIES_TO_HOENN(JYNX),
+    SPECIES_TO_HOENN(ELECTABUZZ),
+    SPECIES_TO_HOENN(MAGMAR),
+    SPECIES_TO_HOENN(PINSIR),
+    SPECIES_TO_HOENN(TAUROS),
+    SPECIES_TO_HOENN(MAGIKARP),
+    SPECIES_TO_HOENN(GYARADOS),
+    SPECIES_TO_HOENN(LAPRAS),
+    SPECIES_TO_HOENN(DITTO),
+    SPECIES_TO_HOENN(EEVEE),
+    SPECIES_TO_HOENN(VAPOREON),
+    SPECIES_TO_HOENN(JOLTEON),
+    SPECIES_TO_HOENN(FLAREON),
+    SPECIES_TO_HOENN(PORYGON),
+    SPECIES_TO_HOENN(OMANYTE),
+    SPECIES_TO_HOENN(OMASTAR),
+    SPECIES_TO_HOENN(KABUTO),
+    SPECIES_TO_HOENN(KABUTOPS),
+    SPECIES_TO_HOENN(AERODACTYL),
+    SPECIES_TO_HOENN(SNORLAX),
+    SPECIES_TO_HOENN(ARTICUNO),
+    SPECIES_TO_HOENN(ZAPDOS),
+    SPECIES_TO_HOENN(MOLTRES),
+    SPECIES_TO_HOENN(DRATINI),
+    SPECIES_TO_HOENN(DRAGONAIR),
+    SPECIES_TO_HOENN(DRAGONITE),
+    SPECIES_TO_HOENN(MEWTWO),
+    SPECIES_TO_HOENN(MEW),
+    SPECIES_TO_HOENN(CHIKORITA),
+    SPECIES_TO_HOENN(BAYLEEF),
+    SPECIES_TO_HOENN(MEGANIUM),
+    SPECIES_TO_HOENN(CYNDAQUIL),
+    SPECIES_TO_HOENN(QUILAVA),
+    SPECIES_TO_HOENN(TYPHLOSION),
+    SPECIES_TO_HOENN(TOTODILE),
+    SPECIES_TO_HOENN(CROCONAW),
+    SPECIES_TO_HOENN(FERALIGATR),
+    SPECIES_TO_HOENN(SENTRET),
+    SPECIES_TO_HOENN(FURRET),
+    SPECIES_TO_HOENN(HOOTHOOT),
+    SPECIES_TO_HOENN(NOCTOWL),
+    SPECIES_TO_HOENN(LEDYBA),
+    SPECIES_TO_HOENN(LEDIAN),
+    SPECIES_TO_HOENN(SPINARAK),
+    SPECIES_TO_HOENN(ARIADOS),
+    SPECIES_TO_HOENN(CROBAT),
+    SPECIES_TO_HOENN(CHINCHOU),
+    SPECIES_TO_HOENN(LANTURN),
+    SPECIES_TO_HOENN(PICHU),
+    SPECIES_TO_HOENN(CLEFFA),
+    SPECIES_TO_HOENN(IGGLYBUFF),
+    SPECIES_TO_HOENN(TOGEPI),
+    SPECIES_TO_HOENN(TOGETIC),
+    SPECIES_TO_HOENN(NATU),
+    SPECIES_TO_HOENN(XATU),
+    SPECIES_TO_HOENN(MAREEP),
+    SPECIES_TO_HOENN(FLAAFFY),
+    SPECIES_TO_HOENN(AMPHAROS),
+    SPECIES_TO_HOENN(BELLOSSOM),
+    SPECIES_TO_HOENN(MARILL),
+    SPECIES_TO_HOENN(AZUMARILL),
+    SPECIES_TO_HOENN(SUDOWOODO),
+    SPECIES_TO_HOENN(POLITOED),
+    SPECIES_TO_HOENN(HOPPIP),
+    SPECIES_TO_HOENN(SKIPLOOM),
+    SPECIES_TO_HOENN(JUMPLUFF),
+    SPECIES_TO_HOENN(AIPOM),
+    SPECIES_TO_HOENN(SUNKERN),
+    SPECIES_TO_HOENN(SUNFLORA),
+    SPECIES_TO_HOENN(YANMA),
+    SPECIES_TO_HOENN(WOOPER),
+    SPECIES_TO_HOENN(QUAGSIRE),
+    SPECIES_TO_HOENN(ESPEON),
+    SPECIES_TO_HOENN(UMBREON),
+    SPECIES_TO_HOENN(MURKROW),
+    SPECIES_TO_HOENN(SLOWKING),
+    SPECIES_TO_HOENN(MISDREAVUS),
+    SPECIES_TO_HOENN(UNOWN),
+    SPECIES_TO_HOENN(WOBBUFFET),
+    SPECIES_TO_HOENN(GIRAFARIG),
+    SPECIES_TO_HOENN(PINECO),
+    SPECIES_TO_HOENN(FORRETRESS),
+    SPECIES_TO_HOENN(DUNSPARCE),
+    SPECIES_TO_HOENN(GLIGAR),
+    SPECIES_TO_HOENN(STEELIX),
+    SPECIES_TO_HOENN(SNUBBULL),
+    SPECIES_TO_HOENN(GRANBULL),
+    SPECIES_TO_HOENN(QWILFISH),
+    SPECIES_TO_HOENN(SCIZOR),
+    SPECIES_TO_HOENN(SHUCKLE),
+    SPECIES_TO_HOENN(HERACROSS),
+    SPECIES_TO_HOENN(SNEASEL),
+    SPECIES_TO_HOENN(TEDDIURSA),
+    SPECIES_TO_HOENN(URSARING),
+    SPECIES_TO_HOENN(SLUGMA),
+    SPECIES_TO_HOENN(MAGCARGO),
+    SPECIES_TO_HOENN(SWINUB),
+    SPECIES_TO_HOENN(PILOSWINE),
+    SPECIES_TO_HOENN(CORSOLA),
+    SPECIES_TO_HOENN(REMORAID),
+    SPECIES_TO_HOENN(OCTILLERY),
+    SPECIES_TO_HOENN(DELIBIRD),
+    SPECIES_TO_HOENN(MANTINE),
+    SPECIES_TO_HOENN(SKARMORY),
+    SPECIES_TO_HOENN(HOUNDOUR),
+    SPECIES_TO_HOENN(HOUNDOOM),
+    SPECIES_TO_HOENN(KINGDRA),
+    SPECIES_TO_HOENN(PHANPY),
+    SPECIES_TO_HOENN(DONPHAN),
+    SPECIES_TO_HOENN(PORYGON2),
+    SPECIES_TO_HOENN(STANTLER),
+    SPECIES_TO_HOENN(SMEARGLE),
+    SPECIES_TO_HOENN(TYROGUE),
+    SPECIES_TO_HOENN(HITMONTOP),
+    SPECIES_TO_HOENN(SMOOCHUM),
+    SPECIES_TO_HOENN(ELEKID),
+    SPECIES_TO_HOENN(MAGBY),
+    SPECIES_TO_HOENN(MILTANK),
+    SPECIES_TO_HOENN(BLISSEY),
+    SPECIES_TO_HOENN(RAIKOU),
+    SPECIES_TO_HOENN(ENTEI),
+    SPECIES_TO_HOENN(SUICUNE),
+    SPECIES_TO_HOENN(LARVITAR),
+    SPECIES_TO_HOENN(PUPITAR),
+    SPECIES_TO_HOENN(TYRANITAR),
+    SPECIES_TO_HOENN(LUGIA),
+    SPECIES_TO_HOENN(HO_OH),
+    SPECIES_TO_HOENN(CELEBI),
+    SPECIES_TO_HOENN(OLD_UNOWN_B),
+    SPECIES_TO_HOENN(OLD_UNOWN_C),
+    SPECIES_TO_HOENN(OLD_UNOWN_D),
+    SPECIES_TO_HOENN(OLD_UNOWN_E),
+    SPECIES_TO_HOENN(OLD_UNOWN_F),
+    SPECIES_TO_HOENN(OLD_UNOWN_G),
+    SPECIES_TO_HOENN(OLD_UNOWN_H),
+    SPECIES_TO_HOENN(OLD_UNOWN_I),
+    SPECIES_TO_HOENN(OLD_UNOWN_J),
+    SPECIES_TO_HOENN(OLD_UNOWN_K),
+    SPECIES_TO_HOENN(OLD_UNOWN_L),
+    SPECIES_TO_HOENN(OLD_UNOWN_M),
+    SPECIES_TO_HOENN(OLD_UNOWN_N),
+    SPECIES_TO_HOENN(OLD_UNOWN_O),
+    SPECIES_TO_HOENN(OLD_UNOWN_P),
+    SPECIES_TO_HOENN(OLD_UNOWN_Q),
+    SPECIES_TO_HOENN(OLD_UNOWN_R),
+    SPECIES_TO_HOENN(OLD_UNOWN_S),
+    SPECIES_TO_HOENN(OLD_UNOWN_T),
+    SPECIES_TO_HOENN(OLD_UNOWN_U),
+    SPECIES_TO_HOENN(OLD_UNOWN_V),
+    SPECIES_TO_HOENN(OLD_UNOWN_W),
+    SPECIES_TO_HOENN(OLD_UNOWN_X),
+    SPECIES_TO_HOENN(OLD_UNOWN_Y),
+    SPECIES_TO_HOENN(OLD_UNOWN_Z),
+    SPECIES_TO_HOENN(TREECKO),
+    SPECIES_TO_HOENN(GROVYLE),
+    SPECIES_TO_HOENN(SCEPTILE),
+    SPECIES_TO_HOENN(TORCHIC),
+    SPECIES_TO_HOENN(COMBUSKEN),
+    SPECIES_TO_HOENN(BLAZIKEN),
+    SPECIES_TO_HOENN(MUDKIP),
+    SPECIES_TO_HOENN(MARSHTOMP),
+    SPECIES_TO_HOENN(SWAMPERT),
+    SPECIES_TO_HOENN(POOCHYENA),
+    SPECIES_TO_HOENN(MIGHTYENA),
+    SPECIES_TO_HOENN(ZIGZAGOON),
+    SPECIES_TO_HOENN(LINOONE),
+    SPECIES_TO_HOENN(WURMPLE),
+    SPECIES_TO_HOENN(SILCOON),
+    SPECIES_TO_HOENN(BEAUTIFLY),
+    SPECIES_TO_HOENN(CASCOON),
+    SPECIES_TO_HOENN(DUSTOX),
+    SPECIES_TO_HOENN(LOTAD),
+    SPECIES_TO_HOENN(LOMBRE),
+    SPECIES_TO_HOENN(LUDICOLO),
+    SPECIES_TO_HOENN(SEEDOT),
+    SPECIES_TO_HOENN(NUZLEAF),
+    SPECIES_TO_HOENN(SHIFTRY),
+    SPECIES_TO_HOENN(NINCADA),
+    SPECIES_TO_HOENN(NINJASK),
+    SPECIES_TO_HOENN(SHEDINJA),
+    SPECIES_TO_HOENN(TAILLOW),
+    SPECIES_TO_HOENN(SWELLOW),
+    SPECIES_TO_HOENN(SHROOMISH),
+    SPECIES_TO_HOENN(BRELOOM),
+    SPECIES_TO_HOENN(SPINDA),
+    SPECIES_TO_HOENN(WINGULL),
+    SPECIES_TO_HOENN(PELIPPER),
+    SPECIES_TO_HOENN(SURSKIT),
+    SPECIES_TO_HOENN(MASQUERAIN),
+    SPECIES_TO_HOENN(WAILMER),
+    SPECIES_TO_HOENN(WAILORD),
+    SPECIES_TO_HOENN(SKITTY),
+    SPECIES_TO_HOENN(DELCATTY),
+    SPECIES_TO_HOENN(KECLEON),
+    SPECIES_TO_HOENN(BALTOY),
+    SPECIES_TO_HOENN(CLAYDOL),
+    SPECIES_TO_HOENN(NOSEPASS),
+    SPECIES_TO_HOENN(TORKOAL),
+    SPECIES_TO_HOENN(SABLEYE),
+    SPECIES_TO_HOENN(BARBOACH),
+    SPECIES_TO_HOENN(WHISCASH),
+    SPECIES_TO_HOENN(LUVDISC),
+    SPECIES_TO_HOENN(CORPHISH),
+    SPECIES_TO_HOENN(CRAWDAUNT),
+    SPECIES_TO_HOENN(FEEBAS),
+    SPECIES_TO_HOENN(MILOTIC),
+    SPECIES_TO_HOENN(CARVANHA),
+    SPECIES_TO_HOENN(SHARPEDO),
+    SPECIES_TO_HOENN(TRAPINCH),
+    SPECIES_TO_HOENN(VIBRAVA),
+    SPECIES_TO_HOENN(FLYGON),
+    SPECIES_TO_HOENN(MAKUHITA),
+    SPECIES_TO_HOENN(HARIYAMA),
+    SPECIES_TO_HOENN(ELECTRIKE),
+    SPECIES_TO_HOENN(MANECTRIC),
+    SPECIES_TO_HOENN(NUMEL),
+    SPECIES_TO_HOENN(CAMERUPT),
+    SPECIES_TO_HOENN(SPHEAL),
+    SPECIES_TO_HOENN(SEALEO),
+    SPECIES_TO_HOENN(WALREIN),
+    SPECIES_TO_HOENN(CACNEA),
+    SPECIES_TO_HOENN(CACTURNE),
+    SPECIES_TO_HOENN(SNORUNT),
+    SPECIES_TO_HOENN(GLALIE),
+    SPECIES_TO_HOENN(LUNATONE),
+    SPECIES_TO_HOENN(SOLROCK),
+    SPECIES_TO_HOENN(AZURILL),
+    SPECIES_TO_HOENN(SPOINK),
+    SPECIES_TO_HOENN(GRUMPIG),
+    SPECIES_TO_HOENN(PLUSLE),
+    SPECIES_TO_HOENN(MINUN),
+    SPECIES_TO_HOENN(MAWILE),
+    SPECIES_TO_HOENN(MEDITITE),
+    SPECIES_TO_HOENN(MEDICHAM),
+    SPECIES_TO_HOENN(SWABLU),
+    SPECIES_TO_HOENN(ALTARIA),
+    SPECIES_TO_HOENN(WYNAUT),
+    SPECIES_TO_HOENN(DUSKULL),
+    SPECIES_TO_HOENN(DUSCLOPS),
+    SPECIES_TO_HOENN(ROSELIA),
+    SPECIES_TO_HOENN(SLAKOTH),
+    SPECIES_TO_HOENN(VIGOROTH),
+    SPECIES_TO_HOENN(SLAKING),
+    SPECIES_TO_HOENN(GULPIN),
+    SPECIES_TO_HOENN(SWALOT),
+    SPECIES_TO_HOENN(TROPIUS),
+    SPECIES_TO_HOENN(WHISMUR),
+    SPECIES_TO_HOENN(LOUDRED),
+    SPECIES_TO_HOENN(EXPLOUD),
+    SPECIES_TO_HOENN(CLAMPERL),
+    SPECIES_TO_HOENN(HUNTAIL),
+    SPECIES_TO_HOENN(GOREBYSS),
+    SPECIES_TO_HOENN(ABSOL),
+    SPECIES_TO_HOENN(SHUPPET),
+    SPECIES_TO_HOENN(BANETTE),
+    SPECIES_TO_HOENN(SEVIPER),
+    SPECIES_TO_HOENN(ZANGOOSE),
+    SPECIES_TO_HOENN(RELICANTH),
+    SPECIES_TO_HOENN(ARON),
+    SPECIES_TO_HOENN(LAIRON),
+    SPECIES_TO_HOENN(AGGRON),
+    SPECIES_TO_HOENN(CASTFORM),
+    SPECIES_TO_HOENN(VOLBEAT),
+    SPECIES_TO_HOENN(ILLUMISE),
+    SPECIES_TO_HOENN(LILEEP),
+    SPECIES_TO_HOENN(CRADILY),
+    SPECIES_TO_HOENN(ANORITH),
+    SPECIES_TO_HOENN(ARMALDO),
+    SPECIES_TO_HOENN(RALTS),
+    SPECIES_TO_HOENN(KIRLIA),
+    SPECIES_TO_HOENN(GARDEVOIR),
+    SPECIES_TO_HOENN(BAGON),
+    SPECIES_TO_HOENN(SHELGON),
+    SPECIES_TO_HOENN(SALAMENCE),
+    SPECIES_TO_HOENN(BELDUM),
+    SPECIES_TO_HOENN(METANG),
+    SPECIES_TO_HOENN(METAGROSS),
+    SPECIES_TO_HOENN(REGIROCK),
+    SPECIES_TO_HOENN(REGICE),
+    SPECIES_TO_HOENN(REGISTEEL),
+    SPECIES_TO_HOENN(KYOGRE),
+    SPECIES_TO_HOENN(GROUDON),
+    SPECIES_TO_HOENN(RAYQUAZA),
+    SPECIES_TO_HOENN(LATIAS),
+    SPECIES_TO_HOENN(LATIOS),
+    SPECIES_TO_HOENN(JIRACHI),
+    SPECIES_TO_HOENN(DEOXYS),
+    SPECIES_TO_HOENN(CHIMECHO),
+    SPECIES_TO_HOENN(MIME_JR),
+    SPECIES_TO_HOENN(MUNCHLAX),
+    SPECIES_TO_HOENN(BONSLY),
+    SPECIES_TO_HOENN(MANTYKE),
+    SPECIES_TO_HOENN(HAPPINY),
+    SPECIES_TO_HOENN(CHINGLING),
+    SPECIES_TO_HOENN(BUDEW),
+    SPECIES_TO_HOENN(ROSERADE),
+    SPECIES_TO_HOENN(DUSKNOIR),
+    SPECIES_TO_HOENN(AMBIPOM),
+    SPECIES_TO_HOENN(ELECTIVIRE),
+    SPECIES_TO_HOENN(FROSLASS),
+    SPECIES_TO_HOENN(GALLADE),
+    SPECIES_TO_HOENN(GLISCOR),
+    SPECIES_TO_HOENN(HONCHKROW),
+    SPECIES_TO_HOENN(LICKILICKY),
+    SPECIES_TO_HOENN(MAGMORTAR),
+    SPECIES_TO_HOENN(MAGNEZONE),
+    SPECIES_TO_HOENN(MAMOSWINE),
+    SPECIES_TO_HOENN(MISMAGIUS),
+    SPECIES_TO_HOENN(PORYGON_Z),
+    SPECIES_TO_HOENN(PROBOPASS),
+    SPECIES_TO_HOENN(RHYPERIOR),
+    SPECIES_TO_HOENN(TANGROWTH),
+    SPECIES_TO_HOENN(TOGEKISS),
+    SPECIES_TO_HOENN(WEAVILE),
+    SPECIES_TO_HOENN(YANMEGA),
+    SPECIES_TO_HOENN(LEAFEON),
+    SPECIES_TO_HOENN(GLACEON),
+    SPECIES_TO_HOENN(SYLVEON),
+    SPECIES_TO_HOENN(REGIDRAGO),
+    SPECIES_TO_HOENN(REGIELEKI),
+    SPECIES_TO_HOENN(REGIGIGAS),
+    SPECIES_TO_HOENN(ARCEUS),
+    SPECIES_TO_HOENN(ANNIHILAPE),
+    SPECIES_TO_HOENN(FARIGIRAF),
+    SPECIES_TO_HOENN(DUDUNSPARCE),
+    SPECIES_TO_HOENN(WYRDEER),
+    SPECIES_TO_HOENN(URSALUNA),
+    SPECIES_TO_HOENN(URSALUNA_BLOODMOON),
+    SPECIES_TO_HOENN(KLEAVOR),
+    //SPECIES_TO_HOENN(URSALUNA_BLOODMOON),
+    //SPECIES_TO_HOENN(KLEAVOR),
+    //SPECIES_TO_HOENN(UNUSED_SPACE5),
+    //SPECIES_TO_HOENN(UNUSED_SPACE6),
+    //SPECIES_TO_HOENN(UNUSED_SPACE7),
+    //SPECIES_TO_HOENN(UNUSED_SPACE8),
+    //SPECIES_TO_HOENN(UNUSED_SPACE9),
+    //SPECIES_TO_HOENN(UNUSED_SPACE10),
+    //SPECIES_TO_HOENN(DEOXYS_ATTACK),
+    //SPECIES_TO_HOENN(DEOXYS_DEFENSE),
+    //SPECIES_TO_HOENN(DEOXYS_SPEED),
@@ -0,0 +1,463 @@
+    SPECIES_TO_NATIONAL(BULBASAUR),
+    SPECIES_TO_NATIONAL(IVYSAUR),
+    SPECIES_TO_NATIONAL(VENUSAUR),
+    SPECIES_TO_NATIONAL(CHARMANDER),
+    SPECIES_TO_NATIONAL(CHARMELEON),
+    SPECIES_TO_NATIONAL(CHARIZARD),
+    SPECIES_TO_NATIONAL(SQUIRTLE),
+    SPECIES_TO_NATIONAL(WARTORTLE),
+    SPECIES_TO_NATIONAL(BLASTOISE),
+    SPECIES_TO_NATIONAL(CATERPIE),
+    SPECIES_TO_NATIONAL(METAPOD),
+    SPECIES_TO_NATIONAL(BUTTERFREE),
+    SPECIES_TO_NATIONAL(WEEDLE),
+    SPECIES_TO_NATIONAL(KAKUNA),
+    SPECIES_TO_NATIONAL(BEEDRILL),
+    SPECIES_TO_NATIONAL(PIDGEY),
+    SPECIES_TO_NATIONAL(PIDGEOTTO),
+    SPECIES_TO_NATIONAL(PIDGEOT),
+    SPECIES_TO_NATIONAL(RATTATA),
+    SPECIES_TO_NATIONAL(RATICATE),
+    SPECIES_TO_NATIONAL(SPEAROW),
+    SPECIES_TO_NATIONAL(FEAROW),
+    SPECIES_TO_NATIONAL(EKANS),
+    SPECIES_TO_NATIONAL(ARBOK),
+    SPECIES_TO_NATIONAL(PIKACHU),
+    SPECIES_TO_NATIONAL(RAICHU),
+    SPECIES_TO_NATIONAL(SANDSHREW),
+    SPECIES_TO_NATIONAL(SANDSLASH),
+    SPECIES_TO_NATIONAL(NIDORAN_F),
+    SPECIES_TO_NATIONAL(NIDORINA),
+    SPECIES_TO_NATIONAL(NIDOQUEEN),
+    SPECIES_TO_NATIONAL(NIDORAN_M),
+    SPECIES_TO_NATIONAL(NIDORINO),
+    SPECIES_TO_NATIONAL(NIDOKING),
+    SPECIES_TO_NATIONAL(CLEFAIRY),
+    SPECIES_TO_NATIONAL(CLEFABLE),
+    SPECIES_TO_NATIONAL(VULPIX),
+    SPECIES_TO_NATIONAL(NINETALES),
+    SPECIES_TO_NATIONAL(JIGGLYPUFF),
+    SPECIES_TO_NATIONAL(WIGGLYTUFF),
+    SPECIES_TO_NATIONAL(ZUBAT),
+    SPECIES_TO_NATIONAL(GOLBAT),
+    SPECIES_TO_NATIONAL(ODDISH),
+    SPECIES_TO_NATIONAL(GLOOM),
+    SPECIES_TO_NATIONAL(VILEPLUME),
+    SPECIES_TO_NATIONAL(PARAS),
+    SPECIES_TO_NATIONAL(PARASECT),
+    SPECIES_TO_NATIONAL(VENONAT),
+    SPECIES_TO_NATIONAL(VENOMOTH),
+    SPECIES_TO_NATIONAL(DIGLETT),
+    SPECIES_TO_NATIONAL(DUGTRIO),
+    SPECIES_TO_NATIONAL(MEOWTH),
+    SPECIES_TO_NATIONAL(PERSIAN),
+    SPECIES_TO_NATIONAL(PSYDUCK),
+    SPECIES_TO_NATIONAL(GOLDUCK),
+    SPECIES_TO_NATIONAL(MANKEY),
+    SPECIES_TO_NATIONAL(PRIMEAPE),
+    SPECIES_TO_NATIONAL(GROWLITHE),
+    SPECIES_TO_NATIONAL(ARCANINE),
+    SPECIES_TO_NATIONAL(POLIWAG),
+    SPECIES_TO_NATIONAL(POLIWHIRL),
+    SPECIES_TO_NATIONAL(POLIWRATH),
+    SPECIES_TO_NATIONAL(ABRA),
+    SPECIES_TO_NATIONAL(KADABRA),
+    SPECIES_TO_NATIONAL(ALAKAZAM),
+    SPECIES_TO_NATIONAL(MACHOP),
+    SPECIES_TO_NATIONAL(MACHOKE),
+    SPECIES_TO_NATIONAL(MACHAMP),
+    SPECIES_TO_NATIONAL(BELLSPROUT),
+    SPECIES_TO_NATIONAL(WEEPINBELL),
+    SPECIES_TO_NATIONAL(VICTREEBEL),
+    SPECIES_TO_NATIONAL(TENTACOOL),
+    SPECIES_TO_NATIONAL(TENTACRUEL),
+    SPECIES_TO_NATIONAL(GEODUDE),
+    SPECIES_TO_NATIONAL(GRAVELER),
+    SPECIES_TO_NATIONAL(GOLEM),
+    SPECIES_TO_NATIONAL(PONYTA),
+    SPECIES_TO_NATIONAL(RAPIDASH),
+    SPECIES_TO_NATIONAL(SLOWPOKE),
+    SPECIES_TO_NATIONAL(SLOWBRO),
+    SPECIES_TO_NATIONAL(MAGNEMITE),
+    SPECIES_TO_NATIONAL(MAGNETON),
+    SPECIES_TO_NATIONAL(FARFETCHD),
+    SPECIES_TO_NATIONAL(DODUO),
+    SPECIES_TO_NATIONAL(DODRIO),
+    SPECIES_TO_NATIONAL(SEEL),
+    SPECIES_TO_NATIONAL(DEWGONG),
+    SPECIES_TO_NATIONAL(GRIMER),
+    SPECIES_TO_NATIONAL(MUK),
+    SPECIES_TO_NATIONAL(SHELLDER),
+    SPECIES_TO_NATIONAL(CLOYSTER),
+    SPECIES_TO_NATIONAL(GASTLY),
+    SPECIES_TO_NATIONAL(HAUNTER),
+    SPECIES_TO_NATIONAL(GENGAR),
+    SPECIES_TO_NATIONAL(ONIX),
+    SPECIES_TO_NATIONAL(DROWZEE),
+    SPECIES_TO_NATIONAL(HYPNO),
+    SPECIES_TO_NATIONAL(KRABBY),
+    SPECIES_TO_NATIONAL(KINGLER),
+    SPECIES_TO_NATIONAL(VOLTORB),
+    SPECIES_TO_NATIONAL(ELECTRODE),
+    SPECIES_TO_NATIONAL(EXEGGCUTE),
+    SPECIES_TO_NATIONAL(EXEGGUTOR),
+    SPECIES_TO_NATIONAL(CUBONE),
+    SPECIES_TO_NATIONAL(MAROWAK),
+    SPECIES_TO_NATIONAL(HITMONLEE),
+    SPECIES_TO_NATIONAL(HITMONCHAN),
+    SPECIES_TO_NATIONAL(LICKITUNG),
+    SPECIES_TO_NATIONAL(KOFFING),
+    SPECIES_TO_NATIONAL(WEEZING),
+    SPECIES_TO_NATIONAL(RHYHORN),
+    SPECIES_TO_NATIONAL(RHYDON),
+    SPECIES_TO_NATIONAL(CHANSEY),
+    SPECIES_TO_NATIONAL(TANGELA),
+    SPECIES_TO_NATIONAL(KANGASKHAN),
+    SPECIES_TO_NATIONAL(HORSEA),
+    SPECIES_TO_NATIONAL(SEADRA),
+    SPECIES_TO_NATIONAL(GOLDEEN),
+    SPECIES_TO_NATIONAL(SEAKING),
+    SPECIES_TO_NATIONAL(STARYU),
+    SPECIES_TO_NATIONAL(STARMIE),
+    SPECIES_TO_NATIONAL(MR_MIME),
+    SPECIES_TO_NATIONAL(SCYTHER),
+    SPECIES_TO_NATIONAL(JYNX),
+    SPECIES_TO_NATIONAL(ELECTABUZZ),
+    SPECIES_TO_NATIONAL(MAGMAR),
+    SPECIES_TO_NATIONAL(PINSIR),
+    SPECIES_TO_NATIONAL(TAUROS),
+    SPECIES_TO_NATIONAL(MAGIKARP),
+    SPECIES_TO_NATIONAL(GYARADOS),
+    SPECIES_TO_NATIONAL(LAPRAS),
+    SPECIES_TO_NATIONAL(DITTO),
+    SPECIES_TO_NATIONAL(EEVEE),
+    SPECIES_TO_NATIONAL(VAPOREON),
+    SPECIES_TO_NATIONAL(JOLTEON),
+    SPECIES_TO_NATIONAL(FLAREON),
+    SPECIES_TO_NATIONAL(PORYGON),
+    SPECIES_TO_NATIONAL(OMANYTE),
+    SPECIES_TO_NATIONAL(OMASTAR),
+    SPECIES_TO_NATIONAL(KABUTO),
+    SPECIES_TO_NATIONAL(KABUTOPS),
+    SPECIES_TO_NATIONAL(AERODACTYL),
+    SPECIES_TO_NATIONAL(SNORLAX),
+    SPECIES_TO_NATIONAL(ARTICUNO),
+    SPECIES_TO_NATIONAL(ZAPDOS),
+    SPECIES_TO_NATIONAL(MOLTRES),
+    SPECIES_TO_NATIONAL(DRATINI),
+    SPECIES_TO_NATIONAL(DRAGONAIR),
+    SPECIES_TO_NATIONAL(DRAGONITE),
+    SPECIES_TO_NATIONAL(MEWTWO),
+    SPECIES_TO_NATIONAL(MEW),
+    SPECIES_TO_NATIONAL(CHIKORITA),
+    SPECIES_TO_NATIONAL(BAYLEEF),
+    SPECIES_TO_NATIONAL(MEGANIUM),
+    SPECIES_TO_NATIONAL(CYNDAQUIL),
+    SPECIES_TO_NATIONAL(QUILAVA),
+    SPECIES_TO_NATIONAL(TYPHLOSION),
+    SPECIES_TO_NATIONAL(TOTODILE),
+    SPECIES_TO_NATIONAL(CROCONAW),
+    SPECIES_TO_NATIONAL(FERALIGATR),
+    SPECIES_TO_NATIONAL(SENTRET),
+    SPECIES_TO_NATIONAL(FURRET),
+    SPECIES_TO_NATIONAL(HOOTHOOT),
+    SPECIES_TO_NATIONAL(NOCTOWL),
+    SPECIES_TO_NATIONAL(LEDYBA),
+    SPECIES_TO_NATIONAL(LEDIAN),
+    SPECIES_TO_NATIONAL(SPINARAK),
+    SPECIES_TO_NATIONAL(ARIADOS),
+    SPECIES_TO_NATIONAL(CROBAT),
+    SPECIES_TO_NATIONAL(CHINCHOU),
+    SPECIES_TO_NATIONAL(LANTURN),
+    SPECIES_TO_NATIONAL(PICHU),
+    SPECIES_TO_NATIONAL(CLEFFA),
+    SPECIES_TO_NATIONAL(IGGLYBUFF),
+    SPECIES_TO_NATIONAL(TOGEPI),
+    SPECIES_TO_NATIONAL(TOGETIC),
+    SPECIES_TO_NATIONAL(NATU),
+    SPECIES_TO_NATIONAL(XATU),
+    SPECIES_TO_NATIONAL(MAREEP),
+    SPECIES_TO_NATIONAL(FLAAFFY),
+    SPECIES_TO_NATIONAL(AMPHAROS),
+    SPECIES_TO_NATIONAL(BELLOSSOM),
+    SPECIES_TO_NATIONAL(MARILL),
+    SPECIES_TO_NATIONAL(AZUMARILL),
+    SPECIES_TO_NATIONAL(SUDOWOODO),
+    SPECIES_TO_NATIONAL(POLITOED),
+    SPECIES_TO_NATIONAL(HOPPIP),
+    SPECIES_TO_NATIONAL(SKIPLOOM),
+    SPECIES_TO_NATIONAL(JUMPLUFF),
+    SPECIES_TO_NATIONAL(AIPOM),
+    SPECIES_TO_NATIONAL(SUNKERN),
+    SPECIES_TO_NATIONAL(SUNFLORA),
+    SPECIES_TO_NATIONAL(YANMA),
+    SPECIES_TO_NATIONAL(WOOPER),
+    SPECIES_TO_NATIONAL(QUAGSIRE),
+    SPECIES_TO_NATIONAL(ESPEON),
+    SPECIES_TO_NATIONAL(UMBREON),
+    SPECIES_TO_NATIONAL(MURKROW),
+    SPECIES_TO_NATIONAL(SLOWKING),
+    SPECIES_TO_NATIONAL(MISDREAVUS),
+    SPECIES_TO_NATIONAL(UNOWN),
+    SPECIES_TO_NATIONAL(WOBBUFFET),
+    SPECIES_TO_NATIONAL(GIRAFARIG),
+    SPECIES_TO_NATIONAL(PINECO),
+    SPECIES_TO_NATIONAL(FORRETRESS),
+    SPECIES_TO_NATIONAL(DUNSPARCE),
+    SPECIES_TO_NATIONAL(GLIGAR),
+    SPECIES_TO_NATIONAL(STEELIX),
+    SPECIES_TO_NATIONAL(SNUBBULL),
+    SPECIES_TO_NATIONAL(GRANBULL),
+    SPECIES_TO_NATIONAL(QWILFISH),
+    SPECIES_TO_NATIONAL(SCIZOR),
+    SPECIES_TO_NATIONAL(SHUCKLE),
+    SPECIES_TO_NATIONAL(HERACROSS),
+    SPECIES_TO_NATIONAL(SNEASEL),
+    SPECIES_TO_NATIONAL(TEDDIURSA),
+    SPECIES_TO_NATIONAL(URSARING),
+    SPECIES_TO_NATIONAL(SLUGMA),
+    SPECIES_TO_NATIONAL(MAGCARGO),
+    SPECIES_TO_NATIONAL(SWINUB),
+    SPECIES_TO_NATIONAL(PILOSWINE),
+    SPECIES_TO_NATIONAL(CORSOLA),
+    SPECIES_TO_NATIONAL(REMORAID),
+    SPECIES_TO_NATIONAL(OCTILLERY),
+    SPECIES_TO_NATIONAL(DELIBIRD),
+    SPECIES_TO_NATIONAL(MANTINE),
+    SPECIES_TO_NATIONAL(SKARMORY),
+    SPECIES_TO_NATIONAL(HOUNDOUR),
+    SPECIES_TO_NATIONAL(HOUNDOOM),
+    SPECIES_TO_NATIONAL(KINGDRA),
+    SPECIES_TO_NATIONAL(PHANPY),
+    SPECIES_TO_NATIONAL(DONPHAN),
+    SPECIES_TO_NATIONAL(PORYGON2),
+    SPECIES_TO_NATIONAL(STANTLER),
+    SPECIES_TO_NATIONAL(SMEARGLE),
+    SPECIES_TO_NATIONAL(TYROGUE),
+    SPECIES_TO_NATIONAL(HITMONTOP),
+    SPECIES_TO_NATIONAL(SMOOCHUM),
+    SPECIES_TO_NATIONAL(ELEKID),
+    SPECIES_TO_NATIONAL(MAGBY),
+    SPECIES_TO_NATIONAL(MILTANK),
+    SPECIES_TO_NATIONAL(BLISSEY),
+    SPECIES_TO_NATIONAL(RAIKOU),
+    SPECIES_TO_NATIONAL(ENTEI),
+    SPECIES_TO_NATIONAL(SUICUNE),
+    SPECIES_TO_NATIONAL(LARVITAR),
+    SPECIES_TO_NATIONAL(PUPITAR),
+    SPECIES_TO_NATIONAL(TYRANITAR),
+    SPECIES_TO_NATIONAL(LUGIA),
+    SPECIES_TO_NATIONAL(HO_OH),
+    SPECIES_TO_NATIONAL(CELEBI),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_B),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_C),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_D),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_E),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_F),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_G),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_H),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_I),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_J),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_K),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_L),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_M),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_N),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_O),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_P),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_Q),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_R),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_S),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_T),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_U),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_V),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_W),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_X),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_Y),
+    SPECIES_TO_NATIONAL(OLD_UNOWN_Z),
+    SPECIES_TO_NATIONAL(TREECKO),
+    SPECIES_TO_NATIONAL(GROVYLE),
+    SPECIES_TO_NATIONAL(SCEPTILE),
+    SPECIES_TO_NATIONAL(TORCHIC),
+    SPECIES_TO_NATIONAL(COMBUSKEN),
+    SPECIES_TO_NATIONAL(BLAZIKEN),
+    SPECIES_TO_NATIONAL(MUDKIP),
+    SPECIES_TO_NATIONAL(MARSHTOMP),
+    SPECIES_TO_NATIONAL(SWAMPERT),
+    SPECIES_TO_NATIONAL(POOCHYENA),
+    SPECIES_TO_NATIONAL(MIGHTYENA),
+    SPECIES_TO_NATIONAL(ZIGZAGOON),
+    SPECIES_TO_NATIONAL(LINOONE),
+    SPECIES_TO_NATIONAL(WURMPLE),
+    SPECIES_TO_NATIONAL(SILCOON),
+    SPECIES_TO_NATIONAL(BEAUTIFLY),
+    SPECIES_TO_NATIONAL(CASCOON),
+    SPECIES_TO_NATIONAL(DUSTOX),
+    SPECIES_TO_NATIONAL(LOTAD),
+    SPECIES_TO_NATIONAL(LOMBRE),
+    SPECIES_TO_NATIONAL(LUDICOLO),
+    SPECIES_TO_NATIONAL(SEEDOT),
+    SPECIES_TO_NATIONAL(NUZLEAF),
+    SPECIES_TO_NATIONAL(SHIFTRY),
+    SPECIES_TO_NATIONAL(NINCADA),
+    SPECIES_TO_NATIONAL(NINJASK),
+    SPECIES_TO_NATIONAL(SHEDINJA),
+    SPECIES_TO_NATIONAL(TAILLOW),
+    SPECIES_TO_NATIONAL(SWELLOW),
+    SPECIES_TO_NATIONAL(SHROOMISH),
+    SPECIES_TO_NATIONAL(BRELOOM),
+    SPECIES_TO_NATIONAL(SPINDA),
+    SPECIES_TO_NATIONAL(WINGULL),
+    SPECIES_TO_NATIONAL(PELIPPER),
+    SPECIES_TO_NATIONAL(SURSKIT),
+    SPECIES_TO_NATIONAL(MASQUERAIN),
+    SPECIES_TO_NATIONAL(WAILMER),
+    SPECIES_TO_NATIONAL(WAILORD),
+    SPECIES_TO_NATIONAL(SKITTY),
+    SPECIES_TO_NATIONAL(DELCATTY),
+    SPECIES_TO_NATIONAL(KECLEON),
+    SPECIES_TO_NATIONAL(BALTOY),
+    SPECIES_TO_NATIONAL(CLAYDOL),
+    SPECIES_TO_NATIONAL(NOSEPASS),
+    SPECIES_TO_NATIONAL(TORKOAL),
+    SPECIES_TO_NATIONAL(SABLEYE),
+    SPECIES_TO_NATIONAL(BARBOACH),
+    SPECIES_TO_NATIONAL(WHISCASH),
+    SPECIES_TO_NATIONAL(LUVDISC),
+    SPECIES_TO_NATIONAL(CORPHISH),
+    SPECIES_TO_NATIONAL(CRAWDAUNT),
+    SPECIES_TO_NATIONAL(FEEBAS),
+    SPECIES_TO_NATIONAL(MILOTIC),
+    SPECIES_TO_NATIONAL(CARVANHA),
+    SPECIES_TO_NATIONAL(SHARPEDO),
+    SPECIES_TO_NATIONAL(TRAPINCH),
+    SPECIES_TO_NATIONAL(VIBRAVA),
+    SPECIES_TO_NATIONAL(FLYGON),
+    SPECIES_TO_NATIONAL(MAKUHITA),
+    SPECIES_TO_NATIONAL(HARIYAMA),
+    SPECIES_TO_NATIONAL(ELECTRIKE),
+    SPECIES_TO_NATIONAL(MANECTRIC),
+    SPECIES_TO_NATIONAL(NUMEL),
+    SPECIES_TO_NATIONAL(CAMERUPT),
+    SPECIES_TO_NATIONAL(SPHEAL),
+    SPECIES_TO_NATIONAL(SEALEO),
+    SPECIES_TO_NATIONAL(WALREIN),
+    SPECIES_TO_NATIONAL(CACNEA),
+    SPECIES_TO_NATIONAL(CACTURNE),
+    SPECIES_TO_NATIONAL(SNORUNT),
+    SPECIES_TO_NATIONAL(GLALIE),
+    SPECIES_TO_NATIONAL(LUNATONE),
+    SPECIES_TO_NATIONAL(SOLROCK),
+    SPECIES_TO_NATIONAL(AZURILL),
+    SPECIES_TO_NATIONAL(SPOINK),
+    SPECIES_TO_NATIONAL(GRUMPIG),
+    SPECIES_TO_NATIONAL(PLUSLE),
+    SPECIES_TO_NATIONAL(MINUN),
+    SPECIES_TO_NATIONAL(MAWILE),
+    SPECIES_TO_NATIONAL(MEDITITE),
+    SPECIES_TO_NATIONAL(MEDICHAM),
+    SPECIES_TO_NATIONAL(SWABLU),
+    SPECIES_TO_NATIONAL(ALTARIA),
+    SPECIES_TO_NATIONAL(WYNAUT),
+    SPECIES_TO_NATIONAL(DUSKULL),
+    SPECIES_TO_NATIONAL(DUSCLOPS),
+    SPECIES_TO_NATIONAL(ROSELIA),
+    SPECIES_TO_NATIONAL(SLAKOTH),
+    SPECIES_TO_NATIONAL(VIGOROTH),
+    SPECIES_TO_NATIONAL(SLAKING),
+    SPECIES_TO_NATIONAL(GULPIN),
+    SPECIES_TO_NATIONAL(SWALOT),
+    SPECIES_TO_NATIONAL(TROPIUS),
+    SPECIES_TO_NATIONAL(WHISMUR),
+    SPECIES_TO_NATIONAL(LOUDRED),
+    SPECIES_TO_NATIONAL(EXPLOUD),
+    SPECIES_TO_NATIONAL(CLAMPERL),
+    SPECIES_TO_NATIONAL(HUNTAIL),
+    SPECIES_TO_NATIONAL(GOREBYSS),
+    SPECIES_TO_NATIONAL(ABSOL),
+    SPECIES_TO_NATIONAL(SHUPPET),
+    SPECIES_TO_NATIONAL(BANETTE),
+    SPECIES_TO_NATIONAL(SEVIPER),
+    SPECIES_TO_NATIONAL(ZANGOOSE),
+    SPECIES_TO_NATIONAL(RELICANTH),
+    SPECIES_TO_NATIONAL(ARON),
+    SPECIES_TO_NATIONAL(LAIRON),
+    SPECIES_TO_NATIONAL(AGGRON),
+    SPECIES_TO_NATIONAL(CASTFORM),
+    SPECIES_TO_NATIONAL(VOLBEAT),
+    SPECIES_TO_NATIONAL(ILLUMISE),
+    SPECIES_TO_NATIONAL(LILEEP),
+    SPECIES_TO_NATIONAL(CRADILY),
+    SPECIES_TO_NATIONAL(ANORITH),
+    SPECIES_TO_NATIONAL(ARMALDO),
+    SPECIES_TO_NATIONAL(RALTS),
+    SPECIES_TO_NATIONAL(KIRLIA),
+    SPECIES_TO_NATIONAL(GARDEVOIR),
+    SPECIES_TO_NATIONAL(BAGON),
+    SPECIES_TO_NATIONAL(SHELGON),
+    SPECIES_TO_NATIONAL(SALAMENCE),
+    SPECIES_TO_NATIONAL(BELDUM),
+    SPECIES_TO_NATIONAL(METANG),
+    SPECIES_TO_NATIONAL(METAGROSS),
+    SPECIES_TO_NATIONAL(REGIROCK),
+    SPECIES_TO_NATIONAL(REGICE),
+    SPECIES_TO_NATIONAL(REGISTEEL),
+    SPECIES_TO_NATIONAL(KYOGRE),
+    SPECIES_TO_NATIONAL(GROUDON),
+    SPECIES_TO_NATIONAL(RAYQUAZA),
+    SPECIES_TO_NATIONAL(LATIAS),
+    SPECIES_TO_NATIONAL(LATIOS),
+    SPECIES_TO_NATIONAL(JIRACHI),
+    SPECIES_TO_NATIONAL(DEOXYS),
+    SPECIES_TO_NATIONAL(CHIMECHO),
+    SPECIES_TO_NATIONAL(MIME_JR),
+    SPECIES_TO_NATIONAL(MUNCHLAX),
+    SPECIES_TO_NATIONAL(BONSLY),
+    SPECIES_TO_NATIONAL(MANTYKE),
+    SPECIES_TO_NATIONAL(HAPPINY),
+    SPECIES_TO_NATIONAL(CHINGLING),
+    SPECIES_TO_NATIONAL(BUDEW),
+    SPECIES_TO_NATIONAL(ROSERADE),
+    SPECIES_TO_NATIONAL(DUSKNOIR),
+    SPECIES_TO_NATIONAL(AMBIPOM),
+    SPECIES_TO_NATIONAL(ELECTIVIRE),
+    SPECIES_TO_NATIONAL(FROSLASS),
+    SPECIES_TO_NATIONAL(GALLADE),
+    SPECIES_TO_NATIONAL(GLISCOR),
+    SPECIES_TO_NATIONAL(HONCHKROW),
+    SPECIES_TO_NATIONAL(LICKILICKY),
+    SPECIES_TO_NATIONAL(MAGMORTAR),
+    SPECIES_TO_NATIONAL(MAGNEZONE),
+    SPECIES_TO_NATIONAL(MAMOSWINE),
+    SPECIES_TO_NATIONAL(MISMAGIUS),
+    SPECIES_TO_NATIONAL(PORYGON_Z),
+    SPECIES_TO_NATIONAL(PROBOPASS),
+    SPECIES_TO_NATIONAL(RHYPERIOR),
+    SPECIES_TO_NATIONAL(TANGROWTH),
+    SPECIES_TO_NATIONAL(TOGEKISS),
+    SPECIES_TO_NATIONAL(WEAVILE),
+    SPECIES_TO_NATIONAL(YANMEGA),
+    SPECIES_TO_NATIONAL(LEAFEON),
+    SPECIES_TO_NATIONAL(GLACEON),
+    SPECIES_TO_NATIONAL(SYLVEON),
+    SPECIES_TO_NATIONAL(REGIDRAGO),
+    SPECIES_TO_NATIONAL(REGIELEKI),
+    SPECIES_TO_NATIONAL(REGIGIGAS),
+    SPECIES_TO_NATIONAL(ARCEUS),
+    SPECIES_TO_NATIONAL(ANNIHILAPE),
+    SPECIES_TO_NATIONAL(FARIGIRAF),
+    SPECIES_TO_NATIONAL(DUDUNSPARCE),
+    SPECIES_TO_NATIONAL(WYRDEER),
+    SPECIES_TO_NATIONAL(URSALUNA),
+    SPECIES_TO_NATIONAL(URSALUNA_BLOODMOON),
+    SPECIES_TO_NATIONAL(KLEAVOR),
+    //SPECIES_TO_NATIONAL(URSALUNA_BLOODMOON),
+    //SPECIES_TO_NATIONAL(KLEAVOR),
+    //SPECIES_TO_NATIONAL(UNUSED_SPACE5),
+    //SPECIES_TO_NATIONAL(UNUSED_SPACE6),
+    //SPECIES_TO_NATIONAL(UNUSED_SPACE7),
+    //SPECIES_TO_NATIONAL(UNUSED_SPACE8),
+    //SPECIES_TO_NATIONAL(UNUSED_SPACE9),
+    //SPECIES_TO_NATIONAL(UNUSED_SPACE10),
+    //SPECIES_TO_NATIONAL(DEOXYS_ATTACK),
+    //SPECIES_TO_NATIONAL(DEOXYS_DEFENSE),
+    //SPECIES_TO_NATIONAL(DEOXYS_SPEED),
@@ -15,6 +15,7 @@
 #include "daycare.h"
 #include "debug.h"
 #include "debug_pokemon_creator.h"
+#include "dma3.h"
 #include "event_data.h"
 #include "event_object_movement.h"
 #include "event_scripts.h"
@@ -41,6 +42,7 @@
 #include "pokemon.h"
 #include "pokemon_icon.h"
 #include "pokemon_storage_system.h"
+#include "profiler.h"
 #include "random.h"
 #include "region_map.h"
 #include "script.h"
@@ -92,6 +94,15 @@ enum { // Util
     DEBUG_UTIL_MENU_ITEM_TRAINER_GENDER,
     DEBUG_UTIL_MENU_ITEM_TRAINER_ID,
     DEBUG_UTIL_MENU_ITEM_CHEAT,
+    DEBUG_UTIL_MENU_ITEM_RANDOMIZER_TABLES,
+    DEBUG_UTIL_MENU_ITEM_HEAP_STATS,
+    DEBUG_UTIL_MENU_ITEM_DMA3_STATS,
+    DEBUG_UTIL_MENU_ITEM_MIXER_STATS,
+    DEBUG_UTIL_MENU_ITEM_TIME_BLEND_STATS,
+    DEBUG_UTIL_MENU_ITEM_TEXT_BENCHMARK,
+    DEBUG_UTIL_MENU_ITEM_CREATE_MON_BENCHMARK,
+    DEBUG_UTIL_MENU_ITEM_PROFILER_LOG,
+    DEBUG_UTIL_MENU_ITEM_PROFILER_HUD,
 };
 enum { // Scripts
     DEBUG_UTIL_MENU_ITEM_SCRIPT_1,
@@ -221,6 +232,11 @@ enum { //Sound
 #define DEBUG_MENU_WIDTH_FLAGVAR 4
 #define DEBUG_MENU_HEIGHT_FLAGVAR 2
 
+#define DEBUG_MENU_WIDTH_PROFILER 28
+#define DEBUG_MENU_HEIGHT_PROFILER 7
+
+#define DEBUG_CYCLES_PER_FRAME 280896
+
 #define DEBUG_NUMBER_DIGITS_FLAGS 4
 #define DEBUG_NUMBER_DIGITS_VARIABLES 5
 #define DEBUG_NUMBER_DIGITS_VARIABLE_VALUE 5
@@ -335,6 +351,16 @@ static void DebugAction_Util_Trainer_Name(u8 taskId);
 static void DebugAction_Util_Trainer_Gender(u8 taskId);
 static void DebugAction_Util_Trainer_Id(u8 taskId);
 static void DebugAction_Util_CheatStart(u8 taskId);
+static void DebugAction_Util_RandomizerTables(u8 taskId);
+static void DebugAction_Util_HeapStats(u8 taskId);
+static void DebugAction_Util_Dma3Stats(u8 taskId);
+static void DebugAction_Util_MixerStats(u8 taskId);
+static void DebugAction_Util_TimeBlendStats(u8 taskId);
+static void DebugAction_Util_TextBenchmark(u8 taskId);
+static void DebugAction_Util_CreateMonBenchmark(u8 taskId);
+static void DebugAction_Util_ProfilerLog(u8 taskId);
+static void DebugAction_Util_ProfilerHud(u8 taskId);
+static void DebugAction_Util_ProfilerHud_Update(u8 taskId);
 
 static void DebugAction_FlagsVars_Flags(u8 taskId);
 static void DebugAction_FlagsVars_FlagsSelect(u8 taskId);
@@ -478,6 +504,16 @@ static const u8 sDebugText_Util_Trainer_Name[] =            _("Trainer name");
 static const u8 sDebugText_Util_Trainer_Gender[] =          _("Toggle T. Gender");
 static const u8 sDebugText_Util_Trainer_Id[] =              _("New Trainer Id");
 static const u8 sDebugText_Util_CheatStart[] =              _("CHEAT Start");
+static const u8 sDebugText_Util_RandomizerTables[] =        _("Dump randomizer");
+static const u8 sDebugText_Util_HeapStats[] =               _("Dump heap stats");
+static const u8 sDebugText_Util_Dma3Stats[] =               _("Dump DMA3 stats");
+static const u8 sDebugText_Util_MixerStats[] =              _("Dump mixer stats");
+static const u8 sDebugText_Util_TimeBlendStats[] =          _("Dump time blend stats");
+static const u8 sDebugText_Util_TextBenchmark[] =           _("Text benchmark");
+static const u8 sDebugText_Util_CreateMonBenchmark[] =      _("CreateMon benchmark");
+static const u8 sDebugText_Util_ProfilerLog[] =             _("Toggle profiler log");
+static const u8 sDebugText_Util_ProfilerHud[] =             _("Profiler HUD");
+static const u8 sDebugText_Util_ProfilerHud_Header[] =      _("Avg/max % of a frame, over 60 frames");
 // Flags/Vars Menu
 static const u8 sDebugText_FlagsVars_Flags[] =                  _("Set Flag XYZ…{CLEAR_TO 110}{RIGHT_ARROW}");
 static const u8 sDebugText_FlagsVars_Flag[] =                   _("Flag: {STR_VAR_1}{CLEAR_TO 90}\n{STR_VAR_2}{CLEAR_TO 90}\n{STR_VAR_3}");
@@ -665,6 +701,15 @@ static const struct ListMenuItem sDebugMenu_Items_Utilities[] =
     [DEBUG_UTIL_MENU_ITEM_TRAINER_GENDER]   = {sDebugText_Util_Trainer_Gender,   DEBUG_UTIL_MENU_ITEM_TRAINER_GENDER},
     [DEBUG_UTIL_MENU_ITEM_TRAINER_ID]       = {sDebugText_Util_Trainer_Id,       DEBUG_UTIL_MENU_ITEM_TRAINER_ID},
     [DEBUG_UTIL_MENU_ITEM_CHEAT]            = {sDebugText_Util_CheatStart,        DEBUG_UTIL_MENU_ITEM_CHEAT},
+    [DEBUG_UTIL_MENU_ITEM_RANDOMIZER_TABLES] = {sDebugText_Util_RandomizerTables, DEBUG_UTIL_MENU_ITEM_RANDOMIZER_TABLES},
+    [DEBUG_UTIL_MENU_ITEM_HEAP_STATS]       = {sDebugText_Util_HeapStats,        DEBUG_UTIL_MENU_ITEM_HEAP_STATS},
+    [DEBUG_UTIL_MENU_ITEM_DMA3_STATS]       = {sDebugText_Util_Dma3Stats,        DEBUG_UTIL_MENU_ITEM_DMA3_STATS},
+    [DEBUG_UTIL_MENU_ITEM_MIXER_STATS]      = {sDebugText_Util_MixerStats,       DEBUG_UTIL_MENU_ITEM_MIXER_STATS},
+    [DEBUG_UTIL_MENU_ITEM_TIME_BLEND_STATS] = {sDebugText_Util_TimeBlendStats,   DEBUG_UTIL_MENU_ITEM_TIME_BLEND_STATS},
+    [DEBUG_UTIL_MENU_ITEM_TEXT_BENCHMARK]   = {sDebugText_Util_TextBenchmark,    DEBUG_UTIL_MENU_ITEM_TEXT_BENCHMARK},
+    [DEBUG_UTIL_MENU_ITEM_CREATE_MON_BENCHMARK] = {sDebugText_Util_CreateMonBenchmark, DEBUG_UTIL_MENU_ITEM_CREATE_MON_BENCHMARK},
+    [DEBUG_UTIL_MENU_ITEM_PROFILER_LOG]     = {sDebugText_Util_ProfilerLog,      DEBUG_UTIL_MENU_ITEM_PROFILER_LOG},
+    [DEBUG_UTIL_MENU_ITEM_PROFILER_HUD]     = {sDebugText_Util_ProfilerHud,      DEBUG_UTIL_MENU_ITEM_PROFILER_HUD},
 };
 static const struct ListMenuItem sDebugMenu_Items_Scripts[] =
 {
@@ -815,6 +860,15 @@ static void (*const sDebugMenu_Actions_Utilities[])(u8) =
     [DEBUG_UTIL_MENU_ITEM_TRAINER_GENDER]   = DebugAction_Util_Trainer_Gender,
     [DEBUG_UTIL_MENU_ITEM_TRAINER_ID]       = DebugAction_Util_Trainer_Id,
     [DEBUG_UTIL_MENU_ITEM_CHEAT]            = DebugAction_Util_CheatStart,
+    [DEBUG_UTIL_MENU_ITEM_RANDOMIZER_TABLES] = DebugAction_Util_RandomizerTables,
+    [DEBUG_UTIL_MENU_ITEM_HEAP_STATS]       = DebugAction_Util_HeapStats,
+    [DEBUG_UTIL_MENU_ITEM_DMA3_STATS]       = DebugAction_Util_Dma3Stats,
+    [DEBUG_UTIL_MENU_ITEM_MIXER_STATS]      = DebugAction_Util_MixerStats,
+    [DEBUG_UTIL_MENU_ITEM_TIME_BLEND_STATS] = DebugAction_Util_TimeBlendStats,
+    [DEBUG_UTIL_MENU_ITEM_TEXT_BENCHMARK]   = DebugAction_Util_TextBenchmark,
+    [DEBUG_UTIL_MENU_ITEM_CREATE_MON_BENCHMARK] = DebugAction_Util_CreateMonBenchmark,
+    [DEBUG_UTIL_MENU_ITEM_PROFILER_LOG]     = DebugAction_Util_ProfilerLog,
+    [DEBUG_UTIL_MENU_ITEM_PROFILER_HUD]     = DebugAction_Util_ProfilerHud,
 };
 static void (*const sDebugMenu_Actions_Scripts[])(u8) =
 {
@@ -943,6 +997,16 @@ static const struct WindowTemplate sDebugMenuWindowTemplateFlagsVars =
     .paletteNum = 15,
     .baseBlock = 1 + DEBUG_MENU_WIDTH_MAIN * DEBUG_MENU_HEIGHT_MAIN * 2,
 };
+static const struct WindowTemplate sDebugMenuWindowTemplateProfiler =
+{
+    .bg = 0,
+    .tilemapLeft = 1,
+    .tilemapTop = 1,
+    .width = DEBUG_MENU_WIDTH_PROFILER,
+    .height = 2 * DEBUG_MENU_HEIGHT_PROFILER,
+    .paletteNum = 15,
+    .baseBlock = 1,
+};
 
 // *******************************
 // List Menu Templates
@@ -2129,6 +2193,141 @@ static void DebugAction_Util_CheatStart(u8 taskId)
     LockPlayerFieldControls();
     ScriptContext_SetupScript(Debug_CheatStart);
 }
+static void DebugAction_Util_RandomizerTables(u8 taskId)
+{
+    DebugPrintRandomizerTables();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_HeapStats(u8 taskId)
+{
+    DebugPrintHeapStats();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_Dma3Stats(u8 taskId)
+{
+    DebugPrintDma3Stats();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_MixerStats(u8 taskId)
+{
+    DebugPrintSoundMixerStats();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_TimeBlendStats(u8 taskId)
+{
+    DebugPrintTimeBlendStats();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_TextBenchmark(u8 taskId)
+{
+    DebugBenchmarkTextRendering();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_CreateMonBenchmark(u8 taskId)
+{
+    DebugBenchmarkCreateMon();
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+static void DebugAction_Util_ProfilerLog(u8 taskId)
+{
+    if (IsProfilerLogging())
+        DisableProfiler();
+    else
+        EnableProfiler(TRUE);
+    Debug_DestroyMenu_Full(taskId);
+    ScriptContext_Enable();
+}
+
+// Zone names are plain ASCII so they can go straight to DebugPrintf.
+static void Debug_ProfileZoneNameToString(u8 *dest, const char *name)
+{
+    for (; *name != '\0'; name++, dest++)
+    {
+        if (*name >= 'a' && *name <= 'z')
+            *dest = CHAR_a + (*name - 'a');
+        else if (*name >= '0' && *name <= '9')
+            *dest = CHAR_0 + (*name - '0');
+        else
+            *dest = CHAR_SPACE;
+    }
+    *dest = EOS;
+}
+static u8 *Debug_FramePercentToString(u8 *dest, u32 cycles)
+{
+    u32 tenths = cycles / (DEBUG_CYCLES_PER_FRAME / 1000);
+
+    dest = ConvertIntToDecimalStringN(dest, tenths / 10, STR_CONV_MODE_LEFT_ALIGN, 4);
+    *dest++ = CHAR_PERIOD;
+    return ConvertIntToDecimalStringN(dest, tenths % 10, STR_CONV_MODE_LEFT_ALIGN, 1);
+}
+static void Debug_DrawProfilerHud(u8 windowId)
+{
+    const struct ProfileZoneStats *report = GetProfilerReport();
+    u8 *end;
+    u32 i, x, y;
+
+    FillWindowPixelBuffer(windowId, PIXEL_FILL(1));
+    AddTextPrinterParameterized(windowId, FONT_SMALL, sDebugText_Util_ProfilerHud_Header, 1, 1, TEXT_SKIP_DRAW, NULL);
+    for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+    {
+        x = 1 + (i % 2) * (DEBUG_MENU_WIDTH_PROFILER * 8 / 2);
+        y = 17 + (i / 2) * 16;
+        Debug_ProfileZoneNameToString(gStringVar1, GetProfileZoneName(i));
+        AddTextPrinterParameterized(windowId, FONT_SMALL, gStringVar1, x, y, TEXT_SKIP_DRAW, NULL);
+        end = Debug_FramePercentToString(gStringVar1, report[i].avg);
+        *end++ = CHAR_SLASH;
+        end = Debug_FramePercentToString(end, report[i].max);
+        *end++ = CHAR_PERCENT;
+        *end = EOS;
+        AddTextPrinterParameterized(windowId, FONT_SMALL, gStringVar1, x + 48, y, TEXT_SKIP_DRAW, NULL);
+    }
+    CopyWindowToVram(windowId, COPYWIN_FULL);
+}
+static void DebugAction_Util_ProfilerHud(u8 taskId)
+{
+    u8 windowId;
+
+    ClearStdWindowAndFrame(gTasks[taskId].data[1], TRUE);
+    RemoveWindow(gTasks[taskId].data[1]);
+
+    HideMapNamePopUpWindow();
+    LoadMessageBoxAndBorderGfx();
+    windowId = AddWindow(&sDebugMenuWindowTemplateProfiler);
+    DrawStdWindowFrame(windowId, FALSE);
+    Debug_DrawProfilerHud(windowId);
+
+    gTasks[taskId].func = DebugAction_Util_ProfilerHud_Update;
+    gTasks[taskId].data[2] = windowId;
+    gTasks[taskId].data[3] = GetProfilerReportCount();
+    gTasks[taskId].data[4] = IsProfilerEnabled();  //Restored on close
+    gTasks[taskId].data[5] = IsProfilerLogging();
+    EnableProfiler(gTasks[taskId].data[5]);
+}
+static void DebugAction_Util_ProfilerHud_Update(u8 taskId)
+{
+    if ((u16)gTasks[taskId].data[3] != (u16)GetProfilerReportCount())
+    {
+        gTasks[taskId].data[3] = GetProfilerReportCount();
+        Debug_DrawProfilerHud(gTasks[taskId].data[2]);
+    }
+
+    if (gMain.newKeys & B_BUTTON)
+    {
+        PlaySE(SE_SELECT);
+        if (gTasks[taskId].data[4])
+            EnableProfiler(gTasks[taskId].data[5]);
+        else
+            DisableProfiler();
+        DebugAction_DestroyExtraWindow(taskId);
+    }
+}
 
 // *******************************
 // Actions Scripts
@@ -3765,7 +3964,7 @@ static void DebugAction_Fill_PCBoxes_Fast(u8 taskId) //Credit: Sierraffinity
         {
             if (!GetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], MON_DATA_SANITY_HAS_SPECIES))
             {
-                gPokemonStoragePtr->boxes[boxId][boxPosition] = boxMon;
+                SetBoxMonAt(boxId, boxPosition, &boxMon);
             }
         }
     }
@@ -3813,7 +4012,7 @@ static void DebugAction_Fill_PCBoxes_Slow(u8 taskId)
                     i = 1;
             #endif
 
-                gPokemonStoragePtr->boxes[boxId][boxPosition] = boxMon;
+                SetBoxMonAt(boxId, boxPosition, &boxMon);
             }
         }
     }
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "berry.h"
+#include "bg.h"
 #include "bike.h"
 #include "field_camera.h"
 #include "field_player_avatar.h"
@@ -12,6 +13,12 @@
 #include "sprite.h"
 #include "text.h"
 
+// Bits 0-9 of a tilemap entry
+#define TILEMAP_ENTRY_TILE_MASK 0x3FF
+
+// Tiles along each side of the 32x32 field tilemaps
+#define FIELD_TILEMAP_SIZE 32
+
 EWRAM_DATA bool8 gUnusedBikeCameraAheadPanback = FALSE;
 
 struct FieldCameraOffset
@@ -31,6 +38,8 @@ static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *, s32, s32);
 static void DrawWholeMapViewInternal(int, int, const struct MapLayout *);
 static void DrawMetatileAt(const struct MapLayout *, u16, int, int);
 static void DrawMetatile(s32, const u16 *, u16);
+static void CountMetatileTiles(u16, s32);
+static void ScheduleFieldTilemapCopies(void);
 static void CameraPanningCB_PanAhead(void);
 
 static struct FieldCameraOffset sFieldCameraOffset;
@@ -39,6 +48,16 @@ static s16 sVerticalCameraPan;
 static bool8 sBikeCameraPanFlag;
 static void (*sFieldCameraPanningCallback)(void);
 
+// How many entries of the three field tilemap buffers use each tile, so
+// tileset animations can tell whether their tiles are anywhere in the
+// drawn part of the map.
+static EWRAM_DATA u16 sFieldTileUseCounts[NUM_TILES_TOTAL] = {0};
+
+// Rows and columns of the field tilemaps that camera movement redrew and
+// that still have to be sent to VRAM, one bit each.
+static u32 sDirtyTilemapRows;
+static u32 sDirtyTilemapColumns;
+
 struct CameraObject gFieldCamera;
 u16 gTotalCameraPixelOffsetY;
 u16 gTotalCameraPixelOffsetX;
@@ -69,6 +88,8 @@ static void AddCameraPixelOffset(struct FieldCameraOffset *cameraOffset, u32 xOf
 void ResetFieldCamera(void)
 {
     ResetCameraOffset(&sFieldCameraOffset);
+    sDirtyTilemapRows = 0;
+    sDirtyTilemapColumns = 0;
 }
 
 void FieldUpdateBgTilemapScroll(void)
@@ -91,12 +112,97 @@ void GetCameraOffsetWithPan(s16 *x, s16 *y)
     *y = sFieldCameraOffset.yPixelOffset + sVerticalCameraPan + 8;
 }
 
+static void ResetFieldTileUseCounts(void)
+{
+    u32 i;
+
+    CpuFill16(0, sFieldTileUseCounts, sizeof(sFieldTileUseCounts));
+    for (i = 0; i < BG_SCREEN_SIZE / sizeof(u16); i++)
+    {
+        sFieldTileUseCounts[gOverworldTilemapBuffer_Bg1[i] & TILEMAP_ENTRY_TILE_MASK]++;
+        sFieldTileUseCounts[gOverworldTilemapBuffer_Bg2[i] & TILEMAP_ENTRY_TILE_MASK]++;
+        sFieldTileUseCounts[gOverworldTilemapBuffer_Bg3[i] & TILEMAP_ENTRY_TILE_MASK]++;
+    }
+}
+
+bool32 IsTileRangeInFieldView(u16 firstTile, u16 numTiles)
+{
+    u32 i;
+
+    for (i = firstTile; i < firstTile + numTiles && i < NUM_TILES_TOTAL; i++)
+    {
+        if (sFieldTileUseCounts[i] != 0)
+            return TRUE;
+    }
+    return FALSE;
+}
+
 void DrawWholeMapView(void)
 {
+    // Resync with whatever the buffers hold, as they may have been
+    // reallocated or written around DrawMetatile since the last full draw.
+    ResetFieldTileUseCounts();
     DrawWholeMapViewInternal(gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y, gMapHeader.mapLayout);
+    ScheduleFieldTilemapCopies();
     sFieldCameraOffset.copyBGToVRAM = TRUE;
 }
 
+// Sends the whole of all three field tilemaps, which covers any strips
+// still waiting.
+static void ScheduleFieldTilemapCopies(void)
+{
+    sDirtyTilemapRows = 0;
+    sDirtyTilemapColumns = 0;
+    ScheduleBgCopyTilemapToVram(1);
+    ScheduleBgCopyTilemapToVram(2);
+    ScheduleBgCopyTilemapToVram(3);
+}
+
+// Called from the field vblank callback. Dirty rows are contiguous in the
+// tilemap and go by DMA, a run at a time. Columns can't be sent by DMA, so
+// the CPU copies them, two entries per word.
+void TransferFieldTilemapStrips(void)
+{
+    u16 *buffers[3];
+    u16 *vram;
+    u32 bg, mapBase, first, count, row, col;
+
+    if (sDirtyTilemapRows == 0 && sDirtyTilemapColumns == 0)
+        return;
+
+    buffers[0] = gOverworldTilemapBuffer_Bg1;
+    buffers[1] = gOverworldTilemapBuffer_Bg2;
+    buffers[2] = gOverworldTilemapBuffer_Bg3;
+    for (bg = 0; bg < ARRAY_COUNT(buffers); bg++)
+    {
+        // Skip backgrounds that are hidden or no longer show the field.
+        mapBase = GetBgAttribute(bg + 1, BG_ATTR_MAPBASEINDEX);
+        if (buffers[bg] == NULL || GetBgTilemapBuffer(bg + 1) != buffers[bg] || mapBase == 0xFF)
+            continue;
+        vram = (u16 *)BG_SCREEN_ADDR(mapBase);
+
+        for (first = 0; first < FIELD_TILEMAP_SIZE; first += count)
+        {
+            count = 1;
+            if (!(sDirtyTilemapRows & (1 << first)))
+                continue;
+            while (first + count < FIELD_TILEMAP_SIZE && (sDirtyTilemapRows & (1 << (first + count))))
+                count++;
+            DmaCopy32(3, &buffers[bg][first * FIELD_TILEMAP_SIZE], &vram[first * FIELD_TILEMAP_SIZE], count * FIELD_TILEMAP_SIZE * sizeof(u16));
+        }
+
+        for (col = 0; col < FIELD_TILEMAP_SIZE; col += 2)
+        {
+            if (!(sDirtyTilemapColumns & (3 << col)))
+                continue;
+            for (row = 0; row < FIELD_TILEMAP_SIZE; row++)
+                *(u32 *)&vram[row * FIELD_TILEMAP_SIZE + col] = *(u32 *)&buffers[bg][row * FIELD_TILEMAP_SIZE + col];
+        }
+    }
+    sDirtyTilemapRows = 0;
+    sDirtyTilemapColumns = 0;
+}
+
 static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLayout)
 {
     u8 i;
@@ -124,6 +230,11 @@ static void RedrawMapSlicesForCameraUpdate(struct FieldCameraOffset *cameraOffse
 {
     const struct MapLayout *mapLayout = gMapHeader.mapLayout;
 
+    // Strips from an earlier step that no field vblank has sent yet would
+    // otherwise pile up, so send everything the usual way instead.
+    if (sDirtyTilemapRows != 0 || sDirtyTilemapColumns != 0)
+        ScheduleFieldTilemapCopies();
+
     if (x > 0)
         RedrawMapSliceWest(cameraOffset, mapLayout);
     if (x < 0)
@@ -152,6 +263,9 @@ static void RedrawMapSliceNorth(struct FieldCameraOffset *cameraOffset, const st
             temp -= 32;
         DrawMetatileAt(mapLayout, r7 + temp, gSaveBlock1Ptr->pos.x + i / 2, gSaveBlock1Ptr->pos.y + 14);
     }
+    // Only once the strip is complete, as the vblank that sends it can
+    // come at any point.
+    sDirtyTilemapRows |= 3 << (r7 / 32);
 }
 
 static void RedrawMapSliceSouth(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
@@ -167,6 +281,7 @@ static void RedrawMapSliceSouth(struct FieldCameraOffset *cameraOffset, const st
             temp -= 32;
         DrawMetatileAt(mapLayout, r7 + temp, gSaveBlock1Ptr->pos.x + i / 2, gSaveBlock1Ptr->pos.y);
     }
+    sDirtyTilemapRows |= 3 << cameraOffset->yTileOffset;
 }
 
 static void RedrawMapSliceEast(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
@@ -182,6 +297,7 @@ static void RedrawMapSliceEast(struct FieldCameraOffset *cameraOffset, const str
             temp -= 32;
         DrawMetatileAt(mapLayout, temp * 32 + r6, gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y + i / 2);
     }
+    sDirtyTilemapColumns |= 3 << r6;
 }
 
 static void RedrawMapSliceWest(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
@@ -199,6 +315,7 @@ static void RedrawMapSliceWest(struct FieldCameraOffset *cameraOffset, const str
             temp -= 32;
         DrawMetatileAt(mapLayout, temp * 32 + r5, gSaveBlock1Ptr->pos.x + 14, gSaveBlock1Ptr->pos.y + i / 2);
     }
+    sDirtyTilemapColumns |= 3 << r5;
 }
 
 void CurrentMapDrawMetatileAt(int x, int y)
@@ -208,6 +325,7 @@ void CurrentMapDrawMetatileAt(int x, int y)
     if (offset >= 0)
     {
         DrawMetatileAt(gMapHeader.mapLayout, offset, x, y);
+        ScheduleFieldTilemapCopies();
         sFieldCameraOffset.copyBGToVRAM = TRUE;
     }
 }
@@ -219,6 +337,7 @@ void DrawDoorMetatileAt(int x, int y, u16 *tiles)
     if (offset >= 0)
     {
         DrawMetatile(METATILE_LAYER_TYPE_COVERED, tiles, offset);
+        ScheduleFieldTilemapCopies();
         sFieldCameraOffset.copyBGToVRAM = TRUE;
     }
 }
@@ -226,6 +345,9 @@ void DrawDoorMetatileAt(int x, int y, u16 *tiles)
 static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x, int y)
 {
     u16 metatileId = MapGridGetMetatileIdAt(x, y);
+    // From the ID already looked up rather than MapGridGetMetatileLayerTypeAt,
+    // which would look up the map grid block again.
+    u32 layerType = (GetMetatileAttributesById(metatileId) & METATILE_ATTR_LAYER_MASK) >> METATILE_ATTR_LAYER_SHIFT;
     const u16 *metatiles;
 
     if (metatileId > NUM_METATILES_TOTAL)
@@ -237,11 +359,29 @@ static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x,
         metatiles = mapLayout->secondaryTileset->metatiles;
         metatileId -= NUM_METATILES_IN_PRIMARY;
     }
-    DrawMetatile(MapGridGetMetatileLayerTypeAt(x, y), metatiles + metatileId * NUM_TILES_PER_METATILE, offset);
+    DrawMetatile(layerType, metatiles + metatileId * NUM_TILES_PER_METATILE, offset);
+}
+
+static void CountMetatileTiles(u16 offset, s32 delta)
+{
+    u16 *buffers[3];
+    u32 i;
+
+    buffers[0] = gOverworldTilemapBuffer_Bg1;
+    buffers[1] = gOverworldTilemapBuffer_Bg2;
+    buffers[2] = gOverworldTilemapBuffer_Bg3;
+    for (i = 0; i < ARRAY_COUNT(buffers); i++)
+    {
+        sFieldTileUseCounts[buffers[i][offset] & TILEMAP_ENTRY_TILE_MASK] += delta;
+        sFieldTileUseCounts[buffers[i][offset + 1] & TILEMAP_ENTRY_TILE_MASK] += delta;
+        sFieldTileUseCounts[buffers[i][offset + 0x20] & TILEMAP_ENTRY_TILE_MASK] += delta;
+        sFieldTileUseCounts[buffers[i][offset + 0x21] & TILEMAP_ENTRY_TILE_MASK] += delta;
+    }
 }
 
 static void DrawMetatile(s32 metatileLayerType, const u16 *tiles, u16 offset)
 {
+    CountMetatileTiles(offset, -1);
     switch (metatileLayerType)
     {
     case METATILE_LAYER_TYPE_SPLIT:
@@ -302,9 +442,7 @@ static void DrawMetatile(s32 metatileLayerType, const u16 *tiles, u16 offset)
         gOverworldTilemapBuffer_Bg1[offset + 0x21] = tiles[7];
         break;
     }
-    ScheduleBgCopyTilemapToVram(1);
-    ScheduleBgCopyTilemapToVram(2);
-    ScheduleBgCopyTilemapToVram(3);
+    CountMetatileTiles(offset, 1);
 }
 
 static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *cameraOffset, s32 x, s32 y)
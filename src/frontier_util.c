@@ -82,6 +82,10 @@ static void ShowPyramidResultsWindow(void);
 static void ShowLinkContestResultsWindow(void);
 static void CopyFrontierBrainText(bool8 playerWonText);
 
+// Species and held items already on the party a pool is drawing for.
+static EWRAM_DATA u32 sPartyExcludedSpecies[(NUM_SPECIES + 31) / 32] = {0};
+static EWRAM_DATA u32 sPartyExcludedItems[(ITEMS_COUNT + 31) / 32] = {0};
+
 // const rom data
 static const u8 sFrontierBrainStreakAppearances[NUM_FRONTIER_FACILITIES][4] =
 {
@@ -2696,3 +2700,130 @@ static void CopyFrontierBrainText(bool8 playerWonText)
         break;
     }
 }
+
+// Random party generation for the facilities that build teams from
+// gFacilityTrainerMons. The caller fills a pool with the mons allowed for the
+// facility and level mode, then draws from it without replacement. A party
+// can't repeat a species or a held item other than ITEM_NONE, and rather than
+// retrying until a draw fits, a candidate that clashes with the party is
+// dropped from the pool the first time it's drawn, so a party costs at most
+// one Random() per candidate.
+void InitFrontierMonPool(struct FrontierMonPool *pool)
+{
+    memset(pool, 0, sizeof(*pool));
+}
+
+void AddFrontierMonToPool(struct FrontierMonPool *pool, u16 monId)
+{
+    AGB_ASSERT(monId < NUM_FRONTIER_MONS);
+    if (monId >= NUM_FRONTIER_MONS || (pool->added[monId / 32] & (1u << (monId % 32))))
+        return;
+
+    pool->added[monId / 32] |= 1u << (monId % 32);
+    pool->remaining[monId / 32] |= 1u << (monId % 32);
+    pool->count++;
+}
+
+void ClearFrontierPartyExclusions(void)
+{
+    memset(sPartyExcludedSpecies, 0, sizeof(sPartyExcludedSpecies));
+    memset(sPartyExcludedItems, 0, sizeof(sPartyExcludedItems));
+}
+
+void ExcludeFrontierPartySpeciesAndItem(u16 species, u16 heldItem)
+{
+    if (species < NUM_SPECIES)
+        sPartyExcludedSpecies[species / 32] |= 1u << (species % 32);
+    if (heldItem != ITEM_NONE && heldItem < ITEMS_COUNT)
+        sPartyExcludedItems[heldItem / 32] |= 1u << (heldItem % 32);
+}
+
+static bool32 IsFrontierSpeciesExcluded(u16 species)
+{
+    return species < NUM_SPECIES && (sPartyExcludedSpecies[species / 32] & (1u << (species % 32)));
+}
+
+static bool32 IsFrontierPartyExcluded(u16 species, u16 heldItem)
+{
+    if (IsFrontierSpeciesExcluded(species))
+        return TRUE;
+    if (heldItem != ITEM_NONE && heldItem < ITEMS_COUNT && (sPartyExcludedItems[heldItem / 32] & (1u << (heldItem % 32))))
+        return TRUE;
+    return FALSE;
+}
+
+static u32 CountSetBits(u32 bits)
+{
+    u32 count = 0;
+
+    while (bits != 0)
+    {
+        bits &= bits - 1;
+        count++;
+    }
+    return count;
+}
+
+// Returns the monId of the nth bit set in mask, counting from 0.
+static u16 GetNthFrontierPoolMon(const u32 *mask, u32 n)
+{
+    u32 i, bits, count;
+
+    for (i = 0; i < FRONTIER_POOL_WORDS; i++)
+    {
+        count = CountSetBits(mask[i]);
+        if (n < count)
+            break;
+        n -= count;
+    }
+    bits = mask[i];
+    while (n-- != 0)
+        bits &= bits - 1;
+    for (count = 0; !(bits & 1); count++)
+        bits >>= 1;
+    return i * 32 + count;
+}
+
+// Only reached when a pool has fewer usable mons than a party needs, which
+// the facility tables never allow; tools/battle_sim --frontier-parties checks
+// it on the host. The slot is still filled, with the first mon the pool
+// already dropped whose species isn't on the party, or else the first mon in
+// the pool, so no party is left with stale or empty slots.
+static u16 GetFrontierPoolFallbackMon(const struct FrontierMonPool *pool)
+{
+    u16 monId;
+    u16 firstMonId = NUM_FRONTIER_MONS;
+
+    DebugPrintf("frontier: mon pool ran out, reusing a dropped mon");
+    for (monId = 0; monId < NUM_FRONTIER_MONS; monId++)
+    {
+        if (!(pool->added[monId / 32] & (1u << (monId % 32))))
+            continue;
+        if (firstMonId == NUM_FRONTIER_MONS)
+            firstMonId = monId;
+        if (!IsFrontierSpeciesExcluded(gFacilityTrainerMons[monId].species))
+            return monId;
+    }
+    return firstMonId != NUM_FRONTIER_MONS ? firstMonId : 0;
+}
+
+// Always returns a mon, see GetFrontierPoolFallbackMon.
+u16 DrawFrontierMonFromPool(struct FrontierMonPool *pool)
+{
+    while (pool->count != 0)
+    {
+        u16 monId = GetNthFrontierPoolMon(pool->remaining, Random() % pool->count);
+        u16 species = gFacilityTrainerMons[monId].species;
+        u16 heldItem = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+
+        // Drawn or not, this candidate can't be picked again.
+        pool->remaining[monId / 32] &= ~(1u << (monId % 32));
+        pool->count--;
+        if (!IsFrontierPartyExcluded(species, heldItem))
+        {
+            ExcludeFrontierPartySpeciesAndItem(species, heldItem);
+            return monId;
+        }
+    }
+    return GetFrontierPoolFallbackMon(pool);
+}
@@ -34,6 +34,7 @@ EWRAM_DATA struct BagPocket gBagPockets[POCKETS_COUNT] = {0};
 // rodata
 #include "data/text/item_descriptions.h"
 #include "data/items.h"
+#include "data/item_name_ranks.h"
 
 // code
 u16 GetBagItemQuantity(u16 *quantity)
@@ -657,40 +658,73 @@ static void SwapItemSlots(struct ItemSlot *a, struct ItemSlot *b)
     SWAP(*a, *b, temp);
 }
 
-void CompactItemsInBagPocket(struct BagPocket *bagPocket)
+// Moves the empty slots to the end of the pocket in one pass, keeping the
+// items in the order they were in, and returns how many items there are.
+static u32 CompactBagPocket(struct BagPocket *bagPocket)
 {
-    u16 i, j;
+    u32 i, count = 0;
 
-    for (i = 0; i < bagPocket->capacity - 1; i++)
+    for (i = 0; i < bagPocket->capacity; i++)
     {
-        for (j = i + 1; j < bagPocket->capacity; j++)
+        if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) != 0)
         {
-            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) == 0)
-                SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
+            if (i != count)
+                SwapItemSlots(&bagPocket->itemSlots[count], &bagPocket->itemSlots[i]);
+            count++;
         }
     }
+    return count;
 }
 
-void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
+void CompactItemsInBagPocket(struct BagPocket *bagPocket)
 {
-    u16 i, j;
+    CompactBagPocket(bagPocket);
+}
 
-    for (i = 0; i < bagPocket->capacity - 1; i++)
+// Sorts the items in a pocket by the key getSortKey returns for each,
+// lowest first, and moves the empty slots to the end. Items with the same
+// key keep their order. Keys are worked out once per item, and since a
+// pocket holds at most BAG_ITEMS_COUNT items and is usually sorted already,
+// an insertion sort on them beats anything fancier.
+void SortBagPocket(struct BagPocket *bagPocket, u32 (*getSortKey)(u16 itemId, u16 quantity))
+{
+    u32 keys[BAG_ITEMS_COUNT];
+    struct ItemSlot slot;
+    u32 i, j, key, count;
+
+    count = CompactBagPocket(bagPocket);
+    if (count > ARRAY_COUNT(keys))
+        count = ARRAY_COUNT(keys);
+
+    for (i = 0; i < count; i++)
+        keys[i] = getSortKey(bagPocket->itemSlots[i].itemId, GetBagItemQuantity(&bagPocket->itemSlots[i].quantity));
+
+    for (i = 1; i < count; i++)
     {
-        for (j = i + 1; j < bagPocket->capacity; j++)
+        key = keys[i];
+        if (keys[i - 1] <= key)
+            continue;
+        slot = bagPocket->itemSlots[i];
+        for (j = i; j > 0 && keys[j - 1] > key; j--)
         {
-            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) != 0)
-            {
-                if (GetBagItemQuantity(&bagPocket->itemSlots[j].quantity) == 0)
-                    continue;
-                if (bagPocket->itemSlots[i].itemId <= bagPocket->itemSlots[j].itemId)
-                    continue;
-            }
-            SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
+            keys[j] = keys[j - 1];
+            bagPocket->itemSlots[j] = bagPocket->itemSlots[j - 1];
         }
+        keys[j] = key;
+        bagPocket->itemSlots[j] = slot;
     }
 }
 
+static u32 GetItemIdSortKey(u16 itemId, u16 quantity)
+{
+    return itemId;
+}
+
+void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
+{
+    SortBagPocket(bagPocket, GetItemIdSortKey);
+}
+
 void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
 {
     // dumb assignments needed to match
@@ -937,6 +971,12 @@ const u8 *ItemId_GetName(u16 itemId)
     return gItems[SanitizeItemId(itemId)].name;
 }
 
+// Position of the item's name in alphabetical order
+u16 ItemId_GetNameRank(u16 itemId)
+{
+    return sItemNameRanks[SanitizeItemId(itemId)];
+}
+
 // Unused
 u16 ItemId_GetId(u16 itemId)
 {
@@ -230,11 +230,9 @@ static void ItemMenu_SortByAmount(u8 taskId);
 static void SortBagItems(u8 taskId);
 static void Task_SortFinish(u8 taskId);
 static void SortItemsInBag(u8 pocket, u8 type);
-static void MergeSort(struct ItemSlot* array, u32 low, u32 high, s8 (*comparator)(struct ItemSlot*, struct ItemSlot*));
-static void Merge(struct ItemSlot* array, u32 low, u32 mid, u32 high, s8 (*comparator)(struct ItemSlot*, struct ItemSlot*));
-static s8 CompareItemsAlphabetically(struct ItemSlot* itemSlot1, struct ItemSlot* itemSlot2);
-static s8 CompareItemsByMost(struct ItemSlot* itemSlot1, struct ItemSlot* itemSlot2);
-static s8 CompareItemsByType(struct ItemSlot* itemSlot1, struct ItemSlot* itemSlot2);
+static u32 GetItemSortKeyByName(u16 itemId, u16 quantity);
+static u32 GetItemSortKeyByAmount(u16 itemId, u16 quantity);
+static u32 GetItemSortKeyByType(u16 itemId, u16 quantity);
 
 static const struct BgTemplate sBgTemplates_ItemMenu[] =
 {
@@ -3398,148 +3396,36 @@ static void Task_SortFinish(u8 taskId)
 
 static void SortItemsInBag(u8 pocket, u8 type)
 {
-    struct ItemSlot* itemMem;
-    u16 itemAmount;
-    s8 (*func)(struct ItemSlot*, struct ItemSlot*);
-
-    switch (pocket)
-    {
-    case ITEMS_POCKET:
-        itemMem = gSaveBlock1Ptr->bagPocket_Items;
-        itemAmount = BAG_ITEMS_COUNT;
-        break;
-    case KEYITEMS_POCKET:
-        itemMem = gSaveBlock1Ptr->bagPocket_KeyItems;
-        itemAmount = BAG_KEYITEMS_COUNT;
-        break;
-    case BALLS_POCKET:
-        itemMem = gSaveBlock1Ptr->bagPocket_PokeBalls;
-        itemAmount = BAG_POKEBALLS_COUNT;
-        break;
-    case BERRIES_POCKET:
-        itemMem = gSaveBlock1Ptr->bagPocket_Berries;
-        itemAmount = BAG_BERRIES_COUNT;
-        break;
-    case TMHM_POCKET:
-        itemMem = gSaveBlock1Ptr->bagPocket_TMHM;
-        itemAmount = BAG_TMHM_COUNT;
-        break;
-    default:
+    if (pocket >= POCKETS_COUNT)
         return;
-    }
 
     switch (type)
     {
     case SORT_ALPHABETICALLY:
-        MergeSort(itemMem, 0, itemAmount - 1, CompareItemsAlphabetically);
+        SortBagPocket(&gBagPockets[pocket], GetItemSortKeyByName);
         break;
     case SORT_BY_AMOUNT:
-        MergeSort(itemMem, 0, itemAmount - 1, CompareItemsByMost);
+        SortBagPocket(&gBagPockets[pocket], GetItemSortKeyByAmount);
         break;
     default:
-        MergeSort(itemMem, 0, itemAmount - 1, CompareItemsByType);
+        SortBagPocket(&gBagPockets[pocket], GetItemSortKeyByType);
         break;
     }
 }
 
-static void MergeSort(struct ItemSlot* array, u32 low, u32 high, s8 (*comparator)(struct ItemSlot*, struct ItemSlot*))
-{
-    u32 mid;
-    
-    if (high <= low)
-        return;
-
-    mid = low + (high - low) / 2;
-    MergeSort(array, low, mid, comparator); //Sort left half.
-    MergeSort(array, mid + 1, high, comparator); //Sort right half.
-    Merge(array, low, mid, high, comparator); //Merge results.
-}
-
-static void Merge(struct ItemSlot* array, u32 low, u32 mid, u32 high, s8 (*comparator)(struct ItemSlot*, struct ItemSlot*))
-{
-    u32 i = low;
-    u32 j = mid + 1;
-    u32 k;
-    struct ItemSlot aux[high + 1];
-
-    for (k = low; k <= high; ++k)
-        aux[k] = array[k];
-
-    for (k = low; k <= high; ++k)
-    { //Merge back to a[low..high]
-        if (i > mid)
-            array[k] = aux[j++];
-        else if (j > high)
-            array[k] = aux[i++];
-        else if (comparator(&aux[j], &aux[i]) < 0)
-            array[k] = aux[j++];
-        else
-            array[k] = aux[i++];
-    }
-}
-
-static s8 CompareItemsAlphabetically(struct ItemSlot* itemSlot1, struct ItemSlot* itemSlot2)
+static u32 GetItemSortKeyByName(u16 itemId, u16 quantity)
 {
-    u16 item1 = itemSlot1->itemId;
-    u16 item2 = itemSlot2->itemId;
-    int i;
-    const u8 *name1;
-    const u8 *name2;
-
-    if (item1 == ITEM_NONE)
-        return 1;
-    else if (item2 == ITEM_NONE)
-        return -1;
-
-    name1 = ItemId_GetName(item1);
-    name2 = ItemId_GetName(item2);
-
-    for (i = 0; ; ++i)
-    {
-        if (name1[i] == EOS && name2[i] != EOS)
-            return -1;
-        else if (name1[i] != EOS && name2[i] == EOS)
-            return 1;
-        else if (name1[i] == EOS && name2[i] == EOS)
-            return 0;
-
-        if (name1[i] < name2[i])
-            return -1;
-        else if (name1[i] > name2[i])
-            return 1;
-    }
-
-    return 0; //Will never be reached
+    return ItemId_GetNameRank(itemId);
 }
 
-static s8 CompareItemsByMost(struct ItemSlot* itemSlot1, struct ItemSlot* itemSlot2)
+// Greatest amount first, then alphabetically
+static u32 GetItemSortKeyByAmount(u16 itemId, u16 quantity)
 {
-    u16 quantity1 = GetBagItemQuantity(&itemSlot1->quantity);
-    u16 quantity2 = GetBagItemQuantity(&itemSlot2->quantity);
-
-    if (itemSlot1->itemId == ITEM_NONE)
-        return 1;
-    else if (itemSlot2->itemId == ITEM_NONE)
-        return -1;
-
-    if (quantity1 < quantity2)
-        return 1;
-    else if (quantity1 > quantity2)
-        return -1;
-
-    return CompareItemsAlphabetically(itemSlot1, itemSlot2); //Items have same quantity so sort alphabetically
+    return ((u32)(0xFFFF - quantity) << 16) | ItemId_GetNameRank(itemId);
 }
 
-static s8 CompareItemsByType(struct ItemSlot* itemSlot1, struct ItemSlot* itemSlot2)
+// By type, then alphabetically
+static u32 GetItemSortKeyByType(u16 itemId, u16 quantity)
 {
-    //Null items go last
-    u8 type1 = (itemSlot1->itemId == ITEM_NONE) ? 0xFF : sItemsByType[itemSlot1->itemId];
-    u8 type2 = (itemSlot2->itemId == ITEM_NONE) ? 0xFF : sItemsByType[itemSlot2->itemId];
-
-    if (type1 < type2)
-        return -1;
-    else if (type1 > type2)
-        return 1;
-
-    return CompareItemsAlphabetically(itemSlot1, itemSlot2); //Items are of same type so sort alphabetically
+    return ((u32)sItemsByType[itemId] << 16) | ItemId_GetNameRank(itemId);
 }
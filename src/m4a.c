@@ -5,6 +5,24 @@ extern const u8 gCgb3Vol[];
 
 #define BSS_CODE __attribute__((section(".bss.code")))
 
+// SoundMainRAM's cost grows with every DirectSound channel it mixes. A
+// caller can opt in to a budget with m4aSoundSetMixBudget, and the playing
+// channels are then cut down to it before the mixer runs. The mixer is timed
+// in scanlines, like the DMA3 queue.
+#define CYCLES_PER_SCANLINE 1232
+#define TOTAL_SCANLINES 228
+// A channel is mixed for at least this many vblanks before it can be
+// stolen, so a new note is never cut before it is heard.
+#define SOUND_MIX_MIN_CHANNEL_AGE 2
+
+struct SoundMixBudget
+{
+    u32 maxCycles;
+    u32 baseCycles;
+    u8 maxVoices;
+    u8 stealPolicy;
+};
+
 BSS_CODE ALIGNED(4) char SoundMainRAM_Buffer[0xB40] = {0};
 BSS_CODE ALIGNED(4) u32 hq_buffer_ptr[0x130] = {0};
 
@@ -21,6 +39,10 @@ struct MusicPlayerInfo gMPlayInfo_SE2;
 struct MusicPlayerInfo gMPlayInfo_SE3;
 u8 gMPlayMemAccArea[0x10];
 
+static EWRAM_DATA struct SoundMixBudget sSoundMixBudget = {0};
+static EWRAM_DATA u8 sSoundChannelAge[MAX_DIRECTSOUND_CHANNELS] = {0};
+EWRAM_DATA struct SoundMixerStats gSoundMixerStats = {0};
+
 u32 MidiKeyToFreq(struct WaveData *wav, u8 key, u8 fineAdjust)
 {
     u32 val1;
@@ -81,6 +103,9 @@ void m4aSoundInit(void)
                | (12 << SOUND_MODE_MASVOL_SHIFT)
                | (15 << SOUND_MODE_MAXCHN_SHIFT));
 
+    sSoundMixBudget.baseCycles = 0xFFFFFFFF;
+    m4aSoundSetMixBudget(MAX_DIRECTSOUND_CHANNELS, 0, SOUND_MIX_STEAL_QUIETEST);
+
     for (i = 0; i < NUM_MUSIC_PLAYERS; i++)
     {
         struct MusicPlayerInfo *mplayInfo = gMPlayTable[i].info;
@@ -100,9 +125,153 @@ void m4aSoundInit(void)
     }
 }
 
+// maxVoices caps the DirectSound channels mixed at once, and maxCycles (0
+// for none) the time the mixer may take per vblank. Channels over either
+// limit are stopped, lowest priority first, then those already releasing,
+// then the quietest or oldest depending on stealPolicy. By default there is
+// no budget: every channel is mixed and none is stolen.
+//
+// maxCycles is compared against an estimate that is only accurate to a
+// scanline, counts interrupts taken while mixing, and splits the cost
+// evenly over the channels, so calibrate a cycle limit on hardware first.
+void m4aSoundSetMixBudget(u8 maxVoices, u32 maxCycles, u8 stealPolicy)
+{
+    if (maxVoices == 0 || maxVoices > MAX_DIRECTSOUND_CHANNELS)
+        maxVoices = MAX_DIRECTSOUND_CHANNELS;
+
+    sSoundMixBudget.maxVoices = maxVoices;
+    sSoundMixBudget.maxCycles = maxCycles;
+    sSoundMixBudget.stealPolicy = stealPolicy;
+    gSoundMixerStats.voiceLimit = maxVoices;
+}
+
+// Lower scores are stolen first.
+static u32 GetSoundChannelStealScore(struct SoundChannel *chan, u8 age)
+{
+    u32 score = chan->priority << 17;
+
+    if ((chan->statusFlags & SOUND_CHANNEL_SF_ENV) != SOUND_CHANNEL_SF_ENV_RELEASE
+     && !(chan->statusFlags & SOUND_CHANNEL_SF_STOP))
+        score |= 1 << 16;
+
+    if (sSoundMixBudget.stealPolicy == SOUND_MIX_STEAL_OLDEST)
+        score |= 0xFF - age;
+    else
+        score |= chan->envelopeVolumeRight + chan->envelopeVolumeLeft;
+
+    return score;
+}
+
+static u32 BudgetSoundChannels(struct SoundInfo *soundInfo)
+{
+    struct SoundChannel *chan;
+    u32 active = 0;
+    u32 score;
+    u32 victimScore = 0;
+    s32 victim;
+    s32 i;
+
+    chan = &soundInfo->chans[0];
+    for (i = 0; i < soundInfo->maxChans; i++, chan++)
+    {
+        if (!(chan->statusFlags & SOUND_CHANNEL_SF_ON))
+            continue;
+
+        if (chan->statusFlags & SOUND_CHANNEL_SF_START)
+            sSoundChannelAge[i] = 0;
+        else if (sSoundChannelAge[i] != 0xFF)
+            sSoundChannelAge[i]++;
+        active++;
+    }
+
+    while (active > gSoundMixerStats.voiceLimit)
+    {
+        victim = -1;
+        chan = &soundInfo->chans[0];
+        for (i = 0; i < soundInfo->maxChans; i++, chan++)
+        {
+            if (!(chan->statusFlags & SOUND_CHANNEL_SF_ON) || sSoundChannelAge[i] < SOUND_MIX_MIN_CHANNEL_AGE)
+                continue;
+
+            score = GetSoundChannelStealScore(chan, sSoundChannelAge[i]);
+            if (victim < 0 || score < victimScore)
+            {
+                victim = i;
+                victimScore = score;
+            }
+        }
+
+        if (victim < 0)
+            break;
+
+        chan = &soundInfo->chans[victim];
+        chan->statusFlags = 0;
+        ClearChain(chan);
+        gSoundMixerStats.steals++;
+        active--;
+    }
+
+    return active;
+}
+
+static void UpdateSoundMixBudget(u32 cycles, u32 active)
+{
+    struct SoundMixBudget *budget = &sSoundMixBudget;
+    u32 limit;
+
+    gSoundMixerStats.cycles = cycles;
+    gSoundMixerStats.activeChans = active;
+    if (cycles > gSoundMixerStats.peakCycles)
+        gSoundMixerStats.peakCycles = cycles;
+    if (active > gSoundMixerStats.peakActiveChans)
+        gSoundMixerStats.peakActiveChans = active;
+
+    // The cheapest vblank seen is taken as the mixer's fixed cost (the
+    // sequencer, reverb and buffer clearing), and whatever is above it is
+    // split over the channels that were mixed.
+    if (cycles < budget->baseCycles)
+        budget->baseCycles = cycles;
+    if (active != 0)
+        gSoundMixerStats.cyclesPerVoice = (gSoundMixerStats.cyclesPerVoice * 3 + (cycles - budget->baseCycles) / active) / 4;
+
+    limit = budget->maxVoices;
+    if (budget->maxCycles != 0 && gSoundMixerStats.cyclesPerVoice != 0)
+    {
+        u32 affordable = 0;
+
+        if (budget->maxCycles > budget->baseCycles)
+            affordable = (budget->maxCycles - budget->baseCycles) / gSoundMixerStats.cyclesPerVoice;
+        if (affordable < limit)
+            limit = affordable;
+    }
+    if (limit == 0)
+        limit = 1;
+    gSoundMixerStats.voiceLimit = limit;
+}
+
 void m4aSoundMain(void)
 {
+    struct SoundInfo *soundInfo = SOUND_INFO_PTR;
+    u32 active;
+    u32 startLine;
+    u32 lines;
+
+    // SoundMain does nothing while the main loop holds the lock, and
+    // neither does the budget.
+    if (soundInfo->ident != ID_NUMBER)
+    {
+        SoundMain();
+        return;
+    }
+
+    soundInfo->ident++;
+    active = BudgetSoundChannels(soundInfo);
+    soundInfo->ident = ID_NUMBER;
+
+    startLine = REG_VCOUNT & 0xFF;
     SoundMain();
+    lines = ((REG_VCOUNT & 0xFF) + TOTAL_SCANLINES - startLine) % TOTAL_SCANLINES;
+    UpdateSoundMixBudget(lines * CYCLES_PER_SCANLINE, active);
 }
 
 void m4aSongNumStart(u16 n)
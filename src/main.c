@@ -23,6 +23,7 @@
 #include "intro.h"
 #include "main.h"
 #include "trainer_hill.h"
+#include "profiler.h"
 #include "constants/rgb.h"
 
 static void VBlankIntr(void);
@@ -128,6 +129,7 @@ void AgbMain()
 #endif
     for (;;)
     {
+        ProfilerEndFrame();
         ReadKeys();
 
         if (gSoftResetDisabled == FALSE
@@ -162,7 +164,7 @@ void AgbMain()
 
         PlayTimeCounter_Update();
         MapMusicMain();
-        WaitForVBlank();
+        PROFILE_ZONE(PROFILE_ZONE_WAIT_VBLANK, WaitForVBlank());
     }
 }
 
@@ -187,10 +189,10 @@ static void InitMainCallbacks(void)
 static void CallCallbacks(void)
 {
     if (gMain.callback1)
-        gMain.callback1();
+        PROFILE_ZONE(PROFILE_ZONE_CB1, gMain.callback1());
 
     if (gMain.callback2)
-        gMain.callback2();
+        PROFILE_ZONE(PROFILE_ZONE_CB2, gMain.callback2());
 }
 
 void SetMainCallback2(MainCallback callback)
@@ -336,6 +338,8 @@ void SetSerialCallback(IntrCallback callback)
 
 static void VBlankIntr(void)
 {
+    ProfilerBeginZone(PROFILE_ZONE_VBLANK);
+
     if (gWirelessCommType != 0)
         RfuVSync();
     else if (gLinkVSyncDisabled == FALSE)
@@ -347,16 +351,16 @@ static void VBlankIntr(void)
         (*gTrainerHillVBlankCounter)++;
 
     if (gMain.vblankCallback)
-        gMain.vblankCallback();
+        PROFILE_ZONE(PROFILE_ZONE_VBLANK_CB, gMain.vblankCallback());
 
     gMain.vblankCounter2++;
 
     CopyBufferedValuesToGpuRegs();
-    ProcessDma3Requests();
+    PROFILE_ZONE(PROFILE_ZONE_DMA3, ProcessDma3Requests());
 
     gPcmDmaCounter = gSoundInfo.pcmDmaCounter;
 
-    m4aSoundMain();
+    PROFILE_ZONE(PROFILE_ZONE_M4A, m4aSoundMain());
     TryReceiveLinkBattleData();
 
     if (!gMain.inBattle || !(gBattleTypeFlags & (BATTLE_TYPE_LINK | BATTLE_TYPE_FRONTIER | BATTLE_TYPE_RECORDED)))
@@ -364,6 +368,8 @@ static void VBlankIntr(void)
 
     UpdateWirelessStatusIndicatorSprite();
 
+    ProfilerEndZone(PROFILE_ZONE_VBLANK);
+
     INTR_CHECK |= INTR_FLAG_VBLANK;
     gMain.intrCheck |= INTR_FLAG_VBLANK;
 }
@@ -24,6 +24,7 @@
 #include "text.h"
 #include "overworld.h"
 #include "mail.h"
+#include "battle_main.h"
 #include "battle_records.h"
 #include "item.h"
 #include "pokedex.h"
@@ -243,6 +244,8 @@ void NewGameInitData(void)
     ResetTrainerHillResults();
     ResetContestLinkResults();
     RandomizeTypeEffectivenessListEWRAM(Random32());
+    BuildTypeEffectivenessMatrix();
+    BuildRandomizerTables();
     if ((gSaveBlock1Ptr->tx_Nuzlocke_EasyMode) && (gSaveBlock1Ptr->tx_Challenges_Nuzlocke))
         gSaveBlock1Ptr->tx_Nuzlocke_EasyMode = 0;
 
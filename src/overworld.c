@@ -1,6 +1,7 @@
 #include "global.h"
 #include "overworld.h"
 #include "battle_pyramid.h"
+#include "battle_main.h"
 #include "battle_setup.h"
 #include "berry.h"
 #include "bg.h"
@@ -100,6 +101,10 @@ struct CableClubPlayer
 #define FACING_FORCED_LEFT 9
 #define FACING_FORCED_RIGHT 10
 
+// When the clock moves the time blend, this many palettes are re-blended
+// per frame instead of all of them at once.
+#define TIME_BLEND_PALETTES_PER_FRAME 4
+
 extern const struct MapLayout *const gMapLayouts[];
 extern const struct MapHeader *const *const gMapGroups[];
 
@@ -212,6 +217,7 @@ EWRAM_DATA static struct WarpData sFixedHoleWarp = {0};
 EWRAM_DATA static u16 sLastMapSectionId = 0;
 EWRAM_DATA static struct InitialPlayerAvatarState sInitialPlayerAvatarState = {0};
 EWRAM_DATA static u16 sAmbientCrySpecies = 0;
+EWRAM_DATA static u32 sTimeBlendPendingPalettes = 0;
 EWRAM_DATA static bool8 sIsAmbientCryWaterMon = FALSE;
 EWRAM_DATA struct LinkPlayerObjectEvent gLinkPlayerObjectEvents[4] = {0};
 
@@ -1807,10 +1813,8 @@ void UpdatePalettesWithTime(u32 palettes)
     palettes &= PALETTES_MAP | PALETTES_OBJECTS; // Don't blend UI pals
     if (!palettes)
       return;
-    TimeMixPalettes(
+    TimeMixPalettesCached(
         palettes,
-        gPlttBufferUnfaded,
-        gPlttBufferFaded,
         (struct BlendSettings *)&gTimeOfDayBlend[currentTimeBlend.time0],
         (struct BlendSettings *)&gTimeOfDayBlend[currentTimeBlend.time1],
         currentTimeBlend.weight
@@ -1818,14 +1822,31 @@ void UpdatePalettesWithTime(u32 palettes)
     }
 }
 
+// Spreads a change of the time blend over several frames. The blend moves
+// by at most a few steps a minute, so palettes being a frame or two apart
+// isn't visible, where blending all 32 at once is a frame time spike.
+static void UpdatePendingPalettesWithTime(void)
+{
+    u32 palettes = 0;
+    u32 lowest;
+    u32 i;
+
+    for (i = 0; i < TIME_BLEND_PALETTES_PER_FRAME && sTimeBlendPendingPalettes; i++)
+    {
+        lowest = sTimeBlendPendingPalettes & -sTimeBlendPendingPalettes;
+        palettes |= lowest;
+        sTimeBlendPendingPalettes &= ~lowest;
+    }
+    UpdateAltBgPalettes(palettes & PALETTES_BG);
+    UpdatePalettesWithTime(palettes);
+}
+
 u8 UpdateSpritePaletteWithTime(u8 paletteNum) {
   if (MapHasNaturalLight(gMapHeader.mapType)) {
         if (IS_BLEND_IMMUNE_TAG(GetSpritePaletteTagByPaletteNum(paletteNum)))
         return paletteNum;
-    TimeMixPalettes(
-        1,
-        &gPlttBufferUnfaded[OBJ_PLTT_ID(paletteNum)],
-        &gPlttBufferFaded[OBJ_PLTT_ID(paletteNum)],
+    TimeMixPalettesCached(
+        1 << (16 + paletteNum),
         (struct BlendSettings *)&gTimeOfDayBlend[currentTimeBlend.time0],
         (struct BlendSettings *)&gTimeOfDayBlend[currentTimeBlend.time1],
         currentTimeBlend.weight
@@ -1845,8 +1866,11 @@ static void OverworldBasic(void)
     UpdatePaletteFade();
     UpdateTilesetAnimations();
     DoScheduledBgTilemapCopiesToVram();
+    // A palette fade re-blends everything itself
+    if (gPaletteFade.active)
+        sTimeBlendPendingPalettes = 0;
     // Every minute if no palette fade is active, update TOD blending as needed
-    if (!gPaletteFade.active && ++gTimeUpdateCounter >= 3600) {
+    else if (++gTimeUpdateCounter >= 3600) {
       struct TimeBlendSettings cachedBlend = {
             .time0 = currentTimeBlend.time0,
             .time1 = currentTimeBlend.time1,
@@ -1858,10 +1882,11 @@ static void OverworldBasic(void)
             || cachedBlend.time1 != currentTimeBlend.time1
             || cachedBlend.weight != currentTimeBlend.weight)
         {
-           UpdateAltBgPalettes(PALETTES_BG);
-           UpdatePalettesWithTime(PALETTES_ALL);
+           sTimeBlendPendingPalettes = PALETTES_ALL;
         }
     }
+    if (sTimeBlendPendingPalettes)
+        UpdatePendingPalettesWithTime();
 }
 
 // This CB2 is used when starting
@@ -2178,6 +2203,8 @@ void CB2_ContinueSavedGame(void)
     ScriptContext_Init();
     UnlockPlayerFieldControls();
     InitMatchCallCounters();
+    BuildTypeEffectivenessMatrix();
+    BuildRandomizerTables();
     if (UseContinueGameWarp() == TRUE)
     {
         ClearContinueGameWarpStatus();
@@ -2229,6 +2256,7 @@ static void VBlankCB_Field(void)
     ProcessSpriteCopyRequests();
     ScanlineEffect_InitHBlankDmaTransfer();
     FieldUpdateBgTilemapScroll();
+    TransferFieldTilemapStrips();
     TransferPlttBuffer();
     TransferTilesetAnimsBuffer();
 }
@@ -4,6 +4,7 @@
 #include "decompress.h"
 #include "gpu_regs.h"
 #include "task.h"
+#include "profiler.h"
 #include "constants/rgb.h"
 
 enum
@@ -44,6 +45,17 @@ struct PaletteStruct
     u8 countdown2;
 };
 
+// The last time blend of each palette slot, with the inputs it came from.
+struct TimeBlendCacheEntry
+{
+    u32 src[PLTT_SIZE_4BPP / sizeof(u32)];
+    u32 blended[PLTT_SIZE_4BPP / sizeof(u32)];
+    struct BlendSettings *blend0;
+    struct BlendSettings *blend1;
+    u16 weight;
+    bool16 valid;
+};
+
 static void PaletteStruct_Copy(struct PaletteStruct *, u32 *);
 static void PaletteStruct_Blend(struct PaletteStruct *, u32 *);
 static void PaletteStruct_TryEnd(struct PaletteStruct *);
@@ -66,6 +78,8 @@ static EWRAM_DATA struct PaletteStruct sPaletteStructs[NUM_PALETTE_STRUCTS] = {0
 EWRAM_DATA struct PaletteFadeControl gPaletteFade = {0};
 static EWRAM_DATA u32 sFiller = 0;
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
+static EWRAM_DATA struct TimeBlendCacheEntry sTimeBlendCache[PLTT_BUFFER_SIZE / 16] = {0};
+EWRAM_DATA struct TimeBlendStats gTimeBlendStats = {0};
 EWRAM_DATA u8 ALIGNED(2) gPaletteDecompressionBuffer[PLTT_SIZE] = {0};
 
 static const struct PaletteStructTemplate sDummyPaletteStructTemplate = {
@@ -117,10 +131,12 @@ void TransferPlttBuffer(void)
     {
         void *src = gPlttBufferFaded;
         void *dest = (void *)PLTT;
+        ProfilerBeginZone(PROFILE_ZONE_TRANSFER_PLTT);
         DmaCopy16(3, src, dest, PLTT_SIZE);
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
+        ProfilerEndZone(PROFILE_ZONE_TRANSFER_PLTT);
     }
 }
 
@@ -521,7 +537,7 @@ static u8 UpdateTimeOfDayPaletteFade(void)
     } else { // tile palettes, don't blend [13, 15]
         timePalettes = selectedPalettes & PALETTES_MAP;
     }
-    TimeMixPalettes(timePalettes, src, dst, gPaletteFade.bld0, gPaletteFade.bld1, gPaletteFade.weight);
+    TimeMixPalettesCached((u32)timePalettes << (paletteOffset / 16), gPaletteFade.bld0, gPaletteFade.bld1, gPaletteFade.weight);
 
     // palettes that were not blended above must be copied through
     if ((copyPalettes = ~timePalettes)) {
@@ -999,7 +1015,7 @@ static bool8 IsSoftwarePaletteFadeFinishing(void)
 }
 
 // optimized based on lucktyphlosion's BlendPalettesFine
-void BlendPalettesFine(u32 palettes, u16 *src, u16 *dst, u32 coeff, u32 color) {
+IWRAM_FUNC(BlendPalettesFine) void BlendPalettesFine(u32 palettes, u16 *src, u16 *dst, u32 coeff, u32 color) {
     s32 newR, newG, newB;
 
     if (!palettes)
@@ -1040,7 +1056,7 @@ void BlendPalettes(u32 palettes, u8 coeff, u16 color) {
 
 // Like BlendPalette, but ignores blendColor if the transparency high bit is set
 // Optimization help by lucktyphlosion
-void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor) {
+IWRAM_FUNC(TimeBlendPalette) void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor) {
     s32 newR, newG, newB, defR, defG, defB;
     u16 * src = gPlttBufferUnfaded + palOffset;
     u16 * dst = gPlttBufferFaded + palOffset;
@@ -1204,6 +1220,51 @@ void TimeMixPalettes(u32 palettes, u16 *src, u16 *dst, struct BlendSettings *ble
     } while (palettes);
 }
 
+// TimeMixPalettes from gPlttBufferUnfaded to gPlttBufferFaded, where each bit
+// of palettes is a palette slot. A slot whose unfaded colors and blend are
+// the same as last time gets its previous result copied back instead of
+// being blended again, which is most of them: weather, fades and new sprite
+// palettes re-blend every palette although only a few have changed.
+void TimeMixPalettesCached(u32 palettes, struct BlendSettings *blend0, struct BlendSettings *blend1, u16 weight0) {
+    struct TimeBlendCacheEntry *entry = sTimeBlendCache;
+    u32 *src = (u32 *)gPlttBufferUnfaded;
+    u32 *dst = (u32 *)gPlttBufferFaded;
+    u32 i;
+
+    for (; palettes; palettes >>= 1, entry++, src += 8, dst += 8) {
+        if (!(palettes & 1))
+            continue;
+        if (entry->valid && entry->blend0 == blend0 && entry->blend1 == blend1 && entry->weight == weight0) {
+            for (i = 0; i < 8 && entry->src[i] == src[i]; i++)
+                ;
+            if (i == 8) {
+                for (i = 0; i < 8; i++)
+                    dst[i] = entry->blended[i];
+                gTimeBlendStats.palettesReused++;
+                continue;
+            }
+        }
+        TimeMixPalettes(1, (u16 *)src, (u16 *)dst, blend0, blend1, weight0);
+        for (i = 0; i < 8; i++) {
+            entry->src[i] = src[i];
+            entry->blended[i] = dst[i];
+        }
+        entry->blend0 = blend0;
+        entry->blend1 = blend1;
+        entry->weight = weight0;
+        entry->valid = TRUE;
+        gTimeBlendStats.palettesBlended++;
+    }
+}
+
+void DebugPrintTimeBlendStats(void)
+{
+#ifndef NDEBUG
+    DebugPrintf("time blend: palettes blended=%d reused=%d",
+                gTimeBlendStats.palettesBlended, gTimeBlendStats.palettesReused);
+#endif
+}
+
 // Apply weighted average to palettes, preserving high bits of dst throughout
 void AvgPaletteWeighted(u16 *src0, u16 *src1, u16 *dst, u16 weight0) {
     u16 *srcEnd = src0 + 16;
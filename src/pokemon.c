@@ -16,6 +16,7 @@
 #include "item.h"
 #include "link.h"
 #include "main.h"
+#include "new_game.h"
 #include "overworld.h"
 #include "m4a.h"
 #include "party_menu.h"
@@ -68,10 +69,20 @@ struct SpeciesItem
     u16 item;
 };
 
+struct BoxMonSubstructs
+{
+    struct PokemonSubstruct0 *type0;
+    struct PokemonSubstruct1 *type1;
+    struct PokemonSubstruct2 *type2;
+    struct PokemonSubstruct3 *type3;
+};
+
 static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon);
 static union PokemonSubstruct *GetSubstruct(struct BoxPokemon *boxMon, u32 personality, u8 substructType);
-static void EncryptBoxMon(struct BoxPokemon *boxMon);
-static void DecryptBoxMon(struct BoxPokemon *boxMon);
+static IWRAM_FUNC(EncryptBoxMon) void EncryptBoxMon(struct BoxPokemon *boxMon);
+static IWRAM_FUNC(DecryptBoxMon) void DecryptBoxMon(struct BoxPokemon *boxMon);
+static void GetBoxMonSubstructs(struct BoxPokemon *boxMon, struct BoxMonSubstructs *substructs);
+static void SetDecryptedBoxMonData(struct BoxPokemon *boxMon, const struct BoxMonSubstructs *substructs, s32 field, const void *dataArg);
 static void Task_PlayMapChosenOrBattleBGM(u8 taskId);
 static bool8 ShouldGetStatBadgeBoost(u16 flagId, u8 battlerId);
 static u16 GiveMoveToBoxMon(struct BoxPokemon *boxMon, u16 move);
@@ -115,1408 +126,53 @@ static const struct CombinedMove sCombinedMoves[2] =
 // Assigns all species to the Hoenn Dex Index (Summary No. for Hoenn Dex)
 static const u16 sSpeciesToHoennPokedexNum[NUM_SPECIES - 1] =
 {
-    SPECIES_TO_HOENN(BULBASAUR),
-    SPECIES_TO_HOENN(IVYSAUR),
-    SPECIES_TO_HOENN(VENUSAUR),
-    SPECIES_TO_HOENN(CHARMANDER),
-    SPECIES_TO_HOENN(CHARMELEON),
-    SPECIES_TO_HOENN(CHARIZARD),
-    SPECIES_TO_HOENN(SQUIRTLE),
-    SPECIES_TO_HOENN(WARTORTLE),
-    SPECIES_TO_HOENN(BLASTOISE),
-    SPECIES_TO_HOENN(CATERPIE),
-    SPECIES_TO_HOENN(METAPOD),
-    SPECIES_TO_HOENN(BUTTERFREE),
-    SPECIES_TO_HOENN(WEEDLE),
-    SPECIES_TO_HOENN(KAKUNA),
-    SPECIES_TO_HOENN(BEEDRILL),
-    SPECIES_TO_HOENN(PIDGEY),
-    SPECIES_TO_HOENN(PIDGEOTTO),
-    SPECIES_TO_HOENN(PIDGEOT),
-    SPECIES_TO_HOENN(RATTATA),
-    SPECIES_TO_HOENN(RATICATE),
-    SPECIES_TO_HOENN(SPEAROW),
-    SPECIES_TO_HOENN(FEAROW),
-    SPECIES_TO_HOENN(EKANS),
-    SPECIES_TO_HOENN(ARBOK),
-    SPECIES_TO_HOENN(PIKACHU),
-    SPECIES_TO_HOENN(RAICHU),
-    SPECIES_TO_HOENN(SANDSHREW),
-    SPECIES_TO_HOENN(SANDSLASH),
-    SPECIES_TO_HOENN(NIDORAN_F),
-    SPECIES_TO_HOENN(NIDORINA),
-    SPECIES_TO_HOENN(NIDOQUEEN),
-    SPECIES_TO_HOENN(NIDORAN_M),
-    SPECIES_TO_HOENN(NIDORINO),
-    SPECIES_TO_HOENN(NIDOKING),
-    SPECIES_TO_HOENN(CLEFAIRY),
-    SPECIES_TO_HOENN(CLEFABLE),
-    SPECIES_TO_HOENN(VULPIX),
-    SPECIES_TO_HOENN(NINETALES),
-    SPECIES_TO_HOENN(JIGGLYPUFF),
-    SPECIES_TO_HOENN(WIGGLYTUFF),
-    SPECIES_TO_HOENN(ZUBAT),
-    SPECIES_TO_HOENN(GOLBAT),
-    SPECIES_TO_HOENN(ODDISH),
-    SPECIES_TO_HOENN(GLOOM),
-    SPECIES_TO_HOENN(VILEPLUME),
-    SPECIES_TO_HOENN(PARAS),
-    SPECIES_TO_HOENN(PARASECT),
-    SPECIES_TO_HOENN(VENONAT),
-    SPECIES_TO_HOENN(VENOMOTH),
-    SPECIES_TO_HOENN(DIGLETT),
-    SPECIES_TO_HOENN(DUGTRIO),
-    SPECIES_TO_HOENN(MEOWTH),
-    SPECIES_TO_HOENN(PERSIAN),
-    SPECIES_TO_HOENN(PSYDUCK),
-    SPECIES_TO_HOENN(GOLDUCK),
-    SPECIES_TO_HOENN(MANKEY),
-    SPECIES_TO_HOENN(PRIMEAPE),
-    SPECIES_TO_HOENN(GROWLITHE),
-    SPECIES_TO_HOENN(ARCANINE),
-    SPECIES_TO_HOENN(POLIWAG),
-    SPECIES_TO_HOENN(POLIWHIRL),
-    SPECIES_TO_HOENN(POLIWRATH),
-    SPECIES_TO_HOENN(ABRA),
-    SPECIES_TO_HOENN(KADABRA),
-    SPECIES_TO_HOENN(ALAKAZAM),
-    SPECIES_TO_HOENN(MACHOP),
-    SPECIES_TO_HOENN(MACHOKE),
-    SPECIES_TO_HOENN(MACHAMP),
-    SPECIES_TO_HOENN(BELLSPROUT),
-    SPECIES_TO_HOENN(WEEPINBELL),
-    SPECIES_TO_HOENN(VICTREEBEL),
-    SPECIES_TO_HOENN(TENTACOOL),
-    SPECIES_TO_HOENN(TENTACRUEL),
-    SPECIES_TO_HOENN(GEODUDE),
-    SPECIES_TO_HOENN(GRAVELER),
-    SPECIES_TO_HOENN(GOLEM),
-    SPECIES_TO_HOENN(PONYTA),
-    SPECIES_TO_HOENN(RAPIDASH),
-    SPECIES_TO_HOENN(SLOWPOKE),
-    SPECIES_TO_HOENN(SLOWBRO),
-    SPECIES_TO_HOENN(MAGNEMITE),
-    SPECIES_TO_HOENN(MAGNETON),
-    SPECIES_TO_HOENN(FARFETCHD),
-    SPECIES_TO_HOENN(DODUO),
-    SPECIES_TO_HOENN(DODRIO),
-    SPECIES_TO_HOENN(SEEL),
-    SPECIES_TO_HOENN(DEWGONG),
-    SPECIES_TO_HOENN(GRIMER),
-    SPECIES_TO_HOENN(MUK),
-    SPECIES_TO_HOENN(SHELLDER),
-    SPECIES_TO_HOENN(CLOYSTER),
-    SPECIES_TO_HOENN(GASTLY),
-    SPECIES_TO_HOENN(HAUNTER),
-    SPECIES_TO_HOENN(GENGAR),
-    SPECIES_TO_HOENN(ONIX),
-    SPECIES_TO_HOENN(DROWZEE),
-    SPECIES_TO_HOENN(HYPNO),
-    SPECIES_TO_HOENN(KRABBY),
-    SPECIES_TO_HOENN(KINGLER),
-    SPECIES_TO_HOENN(VOLTORB),
-    SPECIES_TO_HOENN(ELECTRODE),
-    SPECIES_TO_HOENN(EXEGGCUTE),
-    SPECIES_TO_HOENN(EXEGGUTOR),
-    SPECIES_TO_HOENN(CUBONE),
-    SPECIES_TO_HOENN(MAROWAK),
-    SPECIES_TO_HOENN(HITMONLEE),
-    SPECIES_TO_HOENN(HITMONCHAN),
-    SPECIES_TO_HOENN(LICKITUNG),
-    SPECIES_TO_HOENN(KOFFING),
-    SPECIES_TO_HOENN(WEEZING),
-    SPECIES_TO_HOENN(RHYHORN),
-    SPECIES_TO_HOENN(RHYDON),
-    SPECIES_TO_HOENN(CHANSEY),
-    SPECIES_TO_HOENN(TANGELA),
-    SPECIES_TO_HOENN(KANGASKHAN),
-    SPECIES_TO_HOENN(HORSEA),
-    SPECIES_TO_HOENN(SEADRA),
-    SPECIES_TO_HOENN(GOLDEEN),
-    SPECIES_TO_HOENN(SEAKING),
-    SPECIES_TO_HOENN(STARYU),
-    SPECIES_TO_HOENN(STARMIE),
-    SPECIES_TO_HOENN(MR_MIME),
-    SPECIES_TO_HOENN(SCYTHER),
-    SPECIES_TO_HOENN(JYNX),
-    SPECIES_TO_HOENN(ELECTABUZZ),
-    SPECIES_TO_HOENN(MAGMAR),
-    SPECIES_TO_HOENN(PINSIR),
-    SPECIES_TO_HOENN(TAUROS),
-    SPECIES_TO_HOENN(MAGIKARP),
-    SPECIES_TO_HOENN(GYARADOS),
-    SPECIES_TO_HOENN(LAPRAS),
-    SPECIES_TO_HOENN(DITTO),
-    SPECIES_TO_HOENN(EEVEE),
-    SPECIES_TO_HOENN(VAPOREON),
-    SPECIES_TO_HOENN(JOLTEON),
-    SPECIES_TO_HOENN(FLAREON),
-    SPECIES_TO_HOENN(PORYGON),
-    SPECIES_TO_HOENN(OMANYTE),
-    SPECIES_TO_HOENN(OMASTAR),
-    SPECIES_TO_HOENN(KABUTO),
-    SPECIES_TO_HOENN(KABUTOPS),
-    SPECIES_TO_HOENN(AERODACTYL),
-    SPECIES_TO_HOENN(SNORLAX),
-    SPECIES_TO_HOENN(ARTICUNO),
-    SPECIES_TO_HOENN(ZAPDOS),
-    SPECIES_TO_HOENN(MOLTRES),
-    SPECIES_TO_HOENN(DRATINI),
-    SPECIES_TO_HOENN(DRAGONAIR),
-    SPECIES_TO_HOENN(DRAGONITE),
-    SPECIES_TO_HOENN(MEWTWO),
-    SPECIES_TO_HOENN(MEW),
-    SPECIES_TO_HOENN(CHIKORITA),
-    SPECIES_TO_HOENN(BAYLEEF),
-    SPECIES_TO_HOENN(MEGANIUM),
-    SPECIES_TO_HOENN(CYNDAQUIL),
-    SPECIES_TO_HOENN(QUILAVA),
-    SPECIES_TO_HOENN(TYPHLOSION),
-    SPECIES_TO_HOENN(TOTODILE),
-    SPECIES_TO_HOENN(CROCONAW),
-    SPECIES_TO_HOENN(FERALIGATR),
-    SPECIES_TO_HOENN(SENTRET),
-    SPECIES_TO_HOENN(FURRET),
-    SPECIES_TO_HOENN(HOOTHOOT),
-    SPECIES_TO_HOENN(NOCTOWL),
-    SPECIES_TO_HOENN(LEDYBA),
-    SPECIES_TO_HOENN(LEDIAN),
-    SPECIES_TO_HOENN(SPINARAK),
-    SPECIES_TO_HOENN(ARIADOS),
-    SPECIES_TO_HOENN(CROBAT),
-    SPECIES_TO_HOENN(CHINCHOU),
-    SPECIES_TO_HOENN(LANTURN),
-    SPECIES_TO_HOENN(PICHU),
-    SPECIES_TO_HOENN(CLEFFA),
-    SPECIES_TO_HOENN(IGGLYBUFF),
-    SPECIES_TO_HOENN(TOGEPI),
-    SPECIES_TO_HOENN(TOGETIC),
-    SPECIES_TO_HOENN(NATU),
-    SPECIES_TO_HOENN(XATU),
-    SPECIES_TO_HOENN(MAREEP),
-    SPECIES_TO_HOENN(FLAAFFY),
-    SPECIES_TO_HOENN(AMPHAROS),
-    SPECIES_TO_HOENN(BELLOSSOM),
-    SPECIES_TO_HOENN(MARILL),
-    SPECIES_TO_HOENN(AZUMARILL),
-    SPECIES_TO_HOENN(SUDOWOODO),
-    SPECIES_TO_HOENN(POLITOED),
-    SPECIES_TO_HOENN(HOPPIP),
-    SPECIES_TO_HOENN(SKIPLOOM),
-    SPECIES_TO_HOENN(JUMPLUFF),
-    SPECIES_TO_HOENN(AIPOM),
-    SPECIES_TO_HOENN(SUNKERN),
-    SPECIES_TO_HOENN(SUNFLORA),
-    SPECIES_TO_HOENN(YANMA),
-    SPECIES_TO_HOENN(WOOPER),
-    SPECIES_TO_HOENN(QUAGSIRE),
-    SPECIES_TO_HOENN(ESPEON),
-    SPECIES_TO_HOENN(UMBREON),
-    SPECIES_TO_HOENN(MURKROW),
-    SPECIES_TO_HOENN(SLOWKING),
-    SPECIES_TO_HOENN(MISDREAVUS),
-    SPECIES_TO_HOENN(UNOWN),
-    SPECIES_TO_HOENN(WOBBUFFET),
-    SPECIES_TO_HOENN(GIRAFARIG),
-    SPECIES_TO_HOENN(PINECO),
-    SPECIES_TO_HOENN(FORRETRESS),
-    SPECIES_TO_HOENN(DUNSPARCE),
-    SPECIES_TO_HOENN(GLIGAR),
-    SPECIES_TO_HOENN(STEELIX),
-    SPECIES_TO_HOENN(SNUBBULL),
-    SPECIES_TO_HOENN(GRANBULL),
-    SPECIES_TO_HOENN(QWILFISH),
-    SPECIES_TO_HOENN(SCIZOR),
-    SPECIES_TO_HOENN(SHUCKLE),
-    SPECIES_TO_HOENN(HERACROSS),
-    SPECIES_TO_HOENN(SNEASEL),
-    SPECIES_TO_HOENN(TEDDIURSA),
-    SPECIES_TO_HOENN(URSARING),
-    SPECIES_TO_HOENN(SLUGMA),
-    SPECIES_TO_HOENN(MAGCARGO),
-    SPECIES_TO_HOENN(SWINUB),
-    SPECIES_TO_HOENN(PILOSWINE),
-    SPECIES_TO_HOENN(CORSOLA),
-    SPECIES_TO_HOENN(REMORAID),
-    SPECIES_TO_HOENN(OCTILLERY),
-    SPECIES_TO_HOENN(DELIBIRD),
-    SPECIES_TO_HOENN(MANTINE),
-    SPECIES_TO_HOENN(SKARMORY),
-    SPECIES_TO_HOENN(HOUNDOUR),
-    SPECIES_TO_HOENN(HOUNDOOM),
-    SPECIES_TO_HOENN(KINGDRA),
-    SPECIES_TO_HOENN(PHANPY),
-    SPECIES_TO_HOENN(DONPHAN),
-    SPECIES_TO_HOENN(PORYGON2),
-    SPECIES_TO_HOENN(STANTLER),
-    SPECIES_TO_HOENN(SMEARGLE),
-    SPECIES_TO_HOENN(TYROGUE),
-    SPECIES_TO_HOENN(HITMONTOP),
-    SPECIES_TO_HOENN(SMOOCHUM),
-    SPECIES_TO_HOENN(ELEKID),
-    SPECIES_TO_HOENN(MAGBY),
-    SPECIES_TO_HOENN(MILTANK),
-    SPECIES_TO_HOENN(BLISSEY),
-    SPECIES_TO_HOENN(RAIKOU),
-    SPECIES_TO_HOENN(ENTEI),
-    SPECIES_TO_HOENN(SUICUNE),
-    SPECIES_TO_HOENN(LARVITAR),
-    SPECIES_TO_HOENN(PUPITAR),
-    SPECIES_TO_HOENN(TYRANITAR),
-    SPECIES_TO_HOENN(LUGIA),
-    SPECIES_TO_HOENN(HO_OH),
-    SPECIES_TO_HOENN(CELEBI),
-    SPECIES_TO_HOENN(OLD_UNOWN_B),
-    SPECIES_TO_HOENN(OLD_UNOWN_C),
-    SPECIES_TO_HOENN(OLD_UNOWN_D),
-    SPECIES_TO_HOENN(OLD_UNOWN_E),
-    SPECIES_TO_HOENN(OLD_UNOWN_F),
-    SPECIES_TO_HOENN(OLD_UNOWN_G),
-    SPECIES_TO_HOENN(OLD_UNOWN_H),
-    SPECIES_TO_HOENN(OLD_UNOWN_I),
-    SPECIES_TO_HOENN(OLD_UNOWN_J),
-    SPECIES_TO_HOENN(OLD_UNOWN_K),
-    SPECIES_TO_HOENN(OLD_UNOWN_L),
-    SPECIES_TO_HOENN(OLD_UNOWN_M),
-    SPECIES_TO_HOENN(OLD_UNOWN_N),
-    SPECIES_TO_HOENN(OLD_UNOWN_O),
-    SPECIES_TO_HOENN(OLD_UNOWN_P),
-    SPECIES_TO_HOENN(OLD_UNOWN_Q),
-    SPECIES_TO_HOENN(OLD_UNOWN_R),
-    SPECIES_TO_HOENN(OLD_UNOWN_S),
-    SPECIES_TO_HOENN(OLD_UNOWN_T),
-    SPECIES_TO_HOENN(OLD_UNOWN_U),
-    SPECIES_TO_HOENN(OLD_UNOWN_V),
-    SPECIES_TO_HOENN(OLD_UNOWN_W),
-    SPECIES_TO_HOENN(OLD_UNOWN_X),
-    SPECIES_TO_HOENN(OLD_UNOWN_Y),
-    SPECIES_TO_HOENN(OLD_UNOWN_Z),
-    SPECIES_TO_HOENN(TREECKO),
-    SPECIES_TO_HOENN(GROVYLE),
-    SPECIES_TO_HOENN(SCEPTILE),
-    SPECIES_TO_HOENN(TORCHIC),
-    SPECIES_TO_HOENN(COMBUSKEN),
-    SPECIES_TO_HOENN(BLAZIKEN),
-    SPECIES_TO_HOENN(MUDKIP),
-    SPECIES_TO_HOENN(MARSHTOMP),
-    SPECIES_TO_HOENN(SWAMPERT),
-    SPECIES_TO_HOENN(POOCHYENA),
-    SPECIES_TO_HOENN(MIGHTYENA),
-    SPECIES_TO_HOENN(ZIGZAGOON),
-    SPECIES_TO_HOENN(LINOONE),
-    SPECIES_TO_HOENN(WURMPLE),
-    SPECIES_TO_HOENN(SILCOON),
-    SPECIES_TO_HOENN(BEAUTIFLY),
-    SPECIES_TO_HOENN(CASCOON),
-    SPECIES_TO_HOENN(DUSTOX),
-    SPECIES_TO_HOENN(LOTAD),
-    SPECIES_TO_HOENN(LOMBRE),
-    SPECIES_TO_HOENN(LUDICOLO),
-    SPECIES_TO_HOENN(SEEDOT),
-    SPECIES_TO_HOENN(NUZLEAF),
-    SPECIES_TO_HOENN(SHIFTRY),
-    SPECIES_TO_HOENN(NINCADA),
-    SPECIES_TO_HOENN(NINJASK),
-    SPECIES_TO_HOENN(SHEDINJA),
-    SPECIES_TO_HOENN(TAILLOW),
-    SPECIES_TO_HOENN(SWELLOW),
-    SPECIES_TO_HOENN(SHROOMISH),
-    SPECIES_TO_HOENN(BRELOOM),
-    SPECIES_TO_HOENN(SPINDA),
-    SPECIES_TO_HOENN(WINGULL),
-    SPECIES_TO_HOENN(PELIPPER),
-    SPECIES_TO_HOENN(SURSKIT),
-    SPECIES_TO_HOENN(MASQUERAIN),
-    SPECIES_TO_HOENN(WAILMER),
-    SPECIES_TO_HOENN(WAILORD),
-    SPECIES_TO_HOENN(SKITTY),
-    SPECIES_TO_HOENN(DELCATTY),
-    SPECIES_TO_HOENN(KECLEON),
-    SPECIES_TO_HOENN(BALTOY),
-    SPECIES_TO_HOENN(CLAYDOL),
-    SPECIES_TO_HOENN(NOSEPASS),
-    SPECIES_TO_HOENN(TORKOAL),
-    SPECIES_TO_HOENN(SABLEYE),
-    SPECIES_TO_HOENN(BARBOACH),
-    SPECIES_TO_HOENN(WHISCASH),
-    SPECIES_TO_HOENN(LUVDISC),
-    SPECIES_TO_HOENN(CORPHISH),
-    SPECIES_TO_HOENN(CRAWDAUNT),
-    SPECIES_TO_HOENN(FEEBAS),
-    SPECIES_TO_HOENN(MILOTIC),
-    SPECIES_TO_HOENN(CARVANHA),
-    SPECIES_TO_HOENN(SHARPEDO),
-    SPECIES_TO_HOENN(TRAPINCH),
-    SPECIES_TO_HOENN(VIBRAVA),
-    SPECIES_TO_HOENN(FLYGON),
-    SPECIES_TO_HOENN(MAKUHITA),
-    SPECIES_TO_HOENN(HARIYAMA),
-    SPECIES_TO_HOENN(ELECTRIKE),
-    SPECIES_TO_HOENN(MANECTRIC),
-    SPECIES_TO_HOENN(NUMEL),
-    SPECIES_TO_HOENN(CAMERUPT),
-    SPECIES_TO_HOENN(SPHEAL),
-    SPECIES_TO_HOENN(SEALEO),
-    SPECIES_TO_HOENN(WALREIN),
-    SPECIES_TO_HOENN(CACNEA),
-    SPECIES_TO_HOENN(CACTURNE),
-    SPECIES_TO_HOENN(SNORUNT),
-    SPECIES_TO_HOENN(GLALIE),
-    SPECIES_TO_HOENN(LUNATONE),
-    SPECIES_TO_HOENN(SOLROCK),
-    SPECIES_TO_HOENN(AZURILL),
-    SPECIES_TO_HOENN(SPOINK),
-    SPECIES_TO_HOENN(GRUMPIG),
-    SPECIES_TO_HOENN(PLUSLE),
-    SPECIES_TO_HOENN(MINUN),
-    SPECIES_TO_HOENN(MAWILE),
-    SPECIES_TO_HOENN(MEDITITE),
-    SPECIES_TO_HOENN(MEDICHAM),
-    SPECIES_TO_HOENN(SWABLU),
-    SPECIES_TO_HOENN(ALTARIA),
-    SPECIES_TO_HOENN(WYNAUT),
-    SPECIES_TO_HOENN(DUSKULL),
-    SPECIES_TO_HOENN(DUSCLOPS),
-    SPECIES_TO_HOENN(ROSELIA),
-    SPECIES_TO_HOENN(SLAKOTH),
-    SPECIES_TO_HOENN(VIGOROTH),
-    SPECIES_TO_HOENN(SLAKING),
-    SPECIES_TO_HOENN(GULPIN),
-    SPECIES_TO_HOENN(SWALOT),
-    SPECIES_TO_HOENN(TROPIUS),
-    SPECIES_TO_HOENN(WHISMUR),
-    SPECIES_TO_HOENN(LOUDRED),
-    SPECIES_TO_HOENN(EXPLOUD),
-    SPECIES_TO_HOENN(CLAMPERL),
-    SPECIES_TO_HOENN(HUNTAIL),
-    SPECIES_TO_HOENN(GOREBYSS),
-    SPECIES_TO_HOENN(ABSOL),
-    SPECIES_TO_HOENN(SHUPPET),
-    SPECIES_TO_HOENN(BANETTE),
-    SPECIES_TO_HOENN(SEVIPER),
-    SPECIES_TO_HOENN(ZANGOOSE),
-    SPECIES_TO_HOENN(RELICANTH),
-    SPECIES_TO_HOENN(ARON),
-    SPECIES_TO_HOENN(LAIRON),
-    SPECIES_TO_HOENN(AGGRON),
-    SPECIES_TO_HOENN(CASTFORM),
-    SPECIES_TO_HOENN(VOLBEAT),
-    SPECIES_TO_HOENN(ILLUMISE),
-    SPECIES_TO_HOENN(LILEEP),
-    SPECIES_TO_HOENN(CRADILY),
-    SPECIES_TO_HOENN(ANORITH),
-    SPECIES_TO_HOENN(ARMALDO),
-    SPECIES_TO_HOENN(RALTS),
-    SPECIES_TO_HOENN(KIRLIA),
-    SPECIES_TO_HOENN(GARDEVOIR),
-    SPECIES_TO_HOENN(BAGON),
-    SPECIES_TO_HOENN(SHELGON),
-    SPECIES_TO_HOENN(SALAMENCE),
-    SPECIES_TO_HOENN(BELDUM),
-    SPECIES_TO_HOENN(METANG),
-    SPECIES_TO_HOENN(METAGROSS),
-    SPECIES_TO_HOENN(REGIROCK),
-    SPECIES_TO_HOENN(REGICE),
-    SPECIES_TO_HOENN(REGISTEEL),
-    SPECIES_TO_HOENN(KYOGRE),
-    SPECIES_TO_HOENN(GROUDON),
-    SPECIES_TO_HOENN(RAYQUAZA),
-    SPECIES_TO_HOENN(LATIAS),
-    SPECIES_TO_HOENN(LATIOS),
-    SPECIES_TO_HOENN(JIRACHI),
-    SPECIES_TO_HOENN(DEOXYS),
-    SPECIES_TO_HOENN(CHIMECHO),
-    SPECIES_TO_HOENN(MIME_JR),
-    SPECIES_TO_HOENN(MUNCHLAX),
-    SPECIES_TO_HOENN(BONSLY),
-    SPECIES_TO_HOENN(MANTYKE),
-    SPECIES_TO_HOENN(HAPPINY),
-    SPECIES_TO_HOENN(CHINGLING),
-    SPECIES_TO_HOENN(BUDEW),
-    SPECIES_TO_HOENN(ROSERADE),
-    SPECIES_TO_HOENN(DUSKNOIR),
-    SPECIES_TO_HOENN(AMBIPOM),
-    SPECIES_TO_HOENN(ELECTIVIRE),
-    SPECIES_TO_HOENN(FROSLASS),
-    SPECIES_TO_HOENN(GALLADE),
-    SPECIES_TO_HOENN(GLISCOR),
-    SPECIES_TO_HOENN(HONCHKROW),
-    SPECIES_TO_HOENN(LICKILICKY),
-    SPECIES_TO_HOENN(MAGMORTAR),
-    SPECIES_TO_HOENN(MAGNEZONE),
-    SPECIES_TO_HOENN(MAMOSWINE),
-    SPECIES_TO_HOENN(MISMAGIUS),
-    SPECIES_TO_HOENN(PORYGON_Z),
-    SPECIES_TO_HOENN(PROBOPASS),
-    SPECIES_TO_HOENN(RHYPERIOR),
-    SPECIES_TO_HOENN(TANGROWTH),
-    SPECIES_TO_HOENN(TOGEKISS),
-    SPECIES_TO_HOENN(WEAVILE),
-    SPECIES_TO_HOENN(YANMEGA),
-    SPECIES_TO_HOENN(LEAFEON),
-    SPECIES_TO_HOENN(GLACEON),
-    SPECIES_TO_HOENN(SYLVEON),
-    SPECIES_TO_HOENN(REGIDRAGO),
-    SPECIES_TO_HOENN(REGIELEKI),
-    SPECIES_TO_HOENN(REGIGIGAS),
-    SPECIES_TO_HOENN(ARCEUS),
-    SPECIES_TO_HOENN(ANNIHILAPE),
-    SPECIES_TO_HOENN(FARIGIRAF),
-    SPECIES_TO_HOENN(DUDUNSPARCE),
-    SPECIES_TO_HOENN(WYRDEER),
-    SPECIES_TO_HOENN(URSALUNA),
-    SPECIES_TO_HOENN(URSALUNA_BLOODMOON),
-    SPECIES_TO_HOENN(KLEAVOR),
-    //SPECIES_TO_HOENN(URSALUNA_BLOODMOON),
-    //SPECIES_TO_HOENN(KLEAVOR),
-    //SPECIES_TO_HOENN(UNUSED_SPACE5),
-    //SPECIES_TO_HOENN(UNUSED_SPACE6),
-    //SPECIES_TO_HOENN(UNUSED_SPACE7),
-    //SPECIES_TO_HOENN(UNUSED_SPACE8),
-    //SPECIES_TO_HOENN(UNUSED_SPACE9),
-    //SPECIES_TO_HOENN(UNUSED_SPACE10),
-    //SPECIES_TO_HOENN(DEOXYS_ATTACK),
-    //SPECIES_TO_HOENN(DEOXYS_DEFENSE),
-    //SPECIES_TO_HOENN(DEOXYS_SPEED),
+#include "data/pokemon/species_to_hoenn_dex.h"
 };
 
 // Assigns all species to the National Dex Index (Summary No. for National Dex)
 static const u16 sSpeciesToNationalPokedexNum[NUM_SPECIES - 1] =
 {
-    SPECIES_TO_NATIONAL(BULBASAUR),
-    SPECIES_TO_NATIONAL(IVYSAUR),
-    SPECIES_TO_NATIONAL(VENUSAUR),
-    SPECIES_TO_NATIONAL(CHARMANDER),
-    SPECIES_TO_NATIONAL(CHARMELEON),
-    SPECIES_TO_NATIONAL(CHARIZARD),
-    SPECIES_TO_NATIONAL(SQUIRTLE),
-    SPECIES_TO_NATIONAL(WARTORTLE),
-    SPECIES_TO_NATIONAL(BLASTOISE),
-    SPECIES_TO_NATIONAL(CATERPIE),
-    SPECIES_TO_NATIONAL(METAPOD),
-    SPECIES_TO_NATIONAL(BUTTERFREE),
-    SPECIES_TO_NATIONAL(WEEDLE),
-    SPECIES_TO_NATIONAL(KAKUNA),
-    SPECIES_TO_NATIONAL(BEEDRILL),
-    SPECIES_TO_NATIONAL(PIDGEY),
-    SPECIES_TO_NATIONAL(PIDGEOTTO),
-    SPECIES_TO_NATIONAL(PIDGEOT),
-    SPECIES_TO_NATIONAL(RATTATA),
-    SPECIES_TO_NATIONAL(RATICATE),
-    SPECIES_TO_NATIONAL(SPEAROW),
-    SPECIES_TO_NATIONAL(FEAROW),
-    SPECIES_TO_NATIONAL(EKANS),
-    SPECIES_TO_NATIONAL(ARBOK),
-    SPECIES_TO_NATIONAL(PIKACHU),
-    SPECIES_TO_NATIONAL(RAICHU),
-    SPECIES_TO_NATIONAL(SANDSHREW),
-    SPECIES_TO_NATIONAL(SANDSLASH),
-    SPECIES_TO_NATIONAL(NIDORAN_F),
-    SPECIES_TO_NATIONAL(NIDORINA),
-    SPECIES_TO_NATIONAL(NIDOQUEEN),
-    SPECIES_TO_NATIONAL(NIDORAN_M),
-    SPECIES_TO_NATIONAL(NIDORINO),
-    SPECIES_TO_NATIONAL(NIDOKING),
-    SPECIES_TO_NATIONAL(CLEFAIRY),
-    SPECIES_TO_NATIONAL(CLEFABLE),
-    SPECIES_TO_NATIONAL(VULPIX),
-    SPECIES_TO_NATIONAL(NINETALES),
-    SPECIES_TO_NATIONAL(JIGGLYPUFF),
-    SPECIES_TO_NATIONAL(WIGGLYTUFF),
-    SPECIES_TO_NATIONAL(ZUBAT),
-    SPECIES_TO_NATIONAL(GOLBAT),
-    SPECIES_TO_NATIONAL(ODDISH),
-    SPECIES_TO_NATIONAL(GLOOM),
-    SPECIES_TO_NATIONAL(VILEPLUME),
-    SPECIES_TO_NATIONAL(PARAS),
-    SPECIES_TO_NATIONAL(PARASECT),
-    SPECIES_TO_NATIONAL(VENONAT),
-    SPECIES_TO_NATIONAL(VENOMOTH),
-    SPECIES_TO_NATIONAL(DIGLETT),
-    SPECIES_TO_NATIONAL(DUGTRIO),
-    SPECIES_TO_NATIONAL(MEOWTH),
-    SPECIES_TO_NATIONAL(PERSIAN),
-    SPECIES_TO_NATIONAL(PSYDUCK),
-    SPECIES_TO_NATIONAL(GOLDUCK),
-    SPECIES_TO_NATIONAL(MANKEY),
-    SPECIES_TO_NATIONAL(PRIMEAPE),
-    SPECIES_TO_NATIONAL(GROWLITHE),
-    SPECIES_TO_NATIONAL(ARCANINE),
-    SPECIES_TO_NATIONAL(POLIWAG),
-    SPECIES_TO_NATIONAL(POLIWHIRL),
-    SPECIES_TO_NATIONAL(POLIWRATH),
-    SPECIES_TO_NATIONAL(ABRA),
-    SPECIES_TO_NATIONAL(KADABRA),
-    SPECIES_TO_NATIONAL(ALAKAZAM),
-    SPECIES_TO_NATIONAL(MACHOP),
-    SPECIES_TO_NATIONAL(MACHOKE),
-    SPECIES_TO_NATIONAL(MACHAMP),
-    SPECIES_TO_NATIONAL(BELLSPROUT),
-    SPECIES_TO_NATIONAL(WEEPINBELL),
-    SPECIES_TO_NATIONAL(VICTREEBEL),
-    SPECIES_TO_NATIONAL(TENTACOOL),
-    SPECIES_TO_NATIONAL(TENTACRUEL),
-    SPECIES_TO_NATIONAL(GEODUDE),
-    SPECIES_TO_NATIONAL(GRAVELER),
-    SPECIES_TO_NATIONAL(GOLEM),
-    SPECIES_TO_NATIONAL(PONYTA),
-    SPECIES_TO_NATIONAL(RAPIDASH),
-    SPECIES_TO_NATIONAL(SLOWPOKE),
-    SPECIES_TO_NATIONAL(SLOWBRO),
-    SPECIES_TO_NATIONAL(MAGNEMITE),
-    SPECIES_TO_NATIONAL(MAGNETON),
-    SPECIES_TO_NATIONAL(FARFETCHD),
-    SPECIES_TO_NATIONAL(DODUO),
-    SPECIES_TO_NATIONAL(DODRIO),
-    SPECIES_TO_NATIONAL(SEEL),
-    SPECIES_TO_NATIONAL(DEWGONG),
-    SPECIES_TO_NATIONAL(GRIMER),
-    SPECIES_TO_NATIONAL(MUK),
-    SPECIES_TO_NATIONAL(SHELLDER),
-    SPECIES_TO_NATIONAL(CLOYSTER),
-    SPECIES_TO_NATIONAL(GASTLY),
-    SPECIES_TO_NATIONAL(HAUNTER),
-    SPECIES_TO_NATIONAL(GENGAR),
-    SPECIES_TO_NATIONAL(ONIX),
-    SPECIES_TO_NATIONAL(DROWZEE),
-    SPECIES_TO_NATIONAL(HYPNO),
-    SPECIES_TO_NATIONAL(KRABBY),
-    SPECIES_TO_NATIONAL(KINGLER),
-    SPECIES_TO_NATIONAL(VOLTORB),
-    SPECIES_TO_NATIONAL(ELECTRODE),
-    SPECIES_TO_NATIONAL(EXEGGCUTE),
-    SPECIES_TO_NATIONAL(EXEGGUTOR),
-    SPECIES_TO_NATIONAL(CUBONE),
-    SPECIES_TO_NATIONAL(MAROWAK),
-    SPECIES_TO_NATIONAL(HITMONLEE),
-    SPECIES_TO_NATIONAL(HITMONCHAN),
-    SPECIES_TO_NATIONAL(LICKITUNG),
-    SPECIES_TO_NATIONAL(KOFFING),
-    SPECIES_TO_NATIONAL(WEEZING),
-    SPECIES_TO_NATIONAL(RHYHORN),
-    SPECIES_TO_NATIONAL(RHYDON),
-    SPECIES_TO_NATIONAL(CHANSEY),
-    SPECIES_TO_NATIONAL(TANGELA),
-    SPECIES_TO_NATIONAL(KANGASKHAN),
-    SPECIES_TO_NATIONAL(HORSEA),
-    SPECIES_TO_NATIONAL(SEADRA),
-    SPECIES_TO_NATIONAL(GOLDEEN),
-    SPECIES_TO_NATIONAL(SEAKING),
-    SPECIES_TO_NATIONAL(STARYU),
-    SPECIES_TO_NATIONAL(STARMIE),
-    SPECIES_TO_NATIONAL(MR_MIME),
-    SPECIES_TO_NATIONAL(SCYTHER),
-    SPECIES_TO_NATIONAL(JYNX),
-    SPECIES_TO_NATIONAL(ELECTABUZZ),
-    SPECIES_TO_NATIONAL(MAGMAR),
-    SPECIES_TO_NATIONAL(PINSIR),
-    SPECIES_TO_NATIONAL(TAUROS),
-    SPECIES_TO_NATIONAL(MAGIKARP),
-    SPECIES_TO_NATIONAL(GYARADOS),
-    SPECIES_TO_NATIONAL(LAPRAS),
-    SPECIES_TO_NATIONAL(DITTO),
-    SPECIES_TO_NATIONAL(EEVEE),
-    SPECIES_TO_NATIONAL(VAPOREON),
-    SPECIES_TO_NATIONAL(JOLTEON),
-    SPECIES_TO_NATIONAL(FLAREON),
-    SPECIES_TO_NATIONAL(PORYGON),
-    SPECIES_TO_NATIONAL(OMANYTE),
-    SPECIES_TO_NATIONAL(OMASTAR),
-    SPECIES_TO_NATIONAL(KABUTO),
-    SPECIES_TO_NATIONAL(KABUTOPS),
-    SPECIES_TO_NATIONAL(AERODACTYL),
-    SPECIES_TO_NATIONAL(SNORLAX),
-    SPECIES_TO_NATIONAL(ARTICUNO),
-    SPECIES_TO_NATIONAL(ZAPDOS),
-    SPECIES_TO_NATIONAL(MOLTRES),
-    SPECIES_TO_NATIONAL(DRATINI),
-    SPECIES_TO_NATIONAL(DRAGONAIR),
-    SPECIES_TO_NATIONAL(DRAGONITE),
-    SPECIES_TO_NATIONAL(MEWTWO),
-    SPECIES_TO_NATIONAL(MEW),
-    SPECIES_TO_NATIONAL(CHIKORITA),
-    SPECIES_TO_NATIONAL(BAYLEEF),
-    SPECIES_TO_NATIONAL(MEGANIUM),
-    SPECIES_TO_NATIONAL(CYNDAQUIL),
-    SPECIES_TO_NATIONAL(QUILAVA),
-    SPECIES_TO_NATIONAL(TYPHLOSION),
-    SPECIES_TO_NATIONAL(TOTODILE),
-    SPECIES_TO_NATIONAL(CROCONAW),
-    SPECIES_TO_NATIONAL(FERALIGATR),
-    SPECIES_TO_NATIONAL(SENTRET),
-    SPECIES_TO_NATIONAL(FURRET),
-    SPECIES_TO_NATIONAL(HOOTHOOT),
-    SPECIES_TO_NATIONAL(NOCTOWL),
-    SPECIES_TO_NATIONAL(LEDYBA),
-    SPECIES_TO_NATIONAL(LEDIAN),
-    SPECIES_TO_NATIONAL(SPINARAK),
-    SPECIES_TO_NATIONAL(ARIADOS),
-    SPECIES_TO_NATIONAL(CROBAT),
-    SPECIES_TO_NATIONAL(CHINCHOU),
-    SPECIES_TO_NATIONAL(LANTURN),
-    SPECIES_TO_NATIONAL(PICHU),
-    SPECIES_TO_NATIONAL(CLEFFA),
-    SPECIES_TO_NATIONAL(IGGLYBUFF),
-    SPECIES_TO_NATIONAL(TOGEPI),
-    SPECIES_TO_NATIONAL(TOGETIC),
-    SPECIES_TO_NATIONAL(NATU),
-    SPECIES_TO_NATIONAL(XATU),
-    SPECIES_TO_NATIONAL(MAREEP),
-    SPECIES_TO_NATIONAL(FLAAFFY),
-    SPECIES_TO_NATIONAL(AMPHAROS),
-    SPECIES_TO_NATIONAL(BELLOSSOM),
-    SPECIES_TO_NATIONAL(MARILL),
-    SPECIES_TO_NATIONAL(AZUMARILL),
-    SPECIES_TO_NATIONAL(SUDOWOODO),
-    SPECIES_TO_NATIONAL(POLITOED),
-    SPECIES_TO_NATIONAL(HOPPIP),
-    SPECIES_TO_NATIONAL(SKIPLOOM),
-    SPECIES_TO_NATIONAL(JUMPLUFF),
-    SPECIES_TO_NATIONAL(AIPOM),
-    SPECIES_TO_NATIONAL(SUNKERN),
-    SPECIES_TO_NATIONAL(SUNFLORA),
-    SPECIES_TO_NATIONAL(YANMA),
-    SPECIES_TO_NATIONAL(WOOPER),
-    SPECIES_TO_NATIONAL(QUAGSIRE),
-    SPECIES_TO_NATIONAL(ESPEON),
-    SPECIES_TO_NATIONAL(UMBREON),
-    SPECIES_TO_NATIONAL(MURKROW),
-    SPECIES_TO_NATIONAL(SLOWKING),
-    SPECIES_TO_NATIONAL(MISDREAVUS),
-    SPECIES_TO_NATIONAL(UNOWN),
-    SPECIES_TO_NATIONAL(WOBBUFFET),
-    SPECIES_TO_NATIONAL(GIRAFARIG),
-    SPECIES_TO_NATIONAL(PINECO),
-    SPECIES_TO_NATIONAL(FORRETRESS),
-    SPECIES_TO_NATIONAL(DUNSPARCE),
-    SPECIES_TO_NATIONAL(GLIGAR),
-    SPECIES_TO_NATIONAL(STEELIX),
-    SPECIES_TO_NATIONAL(SNUBBULL),
-    SPECIES_TO_NATIONAL(GRANBULL),
-    SPECIES_TO_NATIONAL(QWILFISH),
-    SPECIES_TO_NATIONAL(SCIZOR),
-    SPECIES_TO_NATIONAL(SHUCKLE),
-    SPECIES_TO_NATIONAL(HERACROSS),
-    SPECIES_TO_NATIONAL(SNEASEL),
-    SPECIES_TO_NATIONAL(TEDDIURSA),
-    SPECIES_TO_NATIONAL(URSARING),
-    SPECIES_TO_NATIONAL(SLUGMA),
-    SPECIES_TO_NATIONAL(MAGCARGO),
-    SPECIES_TO_NATIONAL(SWINUB),
-    SPECIES_TO_NATIONAL(PILOSWINE),
-    SPECIES_TO_NATIONAL(CORSOLA),
-    SPECIES_TO_NATIONAL(REMORAID),
-    SPECIES_TO_NATIONAL(OCTILLERY),
-    SPECIES_TO_NATIONAL(DELIBIRD),
-    SPECIES_TO_NATIONAL(MANTINE),
-    SPECIES_TO_NATIONAL(SKARMORY),
-    SPECIES_TO_NATIONAL(HOUNDOUR),
-    SPECIES_TO_NATIONAL(HOUNDOOM),
-    SPECIES_TO_NATIONAL(KINGDRA),
-    SPECIES_TO_NATIONAL(PHANPY),
-    SPECIES_TO_NATIONAL(DONPHAN),
-    SPECIES_TO_NATIONAL(PORYGON2),
-    SPECIES_TO_NATIONAL(STANTLER),
-    SPECIES_TO_NATIONAL(SMEARGLE),
-    SPECIES_TO_NATIONAL(TYROGUE),
-    SPECIES_TO_NATIONAL(HITMONTOP),
-    SPECIES_TO_NATIONAL(SMOOCHUM),
-    SPECIES_TO_NATIONAL(ELEKID),
-    SPECIES_TO_NATIONAL(MAGBY),
-    SPECIES_TO_NATIONAL(MILTANK),
-    SPECIES_TO_NATIONAL(BLISSEY),
-    SPECIES_TO_NATIONAL(RAIKOU),
-    SPECIES_TO_NATIONAL(ENTEI),
-    SPECIES_TO_NATIONAL(SUICUNE),
-    SPECIES_TO_NATIONAL(LARVITAR),
-    SPECIES_TO_NATIONAL(PUPITAR),
-    SPECIES_TO_NATIONAL(TYRANITAR),
-    SPECIES_TO_NATIONAL(LUGIA),
-    SPECIES_TO_NATIONAL(HO_OH),
-    SPECIES_TO_NATIONAL(CELEBI),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_B),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_C),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_D),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_E),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_F),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_G),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_H),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_I),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_J),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_K),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_L),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_M),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_N),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_O),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_P),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_Q),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_R),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_S),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_T),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_U),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_V),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_W),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_X),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_Y),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_Z),
-    SPECIES_TO_NATIONAL(TREECKO),
-    SPECIES_TO_NATIONAL(GROVYLE),
-    SPECIES_TO_NATIONAL(SCEPTILE),
-    SPECIES_TO_NATIONAL(TORCHIC),
-    SPECIES_TO_NATIONAL(COMBUSKEN),
-    SPECIES_TO_NATIONAL(BLAZIKEN),
-    SPECIES_TO_NATIONAL(MUDKIP),
-    SPECIES_TO_NATIONAL(MARSHTOMP),
-    SPECIES_TO_NATIONAL(SWAMPERT),
-    SPECIES_TO_NATIONAL(POOCHYENA),
-    SPECIES_TO_NATIONAL(MIGHTYENA),
-    SPECIES_TO_NATIONAL(ZIGZAGOON),
-    SPECIES_TO_NATIONAL(LINOONE),
-    SPECIES_TO_NATIONAL(WURMPLE),
-    SPECIES_TO_NATIONAL(SILCOON),
-    SPECIES_TO_NATIONAL(BEAUTIFLY),
-    SPECIES_TO_NATIONAL(CASCOON),
-    SPECIES_TO_NATIONAL(DUSTOX),
-    SPECIES_TO_NATIONAL(LOTAD),
-    SPECIES_TO_NATIONAL(LOMBRE),
-    SPECIES_TO_NATIONAL(LUDICOLO),
-    SPECIES_TO_NATIONAL(SEEDOT),
-    SPECIES_TO_NATIONAL(NUZLEAF),
-    SPECIES_TO_NATIONAL(SHIFTRY),
-    SPECIES_TO_NATIONAL(NINCADA),
-    SPECIES_TO_NATIONAL(NINJASK),
-    SPECIES_TO_NATIONAL(SHEDINJA),
-    SPECIES_TO_NATIONAL(TAILLOW),
-    SPECIES_TO_NATIONAL(SWELLOW),
-    SPECIES_TO_NATIONAL(SHROOMISH),
-    SPECIES_TO_NATIONAL(BRELOOM),
-    SPECIES_TO_NATIONAL(SPINDA),
-    SPECIES_TO_NATIONAL(WINGULL),
-    SPECIES_TO_NATIONAL(PELIPPER),
-    SPECIES_TO_NATIONAL(SURSKIT),
-    SPECIES_TO_NATIONAL(MASQUERAIN),
-    SPECIES_TO_NATIONAL(WAILMER),
-    SPECIES_TO_NATIONAL(WAILORD),
-    SPECIES_TO_NATIONAL(SKITTY),
-    SPECIES_TO_NATIONAL(DELCATTY),
-    SPECIES_TO_NATIONAL(KECLEON),
-    SPECIES_TO_NATIONAL(BALTOY),
-    SPECIES_TO_NATIONAL(CLAYDOL),
-    SPECIES_TO_NATIONAL(NOSEPASS),
-    SPECIES_TO_NATIONAL(TORKOAL),
-    SPECIES_TO_NATIONAL(SABLEYE),
-    SPECIES_TO_NATIONAL(BARBOACH),
-    SPECIES_TO_NATIONAL(WHISCASH),
-    SPECIES_TO_NATIONAL(LUVDISC),
-    SPECIES_TO_NATIONAL(CORPHISH),
-    SPECIES_TO_NATIONAL(CRAWDAUNT),
-    SPECIES_TO_NATIONAL(FEEBAS),
-    SPECIES_TO_NATIONAL(MILOTIC),
-    SPECIES_TO_NATIONAL(CARVANHA),
-    SPECIES_TO_NATIONAL(SHARPEDO),
-    SPECIES_TO_NATIONAL(TRAPINCH),
-    SPECIES_TO_NATIONAL(VIBRAVA),
-    SPECIES_TO_NATIONAL(FLYGON),
-    SPECIES_TO_NATIONAL(MAKUHITA),
-    SPECIES_TO_NATIONAL(HARIYAMA),
-    SPECIES_TO_NATIONAL(ELECTRIKE),
-    SPECIES_TO_NATIONAL(MANECTRIC),
-    SPECIES_TO_NATIONAL(NUMEL),
-    SPECIES_TO_NATIONAL(CAMERUPT),
-    SPECIES_TO_NATIONAL(SPHEAL),
-    SPECIES_TO_NATIONAL(SEALEO),
-    SPECIES_TO_NATIONAL(WALREIN),
-    SPECIES_TO_NATIONAL(CACNEA),
-    SPECIES_TO_NATIONAL(CACTURNE),
-    SPECIES_TO_NATIONAL(SNORUNT),
-    SPECIES_TO_NATIONAL(GLALIE),
-    SPECIES_TO_NATIONAL(LUNATONE),
-    SPECIES_TO_NATIONAL(SOLROCK),
-    SPECIES_TO_NATIONAL(AZURILL),
-    SPECIES_TO_NATIONAL(SPOINK),
-    SPECIES_TO_NATIONAL(GRUMPIG),
-    SPECIES_TO_NATIONAL(PLUSLE),
-    SPECIES_TO_NATIONAL(MINUN),
-    SPECIES_TO_NATIONAL(MAWILE),
-    SPECIES_TO_NATIONAL(MEDITITE),
-    SPECIES_TO_NATIONAL(MEDICHAM),
-    SPECIES_TO_NATIONAL(SWABLU),
-    SPECIES_TO_NATIONAL(ALTARIA),
-    SPECIES_TO_NATIONAL(WYNAUT),
-    SPECIES_TO_NATIONAL(DUSKULL),
-    SPECIES_TO_NATIONAL(DUSCLOPS),
-    SPECIES_TO_NATIONAL(ROSELIA),
-    SPECIES_TO_NATIONAL(SLAKOTH),
-    SPECIES_TO_NATIONAL(VIGOROTH),
-    SPECIES_TO_NATIONAL(SLAKING),
-    SPECIES_TO_NATIONAL(GULPIN),
-    SPECIES_TO_NATIONAL(SWALOT),
-    SPECIES_TO_NATIONAL(TROPIUS),
-    SPECIES_TO_NATIONAL(WHISMUR),
-    SPECIES_TO_NATIONAL(LOUDRED),
-    SPECIES_TO_NATIONAL(EXPLOUD),
-    SPECIES_TO_NATIONAL(CLAMPERL),
-    SPECIES_TO_NATIONAL(HUNTAIL),
-    SPECIES_TO_NATIONAL(GOREBYSS),
-    SPECIES_TO_NATIONAL(ABSOL),
-    SPECIES_TO_NATIONAL(SHUPPET),
-    SPECIES_TO_NATIONAL(BANETTE),
-    SPECIES_TO_NATIONAL(SEVIPER),
-    SPECIES_TO_NATIONAL(ZANGOOSE),
-    SPECIES_TO_NATIONAL(RELICANTH),
-    SPECIES_TO_NATIONAL(ARON),
-    SPECIES_TO_NATIONAL(LAIRON),
-    SPECIES_TO_NATIONAL(AGGRON),
-    SPECIES_TO_NATIONAL(CASTFORM),
-    SPECIES_TO_NATIONAL(VOLBEAT),
-    SPECIES_TO_NATIONAL(ILLUMISE),
-    SPECIES_TO_NATIONAL(LILEEP),
-    SPECIES_TO_NATIONAL(CRADILY),
-    SPECIES_TO_NATIONAL(ANORITH),
-    SPECIES_TO_NATIONAL(ARMALDO),
-    SPECIES_TO_NATIONAL(RALTS),
-    SPECIES_TO_NATIONAL(KIRLIA),
-    SPECIES_TO_NATIONAL(GARDEVOIR),
-    SPECIES_TO_NATIONAL(BAGON),
-    SPECIES_TO_NATIONAL(SHELGON),
-    SPECIES_TO_NATIONAL(SALAMENCE),
-    SPECIES_TO_NATIONAL(BELDUM),
-    SPECIES_TO_NATIONAL(METANG),
-    SPECIES_TO_NATIONAL(METAGROSS),
-    SPECIES_TO_NATIONAL(REGIROCK),
-    SPECIES_TO_NATIONAL(REGICE),
-    SPECIES_TO_NATIONAL(REGISTEEL),
-    SPECIES_TO_NATIONAL(KYOGRE),
-    SPECIES_TO_NATIONAL(GROUDON),
-    SPECIES_TO_NATIONAL(RAYQUAZA),
-    SPECIES_TO_NATIONAL(LATIAS),
-    SPECIES_TO_NATIONAL(LATIOS),
-    SPECIES_TO_NATIONAL(JIRACHI),
-    SPECIES_TO_NATIONAL(DEOXYS),
-    SPECIES_TO_NATIONAL(CHIMECHO),
-    SPECIES_TO_NATIONAL(MIME_JR),
-    SPECIES_TO_NATIONAL(MUNCHLAX),
-    SPECIES_TO_NATIONAL(BONSLY),
-    SPECIES_TO_NATIONAL(MANTYKE),
-    SPECIES_TO_NATIONAL(HAPPINY),
-    SPECIES_TO_NATIONAL(CHINGLING),
-    SPECIES_TO_NATIONAL(BUDEW),
-    SPECIES_TO_NATIONAL(ROSERADE),
-    SPECIES_TO_NATIONAL(DUSKNOIR),
-    SPECIES_TO_NATIONAL(AMBIPOM),
-    SPECIES_TO_NATIONAL(ELECTIVIRE),
-    SPECIES_TO_NATIONAL(FROSLASS),
-    SPECIES_TO_NATIONAL(GALLADE),
-    SPECIES_TO_NATIONAL(GLISCOR),
-    SPECIES_TO_NATIONAL(HONCHKROW),
-    SPECIES_TO_NATIONAL(LICKILICKY),
-    SPECIES_TO_NATIONAL(MAGMORTAR),
-    SPECIES_TO_NATIONAL(MAGNEZONE),
-    SPECIES_TO_NATIONAL(MAMOSWINE),
-    SPECIES_TO_NATIONAL(MISMAGIUS),
-    SPECIES_TO_NATIONAL(PORYGON_Z),
-    SPECIES_TO_NATIONAL(PROBOPASS),
-    SPECIES_TO_NATIONAL(RHYPERIOR),
-    SPECIES_TO_NATIONAL(TANGROWTH),
-    SPECIES_TO_NATIONAL(TOGEKISS),
-    SPECIES_TO_NATIONAL(WEAVILE),
-    SPECIES_TO_NATIONAL(YANMEGA),
-    SPECIES_TO_NATIONAL(LEAFEON),
-    SPECIES_TO_NATIONAL(GLACEON),
-    SPECIES_TO_NATIONAL(SYLVEON),
-    SPECIES_TO_NATIONAL(REGIDRAGO),
-    SPECIES_TO_NATIONAL(REGIELEKI),
-    SPECIES_TO_NATIONAL(REGIGIGAS),
-    SPECIES_TO_NATIONAL(ARCEUS),
-    SPECIES_TO_NATIONAL(ANNIHILAPE),
-    SPECIES_TO_NATIONAL(FARIGIRAF),
-    SPECIES_TO_NATIONAL(DUDUNSPARCE),
-    SPECIES_TO_NATIONAL(WYRDEER),
-    SPECIES_TO_NATIONAL(URSALUNA),
-    SPECIES_TO_NATIONAL(URSALUNA_BLOODMOON),
-    SPECIES_TO_NATIONAL(KLEAVOR),
-    //SPECIES_TO_NATIONAL(URSALUNA_BLOODMOON),
-    //SPECIES_TO_NATIONAL(KLEAVOR),
-    //SPECIES_TO_NATIONAL(UNUSED_SPACE5),
-    //SPECIES_TO_NATIONAL(UNUSED_SPACE6),
-    //SPECIES_TO_NATIONAL(UNUSED_SPACE7),
-    //SPECIES_TO_NATIONAL(UNUSED_SPACE8),
-    //SPECIES_TO_NATIONAL(UNUSED_SPACE9),
-    //SPECIES_TO_NATIONAL(UNUSED_SPACE10),
-    //SPECIES_TO_NATIONAL(DEOXYS_ATTACK),
-    //SPECIES_TO_NATIONAL(DEOXYS_DEFENSE),
-    //SPECIES_TO_NATIONAL(DEOXYS_SPEED),
+#include "data/pokemon/species_to_national_dex.h"
 };
 
 // Assigns all Hoenn Dex Indexes to a National Dex Index
 static const u16 sHoennToNationalOrder[NUM_SPECIES - 1] =
 {
-    HOENN_TO_NATIONAL(TREECKO),
-    HOENN_TO_NATIONAL(GROVYLE),
-    HOENN_TO_NATIONAL(SCEPTILE),
-    HOENN_TO_NATIONAL(TORCHIC),
-    HOENN_TO_NATIONAL(COMBUSKEN),
-    HOENN_TO_NATIONAL(BLAZIKEN),
-    HOENN_TO_NATIONAL(MUDKIP),
-    HOENN_TO_NATIONAL(MARSHTOMP),
-    HOENN_TO_NATIONAL(SWAMPERT),
-    HOENN_TO_NATIONAL(POOCHYENA),
-    HOENN_TO_NATIONAL(MIGHTYENA),
-    HOENN_TO_NATIONAL(ZIGZAGOON),
-    HOENN_TO_NATIONAL(LINOONE),
-    HOENN_TO_NATIONAL(WURMPLE),
-    HOENN_TO_NATIONAL(SILCOON),
-    HOENN_TO_NATIONAL(BEAUTIFLY),
-    HOENN_TO_NATIONAL(CASCOON),
-    HOENN_TO_NATIONAL(DUSTOX),
-    HOENN_TO_NATIONAL(LOTAD),
-    HOENN_TO_NATIONAL(LOMBRE),
-    HOENN_TO_NATIONAL(LUDICOLO),
-    HOENN_TO_NATIONAL(SEEDOT),
-    HOENN_TO_NATIONAL(NUZLEAF),
-    HOENN_TO_NATIONAL(SHIFTRY),
-    HOENN_TO_NATIONAL(TAILLOW),
-    HOENN_TO_NATIONAL(SWELLOW),
-    HOENN_TO_NATIONAL(WINGULL),
-    HOENN_TO_NATIONAL(PELIPPER),
-    HOENN_TO_NATIONAL(RALTS),
-    HOENN_TO_NATIONAL(KIRLIA),
-    HOENN_TO_NATIONAL(GARDEVOIR),
-    HOENN_TO_NATIONAL(GALLADE),
-    HOENN_TO_NATIONAL(SURSKIT),
-    HOENN_TO_NATIONAL(MASQUERAIN),
-    HOENN_TO_NATIONAL(SHROOMISH),
-    HOENN_TO_NATIONAL(BRELOOM),
-    HOENN_TO_NATIONAL(SLAKOTH),
-    HOENN_TO_NATIONAL(VIGOROTH),
-    HOENN_TO_NATIONAL(SLAKING),
-    HOENN_TO_NATIONAL(ABRA),
-    HOENN_TO_NATIONAL(KADABRA),
-    HOENN_TO_NATIONAL(ALAKAZAM),
-    HOENN_TO_NATIONAL(NINCADA),
-    HOENN_TO_NATIONAL(NINJASK),
-    HOENN_TO_NATIONAL(SHEDINJA),
-    HOENN_TO_NATIONAL(WHISMUR),
-    HOENN_TO_NATIONAL(LOUDRED),
-    HOENN_TO_NATIONAL(EXPLOUD),
-    HOENN_TO_NATIONAL(MAKUHITA),
-    HOENN_TO_NATIONAL(HARIYAMA),
-    HOENN_TO_NATIONAL(GOLDEEN),
-    HOENN_TO_NATIONAL(SEAKING),
-    HOENN_TO_NATIONAL(MAGIKARP),
-    HOENN_TO_NATIONAL(GYARADOS),
-    HOENN_TO_NATIONAL(AZURILL),
-    HOENN_TO_NATIONAL(MARILL),
-    HOENN_TO_NATIONAL(AZUMARILL),
-    HOENN_TO_NATIONAL(GEODUDE),
-    HOENN_TO_NATIONAL(GRAVELER),
-    HOENN_TO_NATIONAL(GOLEM),
-    HOENN_TO_NATIONAL(NOSEPASS),
-    HOENN_TO_NATIONAL(PROBOPASS),
-    HOENN_TO_NATIONAL(SKITTY),
-    HOENN_TO_NATIONAL(DELCATTY),
-    HOENN_TO_NATIONAL(ZUBAT),
-    HOENN_TO_NATIONAL(GOLBAT),
-    HOENN_TO_NATIONAL(CROBAT),
-    HOENN_TO_NATIONAL(TENTACOOL),
-    HOENN_TO_NATIONAL(TENTACRUEL),
-    HOENN_TO_NATIONAL(SABLEYE),
-    HOENN_TO_NATIONAL(MAWILE),
-    HOENN_TO_NATIONAL(ARON),
-    HOENN_TO_NATIONAL(LAIRON),
-    HOENN_TO_NATIONAL(AGGRON),
-    HOENN_TO_NATIONAL(MACHOP),
-    HOENN_TO_NATIONAL(MACHOKE),
-    HOENN_TO_NATIONAL(MACHAMP),
-    HOENN_TO_NATIONAL(MEDITITE),
-    HOENN_TO_NATIONAL(MEDICHAM),
-    HOENN_TO_NATIONAL(ELECTRIKE),
-    HOENN_TO_NATIONAL(MANECTRIC),
-    HOENN_TO_NATIONAL(PLUSLE),
-    HOENN_TO_NATIONAL(MINUN),
-    HOENN_TO_NATIONAL(MAGNEMITE),
-    HOENN_TO_NATIONAL(MAGNETON),
-    HOENN_TO_NATIONAL(MAGNEZONE),
-    HOENN_TO_NATIONAL(VOLTORB),
-    HOENN_TO_NATIONAL(ELECTRODE),
-    HOENN_TO_NATIONAL(VOLBEAT),
-    HOENN_TO_NATIONAL(ILLUMISE),
-    HOENN_TO_NATIONAL(ODDISH),
-    HOENN_TO_NATIONAL(GLOOM),
-    HOENN_TO_NATIONAL(VILEPLUME),
-    HOENN_TO_NATIONAL(BELLOSSOM),
-    HOENN_TO_NATIONAL(DODUO),
-    HOENN_TO_NATIONAL(DODRIO),
-    HOENN_TO_NATIONAL(BUDEW),
-    HOENN_TO_NATIONAL(ROSELIA),
-    HOENN_TO_NATIONAL(ROSERADE),
-
-    HOENN_TO_NATIONAL(GULPIN),
-    HOENN_TO_NATIONAL(SWALOT),
-    HOENN_TO_NATIONAL(CARVANHA),
-    HOENN_TO_NATIONAL(SHARPEDO),
-    HOENN_TO_NATIONAL(WAILMER),
-    HOENN_TO_NATIONAL(WAILORD),
-    HOENN_TO_NATIONAL(NUMEL),
-    HOENN_TO_NATIONAL(CAMERUPT),
-    HOENN_TO_NATIONAL(SLUGMA),
-    HOENN_TO_NATIONAL(MAGCARGO),
-    HOENN_TO_NATIONAL(TORKOAL),
-    HOENN_TO_NATIONAL(GRIMER),
-    HOENN_TO_NATIONAL(MUK),
-    HOENN_TO_NATIONAL(KOFFING),
-    HOENN_TO_NATIONAL(WEEZING),
-    HOENN_TO_NATIONAL(SPOINK),
-    HOENN_TO_NATIONAL(GRUMPIG),
-    HOENN_TO_NATIONAL(SANDSHREW),
-    HOENN_TO_NATIONAL(SANDSLASH),
-    HOENN_TO_NATIONAL(SPINDA),
-    HOENN_TO_NATIONAL(SKARMORY),
-    HOENN_TO_NATIONAL(TRAPINCH),
-    HOENN_TO_NATIONAL(VIBRAVA),
-    HOENN_TO_NATIONAL(FLYGON),
-    HOENN_TO_NATIONAL(CACNEA),
-    HOENN_TO_NATIONAL(CACTURNE),
-    HOENN_TO_NATIONAL(SWABLU),
-    HOENN_TO_NATIONAL(ALTARIA),
-    HOENN_TO_NATIONAL(ZANGOOSE),
-    HOENN_TO_NATIONAL(SEVIPER),
-    HOENN_TO_NATIONAL(LUNATONE),
-    HOENN_TO_NATIONAL(SOLROCK),
-    HOENN_TO_NATIONAL(BARBOACH),
-    HOENN_TO_NATIONAL(WHISCASH),
-    HOENN_TO_NATIONAL(CORPHISH),
-    HOENN_TO_NATIONAL(CRAWDAUNT),
-    HOENN_TO_NATIONAL(BALTOY),
-    HOENN_TO_NATIONAL(CLAYDOL),
-    HOENN_TO_NATIONAL(LILEEP),
-    HOENN_TO_NATIONAL(CRADILY),
-    HOENN_TO_NATIONAL(ANORITH),
-    HOENN_TO_NATIONAL(ARMALDO),
-    HOENN_TO_NATIONAL(IGGLYBUFF),
-    HOENN_TO_NATIONAL(JIGGLYPUFF),
-    HOENN_TO_NATIONAL(WIGGLYTUFF),
-    HOENN_TO_NATIONAL(FEEBAS),
-    HOENN_TO_NATIONAL(MILOTIC),
-    HOENN_TO_NATIONAL(CASTFORM),
-    HOENN_TO_NATIONAL(STARYU),
-    HOENN_TO_NATIONAL(STARMIE),
-    HOENN_TO_NATIONAL(KECLEON),
-    HOENN_TO_NATIONAL(SHUPPET),
-    HOENN_TO_NATIONAL(BANETTE),
-    HOENN_TO_NATIONAL(DUSKULL),
-    HOENN_TO_NATIONAL(DUSCLOPS),
-    HOENN_TO_NATIONAL(DUSKNOIR),
-    HOENN_TO_NATIONAL(TROPIUS),
-    HOENN_TO_NATIONAL(CHINGLING),
-    HOENN_TO_NATIONAL(CHIMECHO),
-    HOENN_TO_NATIONAL(ABSOL),
-    HOENN_TO_NATIONAL(VULPIX),
-    HOENN_TO_NATIONAL(NINETALES),
-    HOENN_TO_NATIONAL(PICHU),
-    HOENN_TO_NATIONAL(PIKACHU),
-    HOENN_TO_NATIONAL(RAICHU),
-    HOENN_TO_NATIONAL(PSYDUCK),
-    HOENN_TO_NATIONAL(GOLDUCK),
-    HOENN_TO_NATIONAL(WYNAUT),
-    HOENN_TO_NATIONAL(WOBBUFFET),
-    HOENN_TO_NATIONAL(NATU),
-    HOENN_TO_NATIONAL(XATU),
-    HOENN_TO_NATIONAL(GIRAFARIG),
-    HOENN_TO_NATIONAL(PHANPY),
-    HOENN_TO_NATIONAL(DONPHAN),
-    HOENN_TO_NATIONAL(PINSIR),
-    HOENN_TO_NATIONAL(HERACROSS),
-    HOENN_TO_NATIONAL(RHYHORN),
-    HOENN_TO_NATIONAL(RHYDON),
-    HOENN_TO_NATIONAL(RHYPERIOR),
-    HOENN_TO_NATIONAL(SNORUNT),
-    HOENN_TO_NATIONAL(GLALIE),
-    HOENN_TO_NATIONAL(FROSLASS),
-    HOENN_TO_NATIONAL(SPHEAL),
-    HOENN_TO_NATIONAL(SEALEO),
-    HOENN_TO_NATIONAL(WALREIN),
-    HOENN_TO_NATIONAL(CLAMPERL),
-    HOENN_TO_NATIONAL(HUNTAIL),
-    HOENN_TO_NATIONAL(GOREBYSS),
-    HOENN_TO_NATIONAL(RELICANTH),
-    HOENN_TO_NATIONAL(CORSOLA),
-    HOENN_TO_NATIONAL(CHINCHOU),
-    HOENN_TO_NATIONAL(LANTURN),
-    HOENN_TO_NATIONAL(LUVDISC),
-    HOENN_TO_NATIONAL(HORSEA),
-    HOENN_TO_NATIONAL(SEADRA),
-    HOENN_TO_NATIONAL(KINGDRA),
-    HOENN_TO_NATIONAL(BAGON),
-    HOENN_TO_NATIONAL(SHELGON),
-    HOENN_TO_NATIONAL(SALAMENCE),
-    HOENN_TO_NATIONAL(BELDUM),
-    HOENN_TO_NATIONAL(METANG),
-    HOENN_TO_NATIONAL(METAGROSS),
-    HOENN_TO_NATIONAL(REGIROCK),
-    HOENN_TO_NATIONAL(REGICE),
-    HOENN_TO_NATIONAL(REGISTEEL),
-    HOENN_TO_NATIONAL(REGIDRAGO),
-    HOENN_TO_NATIONAL(REGIELEKI),
-    HOENN_TO_NATIONAL(REGIGIGAS),
-    HOENN_TO_NATIONAL(LATIAS),
-    HOENN_TO_NATIONAL(LATIOS),
-    HOENN_TO_NATIONAL(KYOGRE),
-    HOENN_TO_NATIONAL(GROUDON),
-    HOENN_TO_NATIONAL(RAYQUAZA),
-    HOENN_TO_NATIONAL(JIRACHI),
-    HOENN_TO_NATIONAL(DEOXYS),
-    HOENN_TO_NATIONAL(BULBASAUR), // Pokémon from here onwards are UNSEEN in the HoennDex.
-    HOENN_TO_NATIONAL(IVYSAUR),
-    HOENN_TO_NATIONAL(VENUSAUR),
-    HOENN_TO_NATIONAL(CHARMANDER),
-    HOENN_TO_NATIONAL(CHARMELEON),
-    HOENN_TO_NATIONAL(CHARIZARD),
-    HOENN_TO_NATIONAL(SQUIRTLE),
-    HOENN_TO_NATIONAL(WARTORTLE),
-    HOENN_TO_NATIONAL(BLASTOISE),
-    HOENN_TO_NATIONAL(CATERPIE),
-    HOENN_TO_NATIONAL(METAPOD),
-    HOENN_TO_NATIONAL(BUTTERFREE),
-    HOENN_TO_NATIONAL(WEEDLE),
-    HOENN_TO_NATIONAL(KAKUNA),
-    HOENN_TO_NATIONAL(BEEDRILL),
-    HOENN_TO_NATIONAL(PIDGEY),
-    HOENN_TO_NATIONAL(PIDGEOTTO),
-    HOENN_TO_NATIONAL(PIDGEOT),
-    HOENN_TO_NATIONAL(RATTATA),
-    HOENN_TO_NATIONAL(RATICATE),
-    HOENN_TO_NATIONAL(SPEAROW),
-    HOENN_TO_NATIONAL(FEAROW),
-    HOENN_TO_NATIONAL(EKANS),
-    HOENN_TO_NATIONAL(ARBOK),
-    HOENN_TO_NATIONAL(NIDORAN_F),
-    HOENN_TO_NATIONAL(NIDORINA),
-    HOENN_TO_NATIONAL(NIDOQUEEN),
-    HOENN_TO_NATIONAL(NIDORAN_M),
-    HOENN_TO_NATIONAL(NIDORINO),
-    HOENN_TO_NATIONAL(NIDOKING),
-    HOENN_TO_NATIONAL(CLEFAIRY),
-    HOENN_TO_NATIONAL(CLEFABLE),
-    HOENN_TO_NATIONAL(PARAS),
-    HOENN_TO_NATIONAL(PARASECT),
-    HOENN_TO_NATIONAL(VENONAT),
-    HOENN_TO_NATIONAL(VENOMOTH),
-    HOENN_TO_NATIONAL(DIGLETT),
-    HOENN_TO_NATIONAL(DUGTRIO),
-    HOENN_TO_NATIONAL(MEOWTH),
-    HOENN_TO_NATIONAL(PERSIAN),
-    HOENN_TO_NATIONAL(MANKEY),
-    HOENN_TO_NATIONAL(PRIMEAPE),
-    HOENN_TO_NATIONAL(GROWLITHE),
-    HOENN_TO_NATIONAL(ARCANINE),
-    HOENN_TO_NATIONAL(POLIWAG),
-    HOENN_TO_NATIONAL(POLIWHIRL),
-    HOENN_TO_NATIONAL(POLIWRATH),
-    HOENN_TO_NATIONAL(BELLSPROUT),
-    HOENN_TO_NATIONAL(WEEPINBELL),
-    HOENN_TO_NATIONAL(VICTREEBEL),
-    HOENN_TO_NATIONAL(PONYTA),
-    HOENN_TO_NATIONAL(RAPIDASH),
-    HOENN_TO_NATIONAL(SLOWPOKE),
-    HOENN_TO_NATIONAL(SLOWBRO),
-    HOENN_TO_NATIONAL(FARFETCHD),
-    HOENN_TO_NATIONAL(SEEL),
-    HOENN_TO_NATIONAL(DEWGONG),
-    HOENN_TO_NATIONAL(SHELLDER),
-    HOENN_TO_NATIONAL(CLOYSTER),
-    HOENN_TO_NATIONAL(GASTLY),
-    HOENN_TO_NATIONAL(HAUNTER),
-    HOENN_TO_NATIONAL(GENGAR),
-    HOENN_TO_NATIONAL(ONIX),
-    HOENN_TO_NATIONAL(DROWZEE),
-    HOENN_TO_NATIONAL(HYPNO),
-    HOENN_TO_NATIONAL(KRABBY),
-    HOENN_TO_NATIONAL(KINGLER),
-    HOENN_TO_NATIONAL(EXEGGCUTE),
-    HOENN_TO_NATIONAL(EXEGGUTOR),
-    HOENN_TO_NATIONAL(CUBONE),
-    HOENN_TO_NATIONAL(MAROWAK),
-    HOENN_TO_NATIONAL(HITMONLEE),
-    HOENN_TO_NATIONAL(HITMONCHAN),
-    HOENN_TO_NATIONAL(LICKITUNG), 
-    HOENN_TO_NATIONAL(CHANSEY),
-    HOENN_TO_NATIONAL(TANGELA),
-    HOENN_TO_NATIONAL(KANGASKHAN),
-    HOENN_TO_NATIONAL(MR_MIME),
-    HOENN_TO_NATIONAL(SCYTHER),
-    HOENN_TO_NATIONAL(JYNX),
-    HOENN_TO_NATIONAL(ELECTABUZZ),
-    HOENN_TO_NATIONAL(MAGMAR),
-    HOENN_TO_NATIONAL(TAUROS),
-    HOENN_TO_NATIONAL(LAPRAS),
-    HOENN_TO_NATIONAL(DITTO),
-    HOENN_TO_NATIONAL(EEVEE),
-    HOENN_TO_NATIONAL(VAPOREON),
-    HOENN_TO_NATIONAL(JOLTEON),
-    HOENN_TO_NATIONAL(FLAREON),
-    HOENN_TO_NATIONAL(PORYGON),
-    HOENN_TO_NATIONAL(OMANYTE),
-    HOENN_TO_NATIONAL(OMASTAR),
-    HOENN_TO_NATIONAL(KABUTO),
-    HOENN_TO_NATIONAL(KABUTOPS),
-    HOENN_TO_NATIONAL(AERODACTYL),
-    HOENN_TO_NATIONAL(SNORLAX),
-    HOENN_TO_NATIONAL(ARTICUNO),
-    HOENN_TO_NATIONAL(ZAPDOS),
-    HOENN_TO_NATIONAL(MOLTRES),
-    HOENN_TO_NATIONAL(DRATINI),
-    HOENN_TO_NATIONAL(DRAGONAIR),
-    HOENN_TO_NATIONAL(DRAGONITE),
-    HOENN_TO_NATIONAL(MEWTWO),
-    HOENN_TO_NATIONAL(MEW),
-    HOENN_TO_NATIONAL(CHIKORITA),
-    HOENN_TO_NATIONAL(BAYLEEF),
-    HOENN_TO_NATIONAL(MEGANIUM),
-    HOENN_TO_NATIONAL(CYNDAQUIL),
-    HOENN_TO_NATIONAL(QUILAVA),
-    HOENN_TO_NATIONAL(TYPHLOSION),
-    HOENN_TO_NATIONAL(TOTODILE),
-    HOENN_TO_NATIONAL(CROCONAW),
-    HOENN_TO_NATIONAL(FERALIGATR),
-    HOENN_TO_NATIONAL(SENTRET),
-    HOENN_TO_NATIONAL(FURRET),
-    HOENN_TO_NATIONAL(HOOTHOOT),
-    HOENN_TO_NATIONAL(NOCTOWL),
-    HOENN_TO_NATIONAL(LEDYBA),
-    HOENN_TO_NATIONAL(LEDIAN),
-    HOENN_TO_NATIONAL(SPINARAK),
-    HOENN_TO_NATIONAL(ARIADOS),
-    HOENN_TO_NATIONAL(CLEFFA),
-    HOENN_TO_NATIONAL(TOGEPI),
-    HOENN_TO_NATIONAL(TOGETIC),
-    HOENN_TO_NATIONAL(MAREEP),
-    HOENN_TO_NATIONAL(FLAAFFY),
-    HOENN_TO_NATIONAL(AMPHAROS),
-    HOENN_TO_NATIONAL(SUDOWOODO),
-    HOENN_TO_NATIONAL(POLITOED),
-    HOENN_TO_NATIONAL(HOPPIP),
-    HOENN_TO_NATIONAL(SKIPLOOM),
-    HOENN_TO_NATIONAL(JUMPLUFF),
-    HOENN_TO_NATIONAL(AIPOM),
-    HOENN_TO_NATIONAL(SUNKERN),
-    HOENN_TO_NATIONAL(SUNFLORA),
-    HOENN_TO_NATIONAL(YANMA),
-    HOENN_TO_NATIONAL(WOOPER),
-    HOENN_TO_NATIONAL(QUAGSIRE),
-    HOENN_TO_NATIONAL(ESPEON),
-    HOENN_TO_NATIONAL(UMBREON),
-    HOENN_TO_NATIONAL(MURKROW),
-    HOENN_TO_NATIONAL(SLOWKING),
-    HOENN_TO_NATIONAL(MISDREAVUS),
-    HOENN_TO_NATIONAL(UNOWN),
-    HOENN_TO_NATIONAL(PINECO),
-    HOENN_TO_NATIONAL(FORRETRESS),
-    HOENN_TO_NATIONAL(DUNSPARCE),
-    HOENN_TO_NATIONAL(GLIGAR),
-    HOENN_TO_NATIONAL(STEELIX),
-    HOENN_TO_NATIONAL(SNUBBULL),
-    HOENN_TO_NATIONAL(GRANBULL),
-    HOENN_TO_NATIONAL(QWILFISH),
-    HOENN_TO_NATIONAL(SCIZOR),
-    HOENN_TO_NATIONAL(SHUCKLE),
-    HOENN_TO_NATIONAL(SNEASEL),
-    HOENN_TO_NATIONAL(TEDDIURSA),
-    HOENN_TO_NATIONAL(URSARING),
-    HOENN_TO_NATIONAL(SWINUB),
-    HOENN_TO_NATIONAL(PILOSWINE),
-    HOENN_TO_NATIONAL(REMORAID),
-    HOENN_TO_NATIONAL(OCTILLERY),
-    HOENN_TO_NATIONAL(DELIBIRD),
-    HOENN_TO_NATIONAL(MANTINE),
-    HOENN_TO_NATIONAL(HOUNDOUR),
-    HOENN_TO_NATIONAL(HOUNDOOM),
-    HOENN_TO_NATIONAL(PORYGON2),
-    HOENN_TO_NATIONAL(STANTLER),
-    HOENN_TO_NATIONAL(SMEARGLE),
-    HOENN_TO_NATIONAL(TYROGUE),
-    HOENN_TO_NATIONAL(HITMONTOP),
-    HOENN_TO_NATIONAL(SMOOCHUM),
-    HOENN_TO_NATIONAL(ELEKID),
-    HOENN_TO_NATIONAL(MAGBY),
-    HOENN_TO_NATIONAL(MILTANK),
-    HOENN_TO_NATIONAL(BLISSEY),
-    HOENN_TO_NATIONAL(RAIKOU),
-    HOENN_TO_NATIONAL(ENTEI),
-    HOENN_TO_NATIONAL(SUICUNE),
-    HOENN_TO_NATIONAL(LARVITAR),
-    HOENN_TO_NATIONAL(PUPITAR),
-    HOENN_TO_NATIONAL(TYRANITAR),
-    HOENN_TO_NATIONAL(LUGIA),
-    HOENN_TO_NATIONAL(HO_OH),
-    HOENN_TO_NATIONAL(CELEBI),
-    HOENN_TO_NATIONAL(OLD_UNOWN_B),
-    HOENN_TO_NATIONAL(OLD_UNOWN_C),
-    HOENN_TO_NATIONAL(OLD_UNOWN_D),
-    HOENN_TO_NATIONAL(OLD_UNOWN_E),
-    HOENN_TO_NATIONAL(OLD_UNOWN_F),
-    HOENN_TO_NATIONAL(OLD_UNOWN_G),
-    HOENN_TO_NATIONAL(OLD_UNOWN_H),
-    HOENN_TO_NATIONAL(OLD_UNOWN_I),
-    HOENN_TO_NATIONAL(OLD_UNOWN_J),
-    HOENN_TO_NATIONAL(OLD_UNOWN_K),
-    HOENN_TO_NATIONAL(OLD_UNOWN_L),
-    HOENN_TO_NATIONAL(OLD_UNOWN_M),
-    HOENN_TO_NATIONAL(OLD_UNOWN_N),
-    HOENN_TO_NATIONAL(OLD_UNOWN_O),
-    HOENN_TO_NATIONAL(OLD_UNOWN_P),
-    HOENN_TO_NATIONAL(OLD_UNOWN_Q),
-    HOENN_TO_NATIONAL(OLD_UNOWN_R),
-    HOENN_TO_NATIONAL(OLD_UNOWN_S),
-    HOENN_TO_NATIONAL(OLD_UNOWN_T),
-    HOENN_TO_NATIONAL(OLD_UNOWN_U),
-    HOENN_TO_NATIONAL(OLD_UNOWN_V),
-    HOENN_TO_NATIONAL(OLD_UNOWN_W),
-    HOENN_TO_NATIONAL(OLD_UNOWN_X),
-    HOENN_TO_NATIONAL(OLD_UNOWN_Y),
-    HOENN_TO_NATIONAL(OLD_UNOWN_Z),
-    HOENN_TO_NATIONAL(MIME_JR),
-    HOENN_TO_NATIONAL(MUNCHLAX),
-    HOENN_TO_NATIONAL(BONSLY),
-    HOENN_TO_NATIONAL(MANTYKE),   
-    HOENN_TO_NATIONAL(AMBIPOM),
-    HOENN_TO_NATIONAL(ELECTIVIRE),
-    HOENN_TO_NATIONAL(GLISCOR),
-    HOENN_TO_NATIONAL(HAPPINY),
-    HOENN_TO_NATIONAL(HONCHKROW),
-    HOENN_TO_NATIONAL(LICKILICKY),
-    HOENN_TO_NATIONAL(MAGMORTAR),
-    HOENN_TO_NATIONAL(MAMOSWINE),
-    HOENN_TO_NATIONAL(MISMAGIUS),
-    HOENN_TO_NATIONAL(PORYGON_Z),
-    HOENN_TO_NATIONAL(TANGROWTH),
-    HOENN_TO_NATIONAL(TOGEKISS),
-    HOENN_TO_NATIONAL(WEAVILE),
-    HOENN_TO_NATIONAL(YANMEGA),
-    HOENN_TO_NATIONAL(LEAFEON),
-    HOENN_TO_NATIONAL(GLACEON),
-    HOENN_TO_NATIONAL(SYLVEON),
-    HOENN_TO_NATIONAL(ARCEUS),
-    HOENN_TO_NATIONAL(ANNIHILAPE),
-    HOENN_TO_NATIONAL(FARIGIRAF),
-    HOENN_TO_NATIONAL(DUDUNSPARCE),
-    HOENN_TO_NATIONAL(WYRDEER),
-    HOENN_TO_NATIONAL(URSALUNA),
-    HOENN_TO_NATIONAL(URSALUNA_BLOODMOON),
-    HOENN_TO_NATIONAL(KLEAVOR),
-    //HOENN_TO_NATIONAL(URSALUNA_BLOODMOON),
-    //HOENN_TO_NATIONAL(KLEAVOR),
-    //HOENN_TO_NATIONAL(UNUSED_SPACE5),
-    //HOENN_TO_NATIONAL(UNUSED_SPACE6),
-    //HOENN_TO_NATIONAL(UNUSED_SPACE7),
-    //HOENN_TO_NATIONAL(UNUSED_SPACE8),
-    //HOENN_TO_NATIONAL(UNUSED_SPACE9),
-    //HOENN_TO_NATIONAL(UNUSED_SPACE10),
-    //HOENN_TO_NATIONAL(DEOXYS_ATTACK),
-    //HOENN_TO_NATIONAL(DEOXYS_DEFENSE),
-    //HOENN_TO_NATIONAL(DEOXYS_SPEED),
+#include "data/pokemon/hoenn_to_national_dex.h"
+};
+
+#undef SPECIES_TO_HOENN
+#undef SPECIES_TO_NATIONAL
+#undef HOENN_TO_NATIONAL
+
+// The same lists again with each mapping reversed, so that dex number lookups don't
+// have to search the tables above.
+#define SPECIES_TO_HOENN(name)      [HOENN_DEX_##name - 1] = SPECIES_##name
+#define SPECIES_TO_NATIONAL(name)   [NATIONAL_DEX_##name - 1] = SPECIES_##name
+#define HOENN_TO_NATIONAL(name)     [NATIONAL_DEX_##name - 1] = HOENN_DEX_##name
+
+// Assigns all Hoenn Dex Indexes to a species
+static const u16 sHoennPokedexNumToSpecies[NUM_SPECIES - 1] =
+{
+#include "data/pokemon/species_to_hoenn_dex.h"
 };
 
+// Assigns all National Dex Indexes to a species
+static const u16 sNationalPokedexNumToSpecies[NUM_SPECIES - 1] =
+{
+#include "data/pokemon/species_to_national_dex.h"
+};
+
+// Assigns all National Dex Indexes to a Hoenn Dex Index
+static const u16 sNationalToHoennOrder[NUM_SPECIES - 1] =
+{
+#include "data/pokemon/hoenn_to_national_dex.h"
+};
+
+#undef SPECIES_TO_HOENN
+#undef SPECIES_TO_NATIONAL
+#undef HOENN_TO_NATIONAL
+
 const struct SpindaSpot gSpindaSpotGraphics[] =
 {
     {.x = 16, .y =  7, .image = INCBIN_U16("graphics/pokemon/spinda/spots/spot_0.1bpp")},
@@ -4924,8 +3580,8 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
     u8 speciesName[POKEMON_NAME_LENGTH + 1];
     u32 personality;
     u32 value;
-    u16 checksum;
     u32 shinyValue;
+    struct BoxMonSubstructs substructs;
 
     ZeroBoxMonData(boxMon);
 
@@ -5005,46 +3661,47 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
     SetBoxMonData(boxMon, MON_DATA_PERSONALITY, &personality);
     SetBoxMonData(boxMon, MON_DATA_OT_ID, &value);
 
-    checksum = CalculateBoxMonChecksum(boxMon);
-    SetBoxMonData(boxMon, MON_DATA_CHECKSUM, &checksum);
-    EncryptBoxMon(boxMon);
+    // The box mon is still all zeroes, so the rest is written in plaintext
+    // and it is checksummed and encrypted once at the end, rather than
+    // decrypted and encrypted again for every field.
+    GetBoxMonSubstructs(boxMon, &substructs);
     GetSpeciesName(speciesName, species);
-    SetBoxMonData(boxMon, MON_DATA_NICKNAME, speciesName);
-    SetBoxMonData(boxMon, MON_DATA_LANGUAGE, &gGameLanguage);
-    SetBoxMonData(boxMon, MON_DATA_OT_NAME, gSaveBlock2Ptr->playerName);
-    SetBoxMonData(boxMon, MON_DATA_SPECIES, &species);
-    SetBoxMonData(boxMon, MON_DATA_EXP, &gExperienceTables[gSpeciesInfo[species].growthRate][level]);
-    SetBoxMonData(boxMon, MON_DATA_FRIENDSHIP, &gSpeciesInfo[species].friendship);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_NICKNAME, speciesName);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_LANGUAGE, &gGameLanguage);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_OT_NAME, gSaveBlock2Ptr->playerName);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPECIES, &species);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_EXP, &gExperienceTables[gSpeciesInfo[species].growthRate][level]);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_FRIENDSHIP, &gSpeciesInfo[species].friendship);
     value = GetCurrentRegionMapSectionId();
-    SetBoxMonData(boxMon, MON_DATA_MET_LOCATION, &value);
-    SetBoxMonData(boxMon, MON_DATA_MET_LEVEL, &level);
-    SetBoxMonData(boxMon, MON_DATA_MET_GAME, &gGameVersion);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_MET_LOCATION, &value);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_MET_LEVEL, &level);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_MET_GAME, &gGameVersion);
     value = ITEM_POKE_BALL;
-    SetBoxMonData(boxMon, MON_DATA_POKEBALL, &value);
-    SetBoxMonData(boxMon, MON_DATA_OT_GENDER, &gSaveBlock2Ptr->playerGender);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_POKEBALL, &value);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_OT_GENDER, &gSaveBlock2Ptr->playerGender);
 
     if (fixedIV < USE_RANDOM_IVS)
     {
         if (gSaveBlock1Ptr->tx_Challenges_MaxPartyIVs == 0)
         {
-            SetBoxMonData(boxMon, MON_DATA_HP_IV, &fixedIV);
-            SetBoxMonData(boxMon, MON_DATA_ATK_IV, &fixedIV);
-            SetBoxMonData(boxMon, MON_DATA_DEF_IV, &fixedIV);
-            SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &fixedIV);
-            SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &fixedIV);
-            SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &fixedIV);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &fixedIV);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &fixedIV);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &fixedIV);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &fixedIV);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &fixedIV);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &fixedIV);
         }
         else if (gSaveBlock1Ptr->tx_Challenges_MaxPartyIVs == 1)
         {
             u32 iv;
             iv = 31;
             
-            SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv);
         }
         else if (gSaveBlock1Ptr->tx_Challenges_MaxPartyIVs == 2)
         {
@@ -5058,44 +3715,44 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
             ivRand = (Random() % 2);
             
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv31);
 
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv31);
             
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv31);
             
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv31);
             
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv31);
             
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv31);
         }
     }
     else
@@ -5106,32 +3763,32 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
             value = Random();
 
             iv = value & MAX_IV_MASK;
-            SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv);
             iv = (value & (MAX_IV_MASK << 5)) >> 5;
-            SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv);
             iv = (value & (MAX_IV_MASK << 10)) >> 10;
-            SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv);
 
             value = Random();
 
             iv = value & MAX_IV_MASK;
-            SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv);
             iv = (value & (MAX_IV_MASK << 5)) >> 5;
-            SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv);
             iv = (value & (MAX_IV_MASK << 10)) >> 10;
-            SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv);
         }
         else if (gSaveBlock1Ptr->tx_Challenges_MaxPartyIVs == 1)
         {
             u32 iv;
             iv = 31;
 
-            SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv);
-            SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv);
+            SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv);
         }
         else if (gSaveBlock1Ptr->tx_Challenges_MaxPartyIVs == 2)
         {
@@ -5145,44 +3802,44 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
             ivRand = (Random() % 2);
             
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_HP_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HP_IV, &iv31);
 
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_ATK_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ATK_IV, &iv31);
 
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_DEF_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_DEF_IV, &iv31);
 
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_SPEED_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPEED_IV, &iv31);
 
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_SPATK_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPATK_IV, &iv31);
 
             ivRand = (Random() % 2);
 
             if (ivRand == 1)
-                SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv30);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv30);
             else if (ivRand == 0)
-                SetBoxMonData(boxMon, MON_DATA_SPDEF_IV, &iv31);
+                SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_SPDEF_IV, &iv31);
         }
     }
 
@@ -5190,11 +3847,14 @@ void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV,
     //if ((GetAbilityBySpecies(species, 1) != ABILITY_NONE) && (species != SPECIES_SLAKING || species != SPECIES_MILOTIC || species != SPECIES_WHISCASH || species != SPECIES_KINGDRA || species != SPECIES_DUSKNOIR)) //tx_randomizer_and_challenges + norman slaking code for hard mode
     {
         value = personality & 1;
-        SetBoxMonData(boxMon, MON_DATA_ABILITY_NUM, &value);
+        SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_ABILITY_NUM, &value);
     }
 
     value = HIDDEN_NATURE_NONE;
-    SetBoxMonData(boxMon, MON_DATA_HIDDEN_NATURE, &value);
+    SetDecryptedBoxMonData(boxMon, &substructs, MON_DATA_HIDDEN_NATURE, &value);
+
+    boxMon->checksum = CalculateBoxMonChecksum(boxMon);
+    EncryptBoxMon(boxMon);
 
     GiveBoxMonInitialMoveset(boxMon);
 }
@@ -5484,7 +4144,8 @@ void CreateMonWithEVSpreadNatureOTID(struct Pokemon *mon, u16 species, u8 level,
         evsBits >>= 1;
     }
 
-    if (gSaveBlock1Ptr->tx_Challenges_NoEVs == 0)
+    // A few Battle Tent mons have no EV spread.
+    if (gSaveBlock1Ptr->tx_Challenges_NoEVs == 0 && statCount != 0)
     {
         evAmount = MAX_TOTAL_EVS / statCount;
         evsBits = 1;
@@ -5725,7 +4386,6 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 {                                                               \
     u8 baseStat = gSpeciesInfo[species].base;                   \
     s32 n = (((2 * baseStat + iv + ev / 4) * level) / 100) + 5; \
-    u8 nature = GetNature(mon, TRUE);                                 \
     n = ModifyStatByNature(nature, n, statIndex);               \
     SetMonData(mon, field, &n);                                 \
 }
@@ -5734,7 +4394,6 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 {                                                               \
     u8 baseStat = gSpeciesInfo[species].base;                   \
     s32 n = (((2 * baseStat + iv + ev / 4) * 50) / 100) + 5; \
-    u8 nature = GetNature(mon, TRUE);                                 \
     n = ModifyStatByNature(nature, n, statIndex);               \
     SetMonData(mon, field, &n);                                 \
 }
@@ -5743,7 +4402,6 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 {                                                               \
     u16 baseStat[] = {100, 255, 500};                                         \
     s32 n = (((2 * baseStat[option] + iv + ev / 4) * level) / 100) + 5; \
-    u8 nature = GetNature(mon, TRUE);                                 \
     n = ModifyStatByNature(nature, n, statIndex);               \
     SetMonData(mon, field, &n);                                 \
 }
@@ -5752,31 +4410,53 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 {                                                               \
     u16 baseStat[] = {100, 255, 500};                                         \
     s32 n = (((2 * baseStat[option] + iv + ev / 4) * 50) / 100) + 5; \
-    u8 nature = GetNature(mon, TRUE);                                 \
     n = ModifyStatByNature(nature, n, statIndex);               \
     SetMonData(mon, field, &n);                                 \
 }
 
 void CalculateMonStats(struct Pokemon *mon)
 {
+    // Everything encrypted that the stats depend on, read with one decrypt
+    static const s32 sFields[] = {
+        MON_DATA_HP_IV, MON_DATA_HP_EV,
+        MON_DATA_ATK_IV, MON_DATA_ATK_EV,
+        MON_DATA_DEF_IV, MON_DATA_DEF_EV,
+        MON_DATA_SPEED_IV, MON_DATA_SPEED_EV,
+        MON_DATA_SPATK_IV, MON_DATA_SPATK_EV,
+        MON_DATA_SPDEF_IV, MON_DATA_SPDEF_EV,
+        MON_DATA_SPECIES, MON_DATA_EXP, MON_DATA_HIDDEN_NATURE,
+    };
+    u32 values[ARRAY_COUNT(sFields)];
     s32 oldMaxHP = GetMonData(mon, MON_DATA_MAX_HP, NULL);
     s32 currentHP = GetMonData(mon, MON_DATA_HP, NULL);
-    s32 hpIV = GetMonData(mon, MON_DATA_HP_IV, NULL);
-    s32 hpEV = GetMonData(mon, MON_DATA_HP_EV, NULL);
-    s32 attackIV = GetMonData(mon, MON_DATA_ATK_IV, NULL);
-    s32 attackEV = GetMonData(mon, MON_DATA_ATK_EV, NULL);
-    s32 defenseIV = GetMonData(mon, MON_DATA_DEF_IV, NULL);
-    s32 defenseEV = GetMonData(mon, MON_DATA_DEF_EV, NULL);
-    s32 speedIV = GetMonData(mon, MON_DATA_SPEED_IV, NULL);
-    s32 speedEV = GetMonData(mon, MON_DATA_SPEED_EV, NULL);
-    s32 spAttackIV = GetMonData(mon, MON_DATA_SPATK_IV, NULL);
-    s32 spAttackEV = GetMonData(mon, MON_DATA_SPATK_EV, NULL);
-    s32 spDefenseIV = GetMonData(mon, MON_DATA_SPDEF_IV, NULL);
-    s32 spDefenseEV = GetMonData(mon, MON_DATA_SPDEF_EV, NULL);
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    s32 level = GetLevelFromMonExp(mon);
+    s32 hpIV, hpEV, attackIV, attackEV, defenseIV, defenseEV;
+    s32 speedIV, speedEV, spAttackIV, spAttackEV, spDefenseIV, spDefenseEV;
+    u16 species;
+    s32 level;
+    u8 nature;
     s32 newMaxHP;
 
+    GetBoxMonDataFields(&mon->box, sFields, values, ARRAY_COUNT(sFields));
+    hpIV = values[0];
+    hpEV = values[1];
+    attackIV = values[2];
+    attackEV = values[3];
+    defenseIV = values[4];
+    defenseEV = values[5];
+    speedIV = values[6];
+    speedEV = values[7];
+    spAttackIV = values[8];
+    spAttackEV = values[9];
+    spDefenseIV = values[10];
+    spDefenseEV = values[11];
+    species = values[12];
+    level = GetLevelFromSpeciesExp(species, values[13]);
+    // Same as GetNature(mon, TRUE)
+    if (values[14] == HIDDEN_NATURE_NONE)
+        nature = GetNatureFromPersonality(mon->box.personality);
+    else
+        nature = values[14];
+
     {
         if (FlagGet(FLAG_LIMIT_TO_50) == TRUE) //Try to limit mons to level 50 for frontier)
         {
@@ -5992,10 +4672,8 @@ void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest)
     CalculateMonStats(dest);
 }
 
-u8 GetLevelFromMonExp(struct Pokemon *mon)
+u8 GetLevelFromSpeciesExp(u16 species, u32 exp)
 {
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetMonData(mon, MON_DATA_EXP, NULL);
     s32 level = 1;
 
     while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
@@ -6004,16 +4682,19 @@ u8 GetLevelFromMonExp(struct Pokemon *mon)
     return level - 1;
 }
 
+u8 GetLevelFromMonExp(struct Pokemon *mon)
+{
+    return GetLevelFromBoxMonExp(&mon->box);
+}
+
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon)
 {
-    u16 species = GetBoxMonData(boxMon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetBoxMonData(boxMon, MON_DATA_EXP, NULL);
-    s32 level = 1;
+    static const s32 sFields[] = { MON_DATA_SPECIES, MON_DATA_EXP };
+    u32 values[ARRAY_COUNT(sFields)];
 
-    while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
-        level++;
+    GetBoxMonDataFields(boxMon, sFields, values, ARRAY_COUNT(sFields));
 
-    return level - 1;
+    return GetLevelFromSpeciesExp(values[0], values[1]);
 }
 
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move)
@@ -7147,7 +5828,7 @@ void SetMultiuseSpriteTemplateToTrainerFront(u16 trainerPicId, u8 battlerPositio
     gMultiuseSpriteTemplate.anims = gTrainerFrontAnimsPtrTable[trainerPicId];
 }
 
-static void EncryptBoxMon(struct BoxPokemon *boxMon)
+static IWRAM_FUNC(EncryptBoxMon) void EncryptBoxMon(struct BoxPokemon *boxMon)
 {
     u32 i;
     for (i = 0; i < ARRAY_COUNT(boxMon->secure.raw); i++)
@@ -7157,7 +5838,7 @@ static void EncryptBoxMon(struct BoxPokemon *boxMon)
     }
 }
 
-static void DecryptBoxMon(struct BoxPokemon *boxMon)
+static IWRAM_FUNC(DecryptBoxMon) void DecryptBoxMon(struct BoxPokemon *boxMon)
 {
     u32 i;
     for (i = 0; i < ARRAY_COUNT(boxMon->secure.raw); i++)
@@ -7326,36 +6007,40 @@ u32 GetMonData2(struct Pokemon *mon, s32 field)
     return GetMonData3(mon, field, NULL);
 }
 
-/* GameFreak called GetBoxMonData with either 2 or 3 arguments, for type
- * safety we have a GetBoxMonData macro (in include/pokemon.h) which
- * dispatches to either GetBoxMonData2 or GetBoxMonData3 based on the
- * number of arguments. */
-u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
+// Where each substruct is for boxMon's personality. They can only be read
+// or written once boxMon is decrypted.
+static void GetBoxMonSubstructs(struct BoxPokemon *boxMon, struct BoxMonSubstructs *substructs)
 {
-    s32 i;
-    u32 retVal = 0;
-    struct PokemonSubstruct0 *substruct0 = NULL;
-    struct PokemonSubstruct1 *substruct1 = NULL;
-    struct PokemonSubstruct2 *substruct2 = NULL;
-    struct PokemonSubstruct3 *substruct3 = NULL;
-
-    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
-    {
-        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
-        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
-        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
-        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
+    substructs->type0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
+    substructs->type1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
+    substructs->type2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
+    substructs->type3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
+}
 
-        DecryptBoxMon(boxMon);
+// Decrypts boxMon in place for reading and marks it as a Bad Egg if its
+// checksum is wrong. The caller must call EncryptBoxMon when done.
+static void DecryptBoxMonForRead(struct BoxPokemon *boxMon, struct BoxMonSubstructs *substructs)
+{
+    GetBoxMonSubstructs(boxMon, substructs);
+    DecryptBoxMon(boxMon);
 
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = TRUE;
-            boxMon->isEgg = TRUE;
-            substruct3->isEgg = TRUE;
-        }
+    if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+    {
+        boxMon->isBadEgg = TRUE;
+        boxMon->isEgg = TRUE;
+        substructs->type3->isEgg = TRUE;
     }
+}
+
+// Reads one field of a box mon whose substructs have already been decrypted.
+static u32 GetDecryptedBoxMonData(struct BoxPokemon *boxMon, const struct BoxMonSubstructs *substructs, s32 field, u8 *data)
+{
+    s32 i;
+    u32 retVal = 0;
+    struct PokemonSubstruct0 *substruct0 = substructs->type0;
+    struct PokemonSubstruct1 *substruct1 = substructs->type1;
+    struct PokemonSubstruct2 *substruct2 = substructs->type2;
+    struct PokemonSubstruct3 *substruct3 = substructs->type3;
 
     switch (field)
     {
@@ -7695,6 +6380,24 @@ u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
         break;
     }
 
+    return retVal;
+}
+
+/* GameFreak called GetBoxMonData with either 2 or 3 arguments, for type
+ * safety we have a GetBoxMonData macro (in include/pokemon.h) which
+ * dispatches to either GetBoxMonData2 or GetBoxMonData3 based on the
+ * number of arguments. */
+u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
+{
+    u32 retVal;
+    struct BoxMonSubstructs substructs = {0};
+
+    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+        DecryptBoxMonForRead(boxMon, &substructs);
+
+    retVal = GetDecryptedBoxMonData(boxMon, &substructs, field, data);
+
     if (field > MON_DATA_ENCRYPT_SEPARATOR)
         EncryptBoxMon(boxMon);
 
@@ -7706,6 +6409,118 @@ u32 GetBoxMonData2(struct BoxPokemon *boxMon, s32 field)
     return GetBoxMonData3(boxMon, field, NULL);
 }
 
+// Reads several fields with a single decrypt/checksum/encrypt pass, storing
+// values[i] = GetBoxMonData(boxMon, fields[i]). Fields that write to a
+// buffer (nickname, OT name, known moves) aren't supported.
+void GetBoxMonDataFields(struct BoxPokemon *boxMon, const s32 *fields, u32 *values, u32 count)
+{
+    u32 i;
+    bool32 encrypted = FALSE;
+    struct BoxMonSubstructs substructs = {0};
+
+    for (i = 0; i < count; i++)
+    {
+        if (fields[i] > MON_DATA_ENCRYPT_SEPARATOR)
+        {
+            encrypted = TRUE;
+            break;
+        }
+    }
+
+    if (encrypted)
+        DecryptBoxMonForRead(boxMon, &substructs);
+
+    for (i = 0; i < count; i++)
+        values[i] = GetDecryptedBoxMonData(boxMon, &substructs, fields[i], NULL);
+
+    if (encrypted)
+        EncryptBoxMon(boxMon);
+}
+
+// Fills in what the PC and other list views show for a box mon, decrypting
+// it only once.
+void GetBoxMonSummary(struct BoxPokemon *boxMon, struct BoxMonSummary *summary)
+{
+    static const s32 sFields[] = {
+        MON_DATA_SPECIES,
+        MON_DATA_SPECIES_OR_EGG,
+        MON_DATA_EXP,
+        MON_DATA_HELD_ITEM,
+        MON_DATA_IS_EGG,
+        MON_DATA_NUZLOCKE_RIBBON,
+    };
+    u32 values[ARRAY_COUNT(sFields)];
+
+    GetBoxMonDataFields(boxMon, sFields, values, ARRAY_COUNT(sFields));
+
+    summary->personality = boxMon->personality;
+    summary->checksum = boxMon->checksum;
+    summary->species = values[0];
+    summary->speciesOrEgg = values[1];
+    summary->heldItem = values[3];
+    summary->level = GetLevelFromSpeciesExp(values[0], values[2]);
+    summary->isEgg = values[4];
+    summary->isBadEgg = boxMon->isBadEgg;
+    summary->hasSpecies = boxMon->hasSpecies;
+    summary->sanityIsEgg = boxMon->isEgg;
+    summary->nuzlockeRibbon = values[5];
+}
+
+#define CREATE_MON_BENCHMARK_COUNT 32
+
+// Prints how many cycles CreateMon, CalculateMonStats and one SetBoxMonData
+// on an encrypted field take. CreateBoxMon used to make 27 of those
+// SetBoxMonData calls, each decrypting and encrypting the whole mon.
+void DebugBenchmarkCreateMon(void)
+{
+#ifndef NDEBUG
+    struct Pokemon *mon;
+    u32 i, value, rngValue, rng2Value, cycles[3];
+    s32 levelUpHP = gBattleScripting.levelUpHP;
+
+    mon = AllocZeroed(sizeof(*mon));
+    if (mon == NULL)
+        return;
+
+    // So running the benchmark doesn't change what the game rolls next
+    rngValue = gRngValue;
+    rng2Value = gRng2Value;
+
+    REG_TM2CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_64CLK;
+    for (i = 0; i < CREATE_MON_BENCHMARK_COUNT; i++)
+        CreateMon(mon, SPECIES_BULBASAUR + i, 50, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    cycles[0] = REG_TM2CNT_L * 64;
+
+    REG_TM2CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_64CLK;
+    for (i = 0; i < CREATE_MON_BENCHMARK_COUNT; i++)
+        CalculateMonStats(mon);
+    cycles[1] = REG_TM2CNT_L * 64;
+
+    REG_TM2CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_64CLK;
+    for (i = 0; i < CREATE_MON_BENCHMARK_COUNT; i++)
+    {
+        value = i;
+        SetBoxMonData(&mon->box, MON_DATA_HP_EV, &value);
+    }
+    cycles[2] = REG_TM2CNT_L * 64;
+    REG_TM2CNT_H = 0;
+
+    gRngValue = rngValue;
+    gRng2Value = rng2Value;
+    gBattleScripting.levelUpHP = levelUpHP;
+    Free(mon);
+
+    DebugPrintf("mon: CreateMon=%d CalculateMonStats=%d SetBoxMonData=%d cycles per call",
+                cycles[0] / CREATE_MON_BENCHMARK_COUNT, cycles[1] / CREATE_MON_BENCHMARK_COUNT, cycles[2] / CREATE_MON_BENCHMARK_COUNT);
+#endif
+}
+
 #define SET8(lhs) (lhs) = *data
 #define SET16(lhs) (lhs) = data[0] + (data[1] << 8)
 #define SET32(lhs) (lhs) = data[0] + (data[1] << 8) + (data[2] << 16) + (data[3] << 24)
@@ -7754,33 +6569,15 @@ void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg)
     }
 }
 
-void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
+// Writes one field of a box mon whose substructs have already been decrypted.
+// The caller is responsible for the checksum and for encrypting it again.
+static void SetDecryptedBoxMonData(struct BoxPokemon *boxMon, const struct BoxMonSubstructs *substructs, s32 field, const void *dataArg)
 {
     const u8 *data = dataArg;
-
-    struct PokemonSubstruct0 *substruct0 = NULL;
-    struct PokemonSubstruct1 *substruct1 = NULL;
-    struct PokemonSubstruct2 *substruct2 = NULL;
-    struct PokemonSubstruct3 *substruct3 = NULL;
-
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
-    {
-        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
-        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
-        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
-        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
-
-        DecryptBoxMon(boxMon);
-
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = TRUE;
-            boxMon->isEgg = TRUE;
-            substruct3->isEgg = TRUE;
-            EncryptBoxMon(boxMon);
-            return;
-        }
-    }
+    struct PokemonSubstruct0 *substruct0 = substructs->type0;
+    struct PokemonSubstruct1 *substruct1 = substructs->type1;
+    struct PokemonSubstruct2 *substruct2 = substructs->type2;
+    struct PokemonSubstruct3 *substruct3 = substructs->type3;
 
     switch (field)
     {
@@ -8032,6 +6829,28 @@ void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
     default:
         break;
     }
+}
+
+void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
+{
+    struct BoxMonSubstructs substructs = {0};
+
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    {
+        GetBoxMonSubstructs(boxMon, &substructs);
+        DecryptBoxMon(boxMon);
+
+        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+        {
+            boxMon->isBadEgg = TRUE;
+            boxMon->isEgg = TRUE;
+            substructs.type3->isEgg = TRUE;
+            EncryptBoxMon(boxMon);
+            return;
+        }
+    }
+
+    SetDecryptedBoxMonData(boxMon, &substructs, field, dataArg);
 
     if (field > MON_DATA_ENCRYPT_SEPARATOR)
     {
@@ -8273,7 +7092,7 @@ bool8 IsPokemonStorageFull(void)
 
     for (i = 0; i < TOTAL_BOXES_COUNT; i++)
         for (j = 0; j < IN_BOX_COUNT; j++)
-            if (GetBoxMonDataAt(i, j, MON_DATA_SPECIES) == SPECIES_NONE)
+            if (GetBoxMonSummaryAt(i, j)->species == SPECIES_NONE)
                 return FALSE;
 
     return TRUE;
@@ -9399,56 +8218,26 @@ u16 GetEvolutionTargetSpecies(struct Pokemon *mon, u8 mode, u16 evolutionItem)
 
 u16 HoennPokedexNumToSpecies(u16 hoennNum)
 {
-    u16 species;
-
-    if (!hoennNum)
-        return 0;
-
-    species = 0;
-
-    while (species < (NUM_SPECIES - 1) && sSpeciesToHoennPokedexNum[species] != hoennNum)
-        species++;
-
-    if (species == NUM_SPECIES - 1)
+    if (!hoennNum || hoennNum >= NUM_SPECIES)
         return 0;
 
-    return species + 1;
+    return sHoennPokedexNumToSpecies[hoennNum - 1];
 }
 
 u16 NationalPokedexNumToSpecies(u16 nationalNum)
 {
-    u16 species;
-
-    if (!nationalNum)
+    if (!nationalNum || nationalNum >= NUM_SPECIES)
         return 0;
 
-    species = 0;
-
-    while (species < (NUM_SPECIES - 1) && sSpeciesToNationalPokedexNum[species] != nationalNum)
-        species++;
-
-    if (species == NUM_SPECIES - 1)
-        return 0;
-
-    return species + 1;
+    return sNationalPokedexNumToSpecies[nationalNum - 1];
 }
 
 u16 NationalToHoennOrder(u16 nationalNum)
 {
-    u16 hoennNum;
-
-    if (!nationalNum)
+    if (!nationalNum || nationalNum >= NUM_SPECIES)
         return 0;
 
-    hoennNum = 0;
-
-    while (hoennNum < (NUM_SPECIES - 1) && sHoennToNationalOrder[hoennNum] != nationalNum)
-        hoennNum++;
-
-    if (hoennNum == NUM_SPECIES - 1)
-        return 0;
-
-    return hoennNum + 1;
+    return sNationalToHoennOrder[nationalNum - 1];
 }
 
 u16 SpeciesToNationalPokedexNum(u16 species)
@@ -11933,7 +10722,35 @@ u16 PickRandomStarter(u16 *speciesList, u8 starterId)
     } 
 }
 
-u8 GetTypeBySpecies(u16 species, u8 typeNum)
+// Randomizer lookup tables. The randomized species, moves and types only depend on the
+// trainer id and a handful of options, so they are computed once per save instead of
+// rehashing on every call. Chaos mode rerolls every call and bypasses the tables.
+#define RANDOM_MOVE_TABLE_SIZE (MOVES_COUNT + NUM_SPECIES)
+
+#define RANDOMIZER_OPT_SIMILAR       (1 << 0)
+#define RANDOMIZER_OPT_LEGENDARIES   (1 << 1)
+#define RANDOMIZER_OPT_MODERN_TYPES  (1 << 2)
+#define RANDOMIZER_OPT_FAIRY_TYPES   (1 << 3)
+#define RANDOMIZER_OPT_RANDOM_TYPE   (1 << 4)
+#define RANDOMIZER_OPT_BUILT         (1 << 7)
+
+#define RANDOMIZER_WILD_MAPSEC_UNSET 0xFFFF
+
+struct RandomizerTables
+{
+    u32 otId;
+    u8 options;
+    u16 wildMapSec;
+    u16 species[NUM_SPECIES];           // species not based on the map section
+    u16 moveSpecies[NUM_SPECIES];       // TX_RANDOM_T_MOVES
+    u16 wildSpecies[NUM_SPECIES];       // species based on wildMapSec
+    u16 moves[RANDOM_MOVE_TABLE_SIZE];  // indexed by move + species
+    u8 types[NUM_SPECIES][2];
+};
+
+EWRAM_DATA static struct RandomizerTables sRandomizerTables = {0};
+
+static u8 ComputeTypeBySpecies(u16 species, u8 typeNum)
 {
     u8 type;
 
@@ -12009,19 +10826,12 @@ u8 GetTypeBySpecies(u16 species, u8 typeNum)
     if (!gSaveBlock1Ptr->tx_Random_Type)
         return type;
 
-    type = sOneTypeChallengeValidTypes[RandomSeededModulo(type + typeNum + species, NUMBER_OF_MON_TYPES-1)];
-
-    #ifndef NDEBUG
-    if (gSaveBlock1Ptr->tx_Random_Type)
-        MgbaPrintf(MGBA_LOG_DEBUG, "TX RANDOM TYPE%d: species=%d=%S; type=%d=%S", typeNum, species, gSpeciesNames[species], type, gTypeNames[type]);
-    #endif
-
-    return type;
+    return sOneTypeChallengeValidTypes[RandomSeededModulo(type + typeNum + species, NUMBER_OF_MON_TYPES-1)];
 }
 
 static u16 GetRandomSpecies(u16 species, u8 mapBased, u8 type, u16 additionalOffset) //INTERNAL use only!
 {
-    u8 slot, slotNew;
+    u8 slot;
     u16 mapOffset = 0; //12289, 49157
     if (mapBased)
         mapOffset = NuzlockeGetCurrentRegionMapSectionId();
@@ -12048,11 +10858,6 @@ static u16 GetRandomSpecies(u16 species, u8 mapBased, u8 type, u16 additionalOff
             break;
         }
 
-        #ifndef NDEBUG
-        slotNew = gSpeciesMapping[speciesResult];
-        MgbaPrintf(MGBA_LOG_DEBUG, "%S: species=%d=%S; mapBased=%d; speciesResult=%d=%S; %S-->>%S", gRandomizationTypes[type], species, gSpeciesNames[species], mapBased, speciesResult, gSpeciesNames[speciesResult], gEvoStages[slot], gEvoStages[slotNew]);
-        #endif
-
         return speciesResult;
     }
 
@@ -12061,9 +10866,9 @@ static u16 GetRandomSpecies(u16 species, u8 mapBased, u8 type, u16 additionalOff
 
     return sRandomSpecies[RandomSeededModulo(species + mapOffset + additionalOffset, RANDOM_SPECIES_COUNT)];
 }
-u16 GetSpeciesRandomSeeded(u16 species, u8 type, u16 additionalOffset)
+static u16 ComputeSpeciesRandomSeeded(u16 species, u8 type, u16 additionalOffset)
 {
-    u8 slot, slotNew;
+    u8 slot;
     u16 speciesResult = species;
     u8 mapBased = FALSE;
 
@@ -12108,16 +10913,135 @@ u16 GetSpeciesRandomSeeded(u16 species, u8 type, u16 additionalOffset)
     return speciesResult;
 }
 
+static u16 ComputeRandomMove(u16 move, u16 species)
+{
+    return sRandomValidMoves[RandomSeededModulo(move + species, RANDOM_MOVES_COUNT)];
+}
+
+static u8 GetRandomizerTableOptions(void)
+{
+    u8 options = RANDOMIZER_OPT_BUILT;
+
+    if (gSaveBlock1Ptr->tx_Random_Similar)
+        options |= RANDOMIZER_OPT_SIMILAR;
+    if (gSaveBlock1Ptr->tx_Random_IncludeLegendaries)
+        options |= RANDOMIZER_OPT_LEGENDARIES;
+    if (gSaveBlock1Ptr->tx_Mode_Modern_Types)
+        options |= RANDOMIZER_OPT_MODERN_TYPES;
+    if (gSaveBlock1Ptr->tx_Mode_Fairy_Types)
+        options |= RANDOMIZER_OPT_FAIRY_TYPES;
+    if (gSaveBlock1Ptr->tx_Random_Type)
+        options |= RANDOMIZER_OPT_RANDOM_TYPE;
+
+    return options;
+}
+
+void BuildRandomizerTables(void)
+{
+    u16 i;
+
+    sRandomizerTables.otId = GetTrainerId(gSaveBlock2Ptr->playerTrainerId);
+    sRandomizerTables.options = GetRandomizerTableOptions();
+    sRandomizerTables.wildMapSec = RANDOMIZER_WILD_MAPSEC_UNSET;
+
+    // ComputeSpeciesRandomSeeded only uses the map section for wild and trainer mons,
+    // every other non chaos type shares the same mapping.
+    for (i = 0; i < NUM_SPECIES; i++)
+    {
+        sRandomizerTables.species[i] = ComputeSpeciesRandomSeeded(i, TX_RANDOM_T_STATIC, 0);
+        sRandomizerTables.moveSpecies[i] = ComputeSpeciesRandomSeeded(i, TX_RANDOM_T_MOVES, 0);
+        sRandomizerTables.types[i][0] = ComputeTypeBySpecies(i, 1);
+        sRandomizerTables.types[i][1] = ComputeTypeBySpecies(i, 2);
+    }
+
+    for (i = 0; i < RANDOM_MOVE_TABLE_SIZE; i++)
+        sRandomizerTables.moves[i] = ComputeRandomMove(i, 0);
+}
+
+static void BuildWildRandomizerTable(u16 mapSec)
+{
+    u16 i;
+
+    for (i = 0; i < NUM_SPECIES; i++)
+        sRandomizerTables.wildSpecies[i] = ComputeSpeciesRandomSeeded(i, TX_RANDOM_T_WILD_POKEMON, 0);
+    sRandomizerTables.wildMapSec = mapSec;
+}
+
+static bool8 UseRandomizerTables(void)
+{
+    if (gSaveBlock1Ptr->tx_Random_Chaos)
+        return FALSE;
+
+    if (sRandomizerTables.options != GetRandomizerTableOptions()
+     || sRandomizerTables.otId != GetTrainerId(gSaveBlock2Ptr->playerTrainerId))
+        BuildRandomizerTables();
+
+    return TRUE;
+}
+
+u8 GetTypeBySpecies(u16 species, u8 typeNum)
+{
+    if (species >= NUM_SPECIES || (typeNum != 1 && typeNum != 2) || !UseRandomizerTables())
+        return ComputeTypeBySpecies(species, typeNum);
+
+    return sRandomizerTables.types[species][typeNum - 1];
+}
+
+u16 GetSpeciesRandomSeeded(u16 species, u8 type, u16 additionalOffset)
+{
+    u16 mapSec;
+
+    if (species >= NUM_SPECIES || additionalOffset != 0 || !UseRandomizerTables())
+        return ComputeSpeciesRandomSeeded(species, type, additionalOffset);
+
+    switch (type)
+    {
+    case TX_RANDOM_T_WILD_POKEMON:
+    case TX_RANDOM_T_TRAINER:
+        if (!gSaveBlock1Ptr->tx_Random_MapBased)
+            return sRandomizerTables.species[species];
+        mapSec = NuzlockeGetCurrentRegionMapSectionId();
+        if (sRandomizerTables.wildMapSec != mapSec)
+            BuildWildRandomizerTable(mapSec);
+        return sRandomizerTables.wildSpecies[species];
+    case TX_RANDOM_T_MOVES:
+        return sRandomizerTables.moveSpecies[species];
+    case TX_RANDOM_T_ABILITY:
+    case TX_RANDOM_T_EVO:
+    case TX_RANDOM_T_EVO_METH:
+    case TX_RANDOM_T_STATIC:
+        return sRandomizerTables.species[species];
+    }
+
+    return species;
+}
+
 u16 GetRandomMove(u16 move, u16 species)
 {
-    u16 val = RandomSeededModulo(move + species, RANDOM_MOVES_COUNT);
-    u16 final = sRandomValidMoves[val];
+    if (move + species >= RANDOM_MOVE_TABLE_SIZE || !UseRandomizerTables())
+        return ComputeRandomMove(move, species);
 
+    return sRandomizerTables.moves[move + species];
+}
+
+void DebugPrintRandomizerTables(void)
+{
     #ifndef NDEBUG
-        MgbaPrintf(MGBA_LOG_DEBUG, "TX RANDOM MOVE     : GetRandomMove: move=%d=%S, species=%d; combined=%d; val=%d; final=%d=%S", move,  gMoveNames[move], species, move + species, val, final, gMoveNames[final]);
-    #endif
+    u16 i;
 
-    return final;
+    UseRandomizerTables();
+    MgbaPrintf(MGBA_LOG_DEBUG, "TX RANDOMIZER TABLES: otId=%x; options=%x; wildMapSec=%d", sRandomizerTables.otId, sRandomizerTables.options, sRandomizerTables.wildMapSec);
+    for (i = 0; i < NUM_SPECIES; i++)
+    {
+        MgbaPrintf(MGBA_LOG_DEBUG, "%d=%S (%S): species=%d=%S; moves=%d; wild=%d; types=%S/%S",
+            i, gSpeciesNames[i], gEvoStages[gSpeciesMapping[i]],
+            sRandomizerTables.species[i], gSpeciesNames[sRandomizerTables.species[i]],
+            sRandomizerTables.moveSpecies[i], sRandomizerTables.wildSpecies[i],
+            gTypeNames[sRandomizerTables.types[i][0]], gTypeNames[sRandomizerTables.types[i][1]]);
+    }
+    for (i = 0; i < RANDOM_MOVE_TABLE_SIZE; i++)
+        MgbaPrintf(MGBA_LOG_DEBUG, "move+species=%d: move=%d=%S", i, sRandomizerTables.moves[i], gMoveNames[sRandomizerTables.moves[i]]);
+    #endif
 }
 
 u8 GetRandomType(void)
@@ -575,6 +575,8 @@ EWRAM_DATA static u8 sWhichToReshow = 0;
 EWRAM_DATA static u8 sLastUsedBox = 0;
 EWRAM_DATA static u16 sMovingItemId = 0;
 EWRAM_DATA static struct Pokemon sSavedMovingMon = {0};
+EWRAM_DATA static struct BoxMonSummary sBoxMonSummaries[TOTAL_BOXES_COUNT][IN_BOX_COUNT] = {0};
+EWRAM_DATA static u32 sBoxMonSummariesFilled[TOTAL_BOXES_COUNT] = {0};
 EWRAM_DATA static s8 sCursorArea = 0;
 EWRAM_DATA static s8 sCursorPosition = 0;
 EWRAM_DATA static bool8 sIsMonBeingMoved = 0;
@@ -913,10 +915,10 @@ s32 StorePokemonInBox(struct BoxPokemon *src, u8 *boxId, u8 *position)
     {
         for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
         {
-            if (GetBoxMonDataAt(boxIdTemp, boxPosition, MON_DATA_SPECIES) == SPECIES_NONE)
+            if (GetBoxMonSummaryAt(boxIdTemp, boxPosition)->species == SPECIES_NONE)
             {
                 // Copy mon to box
-                gPokemonStoragePtr->boxes[boxIdTemp][boxPosition] = *src;
+                SetBoxMonAt(boxIdTemp, boxPosition, src);
 
                 if (boxId != NULL)
                     *boxId = boxIdTemp;
@@ -1438,7 +1440,7 @@ u8 CountMonsInBox(u8 boxId)
 
     for (i = 0, count = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) != SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i)->species != SPECIES_NONE)
             count++;
     }
 
@@ -1451,7 +1453,7 @@ s16 GetFirstFreeBoxSpot(u8 boxId)
 
     for (i = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) == SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i)->species == SPECIES_NONE)
             return i;
     }
 
@@ -4540,8 +4542,7 @@ static void InitBoxMonSprites(u8 boxId)
 {
     u8 boxPosition;
     u16 i, j, count;
-    u16 species;
-    u32 personality;
+    const struct BoxMonSummary *summary;
 
     count = 0;
     boxPosition = 0;
@@ -4551,13 +4552,12 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            species = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG);
-            if (species != SPECIES_NONE)
+            summary = GetBoxMonSummaryAt(boxId, boxPosition);
+            if (summary->speciesOrEgg != SPECIES_NONE)
             {
-                personality = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
-                sStorage->boxMonsSprites[count] = CreateMonIconSprite(species, personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
+                sStorage->boxMonsSprites[count] = CreateMonIconSprite(summary->speciesOrEgg, summary->personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
                 // Locked nuzlocke mons should be transparent
-                if (GetBoxMonDataAt(boxId, boxPosition, MON_DATA_NUZLOCKE_RIBBON))
+                if (summary->nuzlockeRibbon)
                     sStorage->boxMonsSprites[count]->oam.objMode = ST_OAM_OBJ_BLEND;
             }
             else
@@ -4574,7 +4574,7 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
         {
-            if (GetBoxMonDataAt(boxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
+            if (GetBoxMonSummaryAt(boxId, boxPosition)->heldItem == ITEM_NONE)
                 sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
         }
     }
@@ -4700,7 +4700,7 @@ static u8 CreateBoxMonIconsInColumn(u8 column, u16 distance, s16 speed)
                     sStorage->boxMonsSprites[boxPosition]->sScrollInDestX = xDest;
                     sStorage->boxMonsSprites[boxPosition]->callback = SpriteCB_BoxMonIconScrollIn;
                     // Locked nuzlocke mons should be transparent
-                    if (GetBoxMonDataAt(sStorage->incomingBoxId, boxPosition, MON_DATA_NUZLOCKE_RIBBON))
+                    if (GetBoxMonSummaryAt(sStorage->incomingBoxId, boxPosition)->nuzlockeRibbon)
                         sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
                     iconsCreated++;
                 }
@@ -4726,7 +4726,7 @@ static u8 CreateBoxMonIconsInColumn(u8 column, u16 distance, s16 speed)
                     sStorage->boxMonsSprites[boxPosition]->sSpeed = speed;
                     sStorage->boxMonsSprites[boxPosition]->sScrollInDestX = xDest;
                     sStorage->boxMonsSprites[boxPosition]->callback = SpriteCB_BoxMonIconScrollIn;
-                    if (GetBoxMonDataAt(sStorage->incomingBoxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
+                    if (GetBoxMonSummaryAt(sStorage->incomingBoxId, boxPosition)->heldItem == ITEM_NONE)
                         sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
                     iconsCreated++;
                 }
@@ -4815,18 +4815,15 @@ static bool8 UpdateBoxMonIconScroll(void)
 
 static void GetIncomingBoxMonData(u8 boxId)
 {
-    s32 i, j, boxPosition;
+    s32 boxPosition;
+    const struct BoxMonSummary *summary;
 
-    boxPosition = 0;
-    for (i = 0; i < IN_BOX_ROWS; i++)
+    for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
     {
-        for (j = 0; j < IN_BOX_COLUMNS; j++)
-        {
-            sStorage->boxSpecies[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG);
-            if (sStorage->boxSpecies[boxPosition] != SPECIES_NONE)
-                sStorage->boxPersonalities[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
-            boxPosition++;
-        }
+        summary = GetBoxMonSummaryAt(boxId, boxPosition);
+        sStorage->boxSpecies[boxPosition] = summary->speciesOrEgg;
+        if (sStorage->boxSpecies[boxPosition] != SPECIES_NONE)
+            sStorage->boxPersonalities[boxPosition] = summary->personality;
     }
 
     sStorage->incomingBoxId = boxId;
@@ -9690,10 +9687,58 @@ u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request)
         return 0;
 }
 
+// The storage helpers below drop a slot's summary whenever they write to it,
+// and loading a save drops them all. Code that writes through
+// GetBoxedMonPtr is only caught by GetBoxMonSummaryAt comparing the slot's
+// plaintext header, which can miss a write that leaves the checksum as it
+// was, so such code should call InvalidateBoxMonSummaryAt.
+void InvalidateBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+        sBoxMonSummariesFilled[boxId] &= ~(1u << boxPosition);
+}
+
+void InvalidateBoxMonSummaries(void)
+{
+    memset(sBoxMonSummariesFilled, 0, sizeof(sBoxMonSummariesFilled));
+}
+
+// Returns the cached summary of a box slot, refreshing it first if it was
+// never filled or invalidated since, or if the slot's plaintext header no
+// longer matches it.
+const struct BoxMonSummary *GetBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    static const struct BoxMonSummary sEmptySummary = {0};
+    struct BoxPokemon *boxMon;
+    struct BoxMonSummary *summary;
+
+    if (boxId >= TOTAL_BOXES_COUNT || boxPosition >= IN_BOX_COUNT)
+        return &sEmptySummary;
+
+    boxMon = &gPokemonStoragePtr->boxes[boxId][boxPosition];
+    summary = &sBoxMonSummaries[boxId][boxPosition];
+
+    if (!(sBoxMonSummariesFilled[boxId] & (1u << boxPosition))
+     || summary->personality != boxMon->personality
+     || summary->checksum != boxMon->checksum
+     || summary->isBadEgg != boxMon->isBadEgg
+     || summary->hasSpecies != boxMon->hasSpecies
+     || summary->sanityIsEgg != boxMon->isEgg)
+    {
+        GetBoxMonSummary(boxMon, summary);
+        sBoxMonSummariesFilled[boxId] |= 1u << boxPosition;
+    }
+
+    return summary;
+}
+
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         SetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], request, value);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 u32 GetCurrentBoxMonData(u8 boxPosition, s32 request)
@@ -9731,7 +9776,10 @@ u32 GetBoxMonLevelAt(u8 boxId, u8 boxPosition)
 void SetBoxMonNickAt(u8 boxId, u8 boxPosition, const u8 *nick)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         SetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], MON_DATA_NICKNAME, nick);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 u32 GetAndCopyBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, void *dst)
@@ -9745,7 +9793,10 @@ u32 GetAndCopyBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, void *dst)
 void SetBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon *src)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         gPokemonStoragePtr->boxes[boxId][boxPosition] = *src;
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 void CopyBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon *dst)
@@ -9764,13 +9815,17 @@ void CreateBoxMonAt(u8 boxId, u8 boxPosition, u16 species, u8 level, u8 fixedIV,
                      fixedIV,
                      hasFixedPersonality, personality,
                      otIDType, otID);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
     }
 }
 
 void ZeroBoxMonAt(u8 boxId, u8 boxPosition)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         ZeroBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition]);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 void BoxMonAtToMon(u8 boxId, u8 boxPosition, struct Pokemon *dst)
@@ -0,0 +1,202 @@
+#include "global.h"
+#include "profiler.h"
+
+// Timer 1 counts in 64 cycle ticks. m4a has timer 0, the flash driver and
+// the benchmarks timer 2 and link timer 3, while timer 1 only runs between
+// the title screen and the trainer ID being picked. Zones are told apart by
+// 16 bit differences, so they can be up to about 15 frames long.
+#define PROFILER_TIMER_FLAGS (TIMER_ENABLE | TIMER_64CLK)
+#define TICKS_TO_CYCLES(ticks) ((ticks) * 64)
+
+static EWRAM_DATA bool8 sProfilerEnabled = FALSE;
+static EWRAM_DATA bool8 sProfilerLogging = FALSE;
+static EWRAM_DATA u32 sReportCount = 0;
+static EWRAM_DATA struct ProfileZoneStats sReport[PROFILE_ZONE_COUNT] = {0};
+
+#ifndef NDEBUG
+static EWRAM_DATA bool8 sProfilerFrameStarted = FALSE;
+static EWRAM_DATA u16 sFrameStart = 0;
+static EWRAM_DATA u16 sWindowFrames = 0;
+// Zones in the vblank interrupt and the main loop update these at the same
+// time, so each zone has its own entries rather than sharing a bitmask.
+static EWRAM_DATA bool8 sZoneOpen[PROFILE_ZONE_COUNT] = {0};
+static EWRAM_DATA u16 sZoneStart[PROFILE_ZONE_COUNT] = {0};
+static EWRAM_DATA u32 sZoneFrameTicks[PROFILE_ZONE_COUNT] = {0};
+static EWRAM_DATA u32 sZoneMinTicks[PROFILE_ZONE_COUNT] = {0};
+static EWRAM_DATA u32 sZoneMaxTicks[PROFILE_ZONE_COUNT] = {0};
+static EWRAM_DATA u32 sZoneTotalTicks[PROFILE_ZONE_COUNT] = {0};
+#endif
+
+static const char *const sProfileZoneNames[PROFILE_ZONE_COUNT] =
+{
+    [PROFILE_ZONE_FRAME]           = "frame",
+    [PROFILE_ZONE_CB1]             = "cb1",
+    [PROFILE_ZONE_CB2]             = "cb2",
+    [PROFILE_ZONE_RUN_TASKS]       = "tasks",
+    [PROFILE_ZONE_ANIMATE_SPRITES] = "sprites",
+    [PROFILE_ZONE_BUILD_OAM]       = "oam",
+    [PROFILE_ZONE_WAIT_VBLANK]     = "idle",
+    [PROFILE_ZONE_VBLANK]          = "vblank",
+    [PROFILE_ZONE_VBLANK_CB]       = "vbl cb",
+    [PROFILE_ZONE_TRANSFER_PLTT]   = "pltt",
+    [PROFILE_ZONE_DMA3]            = "dma3",
+    [PROFILE_ZONE_M4A]             = "m4a",
+};
+
+#ifndef NDEBUG
+static void ResetProfilerWindow(void)
+{
+    u32 i;
+
+    for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+    {
+        sZoneMinTicks[i] = 0xFFFFFFFF;
+        sZoneMaxTicks[i] = 0;
+        sZoneTotalTicks[i] = 0;
+    }
+    sWindowFrames = 0;
+}
+
+static void StartProfilerTimer(void)
+{
+    REG_TM1CNT_H = 0;
+    REG_TM1CNT_L = 0;
+    REG_TM1CNT_H = PROFILER_TIMER_FLAGS;
+    sProfilerFrameStarted = FALSE;
+}
+
+void ProfilerBeginZone(u32 zone)
+{
+    if (sProfilerEnabled)
+    {
+        sZoneStart[zone] = REG_TM1CNT_L;
+        sZoneOpen[zone] = TRUE;
+    }
+}
+
+void ProfilerEndZone(u32 zone)
+{
+    // A zone that was already running when the profiler was turned on
+    // isn't counted.
+    if (sZoneOpen[zone])
+    {
+        sZoneFrameTicks[zone] += (u16)(REG_TM1CNT_L - sZoneStart[zone]);
+        sZoneOpen[zone] = FALSE;
+    }
+}
+
+static void PublishProfilerReport(void)
+{
+    u32 i;
+
+    for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+    {
+        sReport[i].min = TICKS_TO_CYCLES(sZoneMinTicks[i]);
+        sReport[i].avg = TICKS_TO_CYCLES(sZoneTotalTicks[i] / PROFILER_WINDOW_FRAMES);
+        sReport[i].max = TICKS_TO_CYCLES(sZoneMaxTicks[i]);
+    }
+    sReportCount++;
+
+    if (sProfilerLogging)
+    {
+        DebugPrintf("profile: cycles per frame over %d frames, min/avg/max", PROFILER_WINDOW_FRAMES);
+        for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+            DebugPrintf("profile: %s %d/%d/%d", sProfileZoneNames[i], sReport[i].min, sReport[i].avg, sReport[i].max);
+    }
+}
+
+// Called once per pass of the main loop, just after the vblank.
+void ProfilerEndFrame(void)
+{
+    u16 now;
+    u32 i;
+
+    if (!sProfilerEnabled)
+        return;
+
+    // Picking the trainer ID stops timer 1, and the title screen restarts
+    // it at a different rate.
+    if (REG_TM1CNT_H != PROFILER_TIMER_FLAGS)
+        StartProfilerTimer();
+
+    now = REG_TM1CNT_L;
+    sZoneFrameTicks[PROFILE_ZONE_FRAME] = (u16)(now - sFrameStart);
+    sFrameStart = now;
+
+    // The first frame is only partly covered by the zones.
+    if (sProfilerFrameStarted)
+    {
+        for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+        {
+            u32 ticks = sZoneFrameTicks[i];
+
+            if (ticks < sZoneMinTicks[i])
+                sZoneMinTicks[i] = ticks;
+            if (ticks > sZoneMaxTicks[i])
+                sZoneMaxTicks[i] = ticks;
+            sZoneTotalTicks[i] += ticks;
+        }
+        if (++sWindowFrames == PROFILER_WINDOW_FRAMES)
+        {
+            PublishProfilerReport();
+            ResetProfilerWindow();
+        }
+    }
+    sProfilerFrameStarted = TRUE;
+
+    for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+        sZoneFrameTicks[i] = 0;
+}
+#endif
+
+void EnableProfiler(bool32 log)
+{
+#ifndef NDEBUG
+    sProfilerLogging = log;
+    if (sProfilerEnabled)
+        return;
+
+    ResetProfilerWindow();
+    StartProfilerTimer();
+    sProfilerEnabled = TRUE;
+#endif
+}
+
+void DisableProfiler(void)
+{
+#ifndef NDEBUG
+    u32 i;
+
+    sProfilerEnabled = FALSE;
+    sProfilerLogging = FALSE;
+    for (i = 0; i < PROFILE_ZONE_COUNT; i++)
+        sZoneOpen[i] = FALSE;
+    REG_TM1CNT_H = 0;
+#endif
+}
+
+bool32 IsProfilerEnabled(void)
+{
+    return sProfilerEnabled;
+}
+
+bool32 IsProfilerLogging(void)
+{
+    return sProfilerLogging;
+}
+
+// Goes up each time a new report is ready.
+u32 GetProfilerReportCount(void)
+{
+    return sReportCount;
+}
+
+const struct ProfileZoneStats *GetProfilerReport(void)
+{
+    return sReport;
+}
+
+const char *GetProfileZoneName(u32 zone)
+{
+    return sProfileZoneNames[zone];
+}
@@ -17,6 +17,7 @@
 #include "string_util.h"
 
 static u16 CalculateChecksum(void *, u16);
+static u32 CalculateSectorHash(const void *, u16);
 static bool8 ReadFlashSector(u8, struct SaveSector *);
 static u8 GetSaveValidStatus(const struct SaveSectorLocation *);
 static u8 CopySaveSlotData(u16, struct SaveSectorLocation *);
@@ -99,10 +100,27 @@ u16 gSaveAttemptStatus;
 EWRAM_DATA struct SaveSector gSaveDataBuffer = {0}; // Buffer used for reading/writing sectors
 EWRAM_DATA static u8 sUnusedVar = 0;
 
+// What each sector of each save slot is known to hold, recorded whenever a
+// slot sector is written or read back. A normal save uses this to skip the
+// sectors of the target slot that already contain the current data.
+struct SlotSectorInfo
+{
+    u32 hash;
+    u16 checksum;
+    u8 position; // Sector within the slot
+};
+
+EWRAM_DATA static struct SlotSectorInfo sSlotSectors[NUM_SAVE_SLOTS][NUM_SECTORS_PER_SLOT] = {0};
+EWRAM_DATA static u16 sSlotSectorsKnown[NUM_SAVE_SLOTS] = {0};
+EWRAM_DATA struct SaveWriteStats gSaveWriteStats = {0};
+
 void ClearSaveData(void)
 {
     u16 i;
 
+    sSlotSectorsKnown[0] = 0;
+    sSlotSectorsKnown[1] = 0;
+
     // Clear the full save two sectors at a time
     for (i = 0; i < SECTORS_COUNT / 2; i++)
     {
@@ -139,6 +157,87 @@ static bool32 SetDamagedSectorBits(u8 op, u8 sectorId)
     return retVal;
 }
 
+static void RecordSlotSector(u8 slot, u16 sectorId, u16 position, void *data, u16 size, u16 checksum)
+{
+    if (sectorId >= NUM_SECTORS_PER_SLOT)
+        return;
+
+    sSlotSectors[slot][sectorId].hash = CalculateSectorHash(data, size);
+    sSlotSectors[slot][sectorId].checksum = checksum;
+    sSlotSectors[slot][sectorId].position = position;
+    sSlotSectorsKnown[slot] |= 1 << sectorId;
+}
+
+static void ForgetSlotSector(u8 slot, u16 sectorId)
+{
+    sSlotSectorsKnown[slot] &= ~(1 << sectorId);
+}
+
+// Whether the sector with the given id in the given slot already holds data.
+// Besides comparing hashes, the sector's footer is read back so anything that
+// touched flash behind our back (e.g. the save failed screen) is caught.
+static bool32 IsSlotSectorUpToDate(u8 slot, u16 sectorId, const struct SaveSectorLocation *location)
+{
+    const struct SlotSectorInfo *info = &sSlotSectors[slot][sectorId];
+    u16 footer[4]; // id, checksum, signature
+
+    if (!(sSlotSectorsKnown[slot] & (1 << sectorId))
+     || info->hash != CalculateSectorHash(location->data, location->size))
+        return FALSE;
+
+    ReadFlash(NUM_SECTORS_PER_SLOT * slot + info->position, offsetof(struct SaveSector, id), (u8 *)footer, sizeof(footer));
+
+    return footer[0] == sectorId
+        && footer[1] == info->checksum
+        && (footer[2] | (footer[3] << 16)) == SECTOR_SIGNATURE;
+}
+
+// Returns the bit for each sector rotation (position minus id) that the
+// sectors of a slot were written with. Usually all of a slot's sectors share
+// one, but an interrupted full write can leave two.
+static u16 GetSlotSectorRotations(u8 slot)
+{
+    u16 rotations = 0;
+    u16 footer[4]; // id, checksum, signature
+    u16 i;
+
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        if (sSlotSectorsKnown[slot] & (1 << i))
+            rotations |= 1 << ((sSlotSectors[slot][i].position + NUM_SECTORS_PER_SLOT - i) % NUM_SECTORS_PER_SLOT);
+    }
+    if (rotations != 0)
+        return rotations;
+
+    // Nothing is known about the slot, so look at what is on flash.
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        ReadFlash(NUM_SECTORS_PER_SLOT * slot + i, offsetof(struct SaveSector, id), (u8 *)footer, sizeof(footer));
+        if (footer[0] < NUM_SECTORS_PER_SLOT && (footer[2] | (footer[3] << 16)) == SECTOR_SIGNATURE)
+            rotations |= 1 << ((i + NUM_SECTORS_PER_SLOT - footer[0]) % NUM_SECTORS_PER_SLOT);
+    }
+    return rotations;
+}
+
+// Returns the sector rotation for the next full write of the other slot.
+// It has to differ from every rotation that slot already has: an interrupted
+// write is only detectable if it leaves some sector id missing, and since
+// WriteChangedSectors keeps slots in place, alternating slots alone doesn't
+// guarantee that anymore. The rotation is worked out from every sector of
+// the slot rather than just its SaveBlock2 sector, which an interrupted
+// incremental save can leave unknown.
+static u16 GetNextSectorRotation(void)
+{
+    u16 rotations = GetSlotSectorRotations((gSaveCounter + 1) % NUM_SAVE_SLOTS);
+    u16 next = (gLastWrittenSector + 1) % NUM_SECTORS_PER_SLOT;
+    u16 i;
+
+    for (i = 0; i < NUM_SECTORS_PER_SLOT && (rotations & (1 << next)); i++)
+        next = (next + 1) % NUM_SECTORS_PER_SLOT;
+
+    return next;
+}
+
 static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *locations)
 {
     u32 status;
@@ -157,13 +256,14 @@ static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *l
         // No sector was specified, write full save slot.
         gLastKnownGoodSector = gLastWrittenSector; // backup the current written sector before attempting to write.
         gLastSaveCounter = gSaveCounter;
-        gLastWrittenSector++;
-        gLastWrittenSector = gLastWrittenSector % NUM_SECTORS_PER_SLOT;
+        gLastWrittenSector = GetNextSectorRotation();
         gSaveCounter++;
         status = SAVE_STATUS_OK;
 
-        for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+        // SaveBlock2 goes last, see GetSaveValidStatus
+        for (i = SECTOR_ID_SAVEBLOCK2 + 1; i < NUM_SECTORS_PER_SLOT; i++)
             HandleWriteSector(i, locations);
+        HandleWriteSector(SECTOR_ID_SAVEBLOCK2, locations);
 
         if (gDamagedSaveSectors)
         {
@@ -177,12 +277,91 @@ static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *l
     return status;
 }
 
+// Like WriteSaveSectorOrSlot(FULL_SAVE_SLOT), but only writes the sectors whose
+// data differs from what the target slot already holds. Unchanged sectors stay
+// where they are, so the slot keeps its current sector rotation. SaveBlock2,
+// which has the play time, is always written and always written last. The
+// slot's counter is taken from that sector, so an interrupted save leaves the
+// other slot as the newest one.
+static u8 WriteChangedSectors(const struct SaveSectorLocation *locations)
+{
+    u32 status;
+    u32 startFrame = gMain.vblankCounter1;
+    u8 slot = (gSaveCounter + 1) % NUM_SAVE_SLOTS;
+    u16 offset = sSlotSectors[slot][SECTOR_ID_SAVEBLOCK2].position;
+    u8 numWritten = 0;
+    u16 i;
+
+    if (gDamagedSaveSectors || sSlotSectorsKnown[slot] != (1 << NUM_SECTORS_PER_SLOT) - 1)
+        numWritten = NUM_SECTORS_PER_SLOT;
+
+    // HandleWriteSector places sectors by rotation from SaveBlock2's position
+    for (i = 0; i < NUM_SECTORS_PER_SLOT && numWritten == 0; i++)
+    {
+        if (sSlotSectors[slot][i].position != (i + offset) % NUM_SECTORS_PER_SLOT)
+            numWritten = NUM_SECTORS_PER_SLOT;
+    }
+
+    if (numWritten != 0)
+    {
+        status = WriteSaveSectorOrSlot(FULL_SAVE_SLOT, locations);
+    }
+    else
+    {
+        gReadWriteSector = &gSaveDataBuffer;
+        gLastKnownGoodSector = gLastWrittenSector;
+        gLastSaveCounter = gSaveCounter;
+        gLastWrittenSector = offset;
+        gSaveCounter++;
+        status = SAVE_STATUS_OK;
+
+        for (i = SECTOR_ID_SAVEBLOCK2 + 1; i < NUM_SECTORS_PER_SLOT; i++)
+        {
+            if (!IsSlotSectorUpToDate(slot, i, &locations[i]))
+            {
+                HandleWriteSector(i, locations);
+                numWritten++;
+            }
+        }
+
+        // Don't commit the slot if a sector failed
+        if (!gDamagedSaveSectors)
+        {
+            HandleWriteSector(SECTOR_ID_SAVEBLOCK2, locations);
+            numWritten++;
+        }
+
+        if (gDamagedSaveSectors)
+        {
+            status = SAVE_STATUS_ERROR;
+            gLastWrittenSector = gLastKnownGoodSector;
+            gSaveCounter = gLastSaveCounter;
+        }
+    }
+
+    gSaveWriteStats.lastFrames = gMain.vblankCounter1 - startFrame;
+    gSaveWriteStats.lastSectorsWritten = numWritten;
+    gSaveWriteStats.lastSectorsSkipped = NUM_SECTORS_PER_SLOT - numWritten;
+    gSaveWriteStats.totalSectorsWritten += numWritten;
+    gSaveWriteStats.totalSectorsSkipped += NUM_SECTORS_PER_SLOT - numWritten;
+    gSaveWriteStats.numSaves++;
+
+#ifndef NDEBUG
+    MgbaPrintf(MGBA_LOG_DEBUG, "Save: wrote %d sectors, skipped %d, %d frames (total written %d, skipped %d)",
+        gSaveWriteStats.lastSectorsWritten, gSaveWriteStats.lastSectorsSkipped, gSaveWriteStats.lastFrames,
+        gSaveWriteStats.totalSectorsWritten, gSaveWriteStats.totalSectorsSkipped);
+#endif
+
+    return status;
+}
+
 static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locations)
 {
     u16 i;
     u16 sector;
     u8 *data;
     u16 size;
+    u8 status;
 
     // Adjust sector id for current save slot
     sector = sectorId + gLastWrittenSector;
@@ -208,7 +387,13 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locat
 
     gReadWriteSector->checksum = CalculateChecksum(data, size);
 
-    return TryWriteSector(sector, gReadWriteSector->data);
+    status = TryWriteSector(sector, gReadWriteSector->data);
+    if (status == SAVE_STATUS_OK)
+        RecordSlotSector(gSaveCounter % NUM_SAVE_SLOTS, sectorId, sector % NUM_SECTORS_PER_SLOT, data, size, gReadWriteSector->checksum);
+    else
+        ForgetSlotSector(gSaveCounter % NUM_SAVE_SLOTS, sectorId);
+
+    return status;
 }
 
 static u8 HandleWriteSectorNBytes(u8 sectorId, u8 *data, u16 size)
@@ -251,8 +436,7 @@ static u32 RestoreSaveBackupVarsAndIncrement(const struct SaveSectorLocation *lo
     gReadWriteSector = &gSaveDataBuffer;
     gLastKnownGoodSector = gLastWrittenSector;
     gLastSaveCounter = gSaveCounter;
-    gLastWrittenSector++;
-    gLastWrittenSector %= NUM_SECTORS_PER_SLOT;
+    gLastWrittenSector = GetNextSectorRotation();
     gSaveCounter++;
     gIncrementalSectorId = 0;
     gDamagedSaveSectors = 0;
@@ -361,6 +545,7 @@ static u8 HandleReplaceSector(u16 sectorId, const struct SaveSectorLocation *loc
     {
         // Writing save data failed
         SetDamagedSectorBits(ENABLE, sector);
+        ForgetSlotSector(gSaveCounter % NUM_SAVE_SLOTS, sectorId);
         return SAVE_STATUS_ERROR;
     }
     else
@@ -383,12 +568,14 @@ static u8 HandleReplaceSector(u16 sectorId, const struct SaveSectorLocation *loc
         {
             // Writing signature/counter failed
             SetDamagedSectorBits(ENABLE, sector);
+            ForgetSlotSector(gSaveCounter % NUM_SAVE_SLOTS, sectorId);
             return SAVE_STATUS_ERROR;
         }
         else
         {
             // Succeeded
             SetDamagedSectorBits(DISABLE, sector);
+            RecordSlotSector(gSaveCounter % NUM_SAVE_SLOTS, sectorId, sector % NUM_SECTORS_PER_SLOT, data, size, gReadWriteSector->checksum);
             return SAVE_STATUS_OK;
         }
     }
@@ -526,6 +713,9 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
     u8 saveSlot1Status;
     u8 saveSlot2Status;
 
+    sSlotSectorsKnown[0] = 0;
+    sSlotSectorsKnown[1] = 0;
+
     // Check save slot 1
     for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
     {
@@ -536,8 +726,11 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
             checksum = CalculateChecksum(gReadWriteSector->data, locations[gReadWriteSector->id].size);
             if (gReadWriteSector->checksum == checksum)
             {
-                saveSlot1Counter = gReadWriteSector->counter;
+                // SaveBlock2 is written last, so its counter is the slot's
+                if (gReadWriteSector->id == SECTOR_ID_SAVEBLOCK2)
+                    saveSlot1Counter = gReadWriteSector->counter;
                 validSectorFlags |= 1 << gReadWriteSector->id;
+                RecordSlotSector(0, gReadWriteSector->id, i, gReadWriteSector->data, locations[gReadWriteSector->id].size, checksum);
             }
         }
     }
@@ -568,8 +761,11 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
             checksum = CalculateChecksum(gReadWriteSector->data, locations[gReadWriteSector->id].size);
             if (gReadWriteSector->checksum == checksum)
             {
-                saveSlot2Counter = gReadWriteSector->counter;
+                // SaveBlock2 is written last, so its counter is the slot's
+                if (gReadWriteSector->id == SECTOR_ID_SAVEBLOCK2)
+                    saveSlot2Counter = gReadWriteSector->counter;
                 validSectorFlags |= 1 << gReadWriteSector->id;
+                RecordSlotSector(1, gReadWriteSector->id, i, gReadWriteSector->data, locations[gReadWriteSector->id].size, checksum);
             }
         }
     }
@@ -689,6 +885,24 @@ static u16 CalculateChecksum(void *data, u16 size)
     return ((checksum >> 16) + checksum);
 }
 
+// Unlike CalculateChecksum this depends on the order of the data (so e.g.
+// swapping two Pokémon changes it) and covers every byte.
+static u32 CalculateSectorHash(const void *data, u16 size)
+{
+    u16 i;
+    u32 hash = 2166136261;
+    const u32 *words = data;
+    const u8 *bytes = data;
+
+    for (i = 0; i < size / 4; i++)
+        hash = (hash ^ words[i]) * 16777619;
+
+    for (i = size & ~3; i < size; i++)
+        hash = (hash ^ bytes[i]) * 16777619;
+
+    return hash;
+}
+
 static void UpdateSaveAddresses(void)
 {
     int i = SECTOR_ID_SAVEBLOCK2;
@@ -740,7 +954,7 @@ u8 HandleSavingData(u8 saveType)
     case SAVE_NORMAL:
     default:
         CopyPartyAndObjectsToSave();
-        WriteSaveSectorOrSlot(FULL_SAVE_SLOT, gRamSaveSectorLocations);
+        WriteChangedSectors(gRamSaveSectorLocations);
         break;
     case SAVE_LINK:
     case SAVE_EREADER: // Dummied, now duplicate of SAVE_LINK
@@ -994,6 +1208,7 @@ u8 LoadGameSave(u8 saveType)
         StringCopy(gSaveBlock2Ptr->rivalName, gSilverPresetNames[0]);
         gSaveBlock1Ptr->versionId = 7;
     }
+    InvalidateBoxMonSummaries();
     return status;
 }
 
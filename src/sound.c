@@ -796,3 +796,14 @@ bool8 IsSpecialSEPlaying(void)
         return FALSE;
     return TRUE;
 }
+
+void DebugPrintSoundMixerStats(void)
+{
+#ifndef NDEBUG
+    DebugPrintf("m4a: last frame cycles=%d channels=%d voice limit=%d cycles per voice=%d",
+                gSoundMixerStats.cycles, gSoundMixerStats.activeChans, gSoundMixerStats.voiceLimit,
+                gSoundMixerStats.cyclesPerVoice);
+    DebugPrintf("m4a: peak cycles=%d peak channels=%d steals=%d",
+                gSoundMixerStats.peakCycles, gSoundMixerStats.peakActiveChans, gSoundMixerStats.steals);
+#endif
+}
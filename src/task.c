@@ -1,5 +1,6 @@
 #include "global.h"
 #include "task.h"
+#include "profiler.h"
 
 struct Task gTasks[NUM_TASKS];
 
@@ -111,6 +112,7 @@ void RunTasks(void)
 {
     u8 taskId = FindFirstActiveTask();
 
+    ProfilerBeginZone(PROFILE_ZONE_RUN_TASKS);
     if (taskId != NUM_TASKS)
     {
         do
@@ -119,6 +121,7 @@ void RunTasks(void)
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
+    ProfilerEndZone(PROFILE_ZONE_RUN_TASKS);
 }
 
 static u8 FindFirstActiveTask(void)
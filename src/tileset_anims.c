@@ -6,14 +6,24 @@
 #include "task.h"
 #include "battle_transition.h"
 #include "fieldmap.h"
+#include "field_camera.h"
 
-static EWRAM_DATA struct {
+#define MAX_DEFERRED_TILESET_ANIMS 8
+
+struct TilesetAnimTransfer
+{
     const u16 *src;
     u16 *dest;
     u16 size;
-} sTilesetDMA3TransferBuffer[20] = {0};
+};
+
+static EWRAM_DATA struct TilesetAnimTransfer sTilesetDMA3TransferBuffer[20] = {0};
+// Newest frame of each animation whose tiles weren't on the drawn part of
+// the map when it was due, oldest first. Sent once they are.
+static EWRAM_DATA struct TilesetAnimTransfer sDeferredTilesetAnims[MAX_DEFERRED_TILESET_ANIMS] = {0};
 
 static u8 sTilesetDMA3TransferBufferSize;
+static u8 sDeferredTilesetAnimCount;
 static u16 sPrimaryTilesetAnimCounter;
 static u16 sPrimaryTilesetAnimCounterMax;
 static u16 sSecondaryTilesetAnimCounter;
@@ -759,8 +769,68 @@ static void ResetTilesetAnimBuffer(void)
     CpuFill32(0, sTilesetDMA3TransferBuffer, sizeof sTilesetDMA3TransferBuffer);
 }
 
+static bool32 IsTilesetAnimInView(u16 *dest, u16 size)
+{
+    u32 firstTile;
+
+    if ((u32)dest < BG_VRAM)
+        return TRUE;
+    firstTile = ((u32)dest - BG_VRAM) / TILE_SIZE_4BPP;
+    if (firstTile >= NUM_TILES_TOTAL)
+        return TRUE;
+    return IsTileRangeInFieldView(firstTile, (size + TILE_SIZE_4BPP - 1) / TILE_SIZE_4BPP);
+}
+
+static void RemoveDeferredTilesetAnim(u32 index)
+{
+    sDeferredTilesetAnimCount--;
+    for (; index < sDeferredTilesetAnimCount; index++)
+        sDeferredTilesetAnims[index] = sDeferredTilesetAnims[index + 1];
+}
+
+// Only the newest frame for a destination is kept, so a later frame
+// supersedes one that was never sent.
+static void RemoveDeferredTilesetAnimsTo(u16 *dest, u16 size)
+{
+    u32 i = 0;
+
+    while (i < sDeferredTilesetAnimCount)
+    {
+        if (sDeferredTilesetAnims[i].dest == dest && sDeferredTilesetAnims[i].size == size)
+            RemoveDeferredTilesetAnim(i);
+        else
+            i++;
+    }
+}
+
+static void ClearDeferredTilesetAnims(u16 *firstDest)
+{
+    u32 i = 0;
+
+    while (i < sDeferredTilesetAnimCount)
+    {
+        if (sDeferredTilesetAnims[i].dest >= firstDest)
+            RemoveDeferredTilesetAnim(i);
+        else
+            i++;
+    }
+}
+
 static void AppendTilesetAnimToBuffer(const u16 *src, u16 *dest, u16 size)
 {
+    RemoveDeferredTilesetAnimsTo(dest, size);
+
+    // Tiles that aren't drawn anywhere can't show the frame, so it waits
+    // until they are instead of taking vblank time now.
+    if (!IsTilesetAnimInView(dest, size) && sDeferredTilesetAnimCount < MAX_DEFERRED_TILESET_ANIMS)
+    {
+        sDeferredTilesetAnims[sDeferredTilesetAnimCount].src = src;
+        sDeferredTilesetAnims[sDeferredTilesetAnimCount].dest = dest;
+        sDeferredTilesetAnims[sDeferredTilesetAnimCount].size = size;
+        sDeferredTilesetAnimCount++;
+        return;
+    }
+
     if (sTilesetDMA3TransferBufferSize < 20)
     {
         sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].src = src;
@@ -780,21 +850,45 @@ void TransferTilesetAnimsBuffer(void)
     sTilesetDMA3TransferBufferSize = 0;
 }
 
+static void QueueDeferredTilesetAnimsInView(void)
+{
+    u32 i = 0;
+
+    while (i < sDeferredTilesetAnimCount && sTilesetDMA3TransferBufferSize < 20)
+    {
+        struct TilesetAnimTransfer *anim = &sDeferredTilesetAnims[i];
+
+        if (IsTilesetAnimInView(anim->dest, anim->size))
+        {
+            sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize++] = *anim;
+            RemoveDeferredTilesetAnim(i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
 void InitTilesetAnimations(void)
 {
     ResetTilesetAnimBuffer();
+    sDeferredTilesetAnimCount = 0;
     _InitPrimaryTilesetAnimation();
     _InitSecondaryTilesetAnimation();
 }
 
 void InitSecondaryTilesetAnimation(void)
 {
+    // Frames of the old secondary tileset must not land on the new one.
+    ClearDeferredTilesetAnims((u16 *)(BG_VRAM + TILE_OFFSET_4BPP(NUM_TILES_IN_PRIMARY)));
     _InitSecondaryTilesetAnimation();
 }
 
 void UpdateTilesetAnimations(void)
 {
     ResetTilesetAnimBuffer();
+    QueueDeferredTilesetAnimsInView();
     if (++sPrimaryTilesetAnimCounter >= sPrimaryTilesetAnimCounterMax)
         sPrimaryTilesetAnimCounter = 0;
     if (++sSecondaryTilesetAnimCounter >= sSecondaryTilesetAnimCounterMax)
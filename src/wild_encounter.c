@@ -347,33 +347,30 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon)
 static u16 GetCurrentMapWildMonHeaderId(void)
 {
     u16 i;
+    u8 mapGroup = gSaveBlock1Ptr->location.mapGroup;
+    u8 mapNum = gSaveBlock1Ptr->location.mapNum;
 
-    for (i = 0; ; i++)
-    {
-        const struct WildPokemonHeader *wildHeader = &gWildMonHeaders[i];
-        if (wildHeader->mapGroup == MAP_GROUP(UNDEFINED))
-            break;
+    if (mapGroup >= MAP_GROUPS_COUNT || mapNum >= MAP_GROUP_MAX_MAPS)
+        return HEADER_NONE;
 
-        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
-            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
-        {
-            if (VarGet(VAR_TIME_BASED_ENCOUNTER) >= 1 && VarGet(VAR_TIME_BASED_ENCOUNTER) <= 4)
-                i += (VarGet(VAR_TIME_BASED_ENCOUNTER) - 1);
-            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
-                gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
-            {
-                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-                if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
-                    alteringCaveId = 0;
+    // gWildMonHeadersByMap is generated alongside gWildMonHeaders and holds index + 1
+    i = gWildMonHeadersByMap[mapGroup][mapNum];
+    if (i == 0)
+        return HEADER_NONE;
+    i--;
 
-                i += alteringCaveId;
-            }
+    if (VarGet(VAR_TIME_BASED_ENCOUNTER) >= 1 && VarGet(VAR_TIME_BASED_ENCOUNTER) <= 4)
+        i += (VarGet(VAR_TIME_BASED_ENCOUNTER) - 1);
+    if (mapGroup == MAP_GROUP(ALTERING_CAVE) && mapNum == MAP_NUM(ALTERING_CAVE))
+    {
+        u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+        if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
+            alteringCaveId = 0;
 
-            return i;
-        }
+        i += alteringCaveId;
     }
 
-    return HEADER_NONE;
+    return i;
 }
 
 static u8 PickWildMonNature(void)
@@ -0,0 +1,34 @@
+# Adapts preprocessed script data for the host assembler: strips ARM `@`
+# comments and widens the entries of the script tables, which are read as
+# arrays of C pointers. Pointers inside the scripts stay 32-bit and are
+# read back as such.
+
+function strip(line,    i, c, inquote, out)
+{
+    inquote = 0
+    out = ""
+    for (i = 1; i <= length(line); i++)
+    {
+        c = substr(line, i, 1)
+        if (c == "\"")
+            inquote = !inquote
+        else if (c == "@" && !inquote)
+            break
+        out = out c
+    }
+    return out
+}
+
+{
+    line = strip($0)
+    if (line ~ /^g[A-Za-z_]*:/)
+        intable = 1
+    else if (intable && line ~ /^[ \t]*\.4byte/)
+        sub(/\.4byte/, ".8byte", line)
+    else if (line !~ /^[ \t]*$/)
+        intable = 0
+    print line
+}
+
+# The data needs no executable stack.
+END { print "\t.section .note.GNU-stack,\"\",@progbits" }
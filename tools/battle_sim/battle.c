@@ -0,0 +1,163 @@
+// Runs one battle from a spec through the game's own battle flow, from
+// CB2_InitBattle until the engine hands control back to the overworld.
+
+#include "global.h"
+#include "battle.h"
+#include "battle_main.h"
+#include "battle_setup.h"
+#include "debug.h"
+#include "event_data.h"
+#include "main.h"
+#include "malloc.h"
+#include "pokemon.h"
+#include "random.h"
+#include "constants/battle.h"
+#include "constants/flags.h"
+#include "constants/moves.h"
+#include "sim.h"
+
+static struct SaveBlock1 sSaveBlock1;
+static struct SaveBlock2 sSaveBlock2;
+
+const struct SimSpec *gSimSpec;
+struct SimStats gSimStats;
+struct SimBattleState gSimBattle;
+
+s32 __real_CalculateBaseDamage(struct BattlePokemon *attacker, struct BattlePokemon *defender, u32 move, u16 sideStatus, u16 powerOverride, u8 typeOverride, u8 bankAtk, u8 bankDef);
+
+// Linked in with --wrap, so every caller in the engine and the AI is timed.
+s32 __wrap_CalculateBaseDamage(struct BattlePokemon *attacker, struct BattlePokemon *defender, u32 move, u16 sideStatus, u16 powerOverride, u8 typeOverride, u8 bankAtk, u8 bankDef)
+{
+    u64 start = SimTimeNow();
+    s32 damage = __real_CalculateBaseDamage(attacker, defender, move, sideStatus, powerOverride, typeOverride, bankAtk, bankDef);
+
+    gSimStats.damageTime += SimTimeNow() - start;
+    gSimStats.damageCalls++;
+    return damage;
+}
+
+static void CB2_SimBattleOver(void)
+{
+}
+
+static void CreateSimMon(struct Pokemon *mon, const struct SimMon *simMon)
+{
+    u32 value;
+    s32 i;
+
+    if (simMon->nature < NUM_NATURES)
+        CreateMonWithNature(mon, simMon->species, simMon->level, 0, simMon->nature);
+    else
+        CreateMon(mon, simMon->species, simMon->level, 0, FALSE, 0, OT_ID_PLAYER_ID, 0);
+
+    for (i = 0; i < NUM_STATS; i++)
+    {
+        value = simMon->ivs[i];
+        SetMonData(mon, MON_DATA_HP_IV + i, &value);
+        value = simMon->evs[i];
+        SetMonData(mon, MON_DATA_HP_EV + i, &value);
+    }
+    value = simMon->abilityNum;
+    SetMonData(mon, MON_DATA_ABILITY_NUM, &value);
+    value = simMon->item;
+    SetMonData(mon, MON_DATA_HELD_ITEM, &value);
+    if (simMon->moves[0] != MOVE_NONE)
+    {
+        for (i = 0; i < MAX_MON_MOVES; i++)
+            SetMonMoveSlot(mon, simMon->moves[i], i);
+    }
+    CalculateMonStats(mon);
+}
+
+// Everything a battle reads that the game would normally have set up in
+// the overworld beforehand.
+static void SetUpSimBattle(u32 seed)
+{
+    const struct SimSpec *spec = gSimSpec;
+    s32 i, side;
+
+    HostRestoreState();
+    gSaveBlock1Ptr = &sSaveBlock1;
+    gSaveBlock2Ptr = &sSaveBlock2;
+    gSaveBlock2Ptr->optionsBattleSceneOff = TRUE;
+    gSaveBlock2Ptr->optionsBattleStyle = OPTIONS_BATTLE_STYLE_SET;
+    gSaveBlock2Ptr->optionsFastBattle = 0; // no message or pause delays
+    for (i = 0; i < spec->optionCount; i++)
+        ApplySimOption(&spec->options[i]);
+    for (i = 0; i < spec->badges; i++)
+        FlagSet(FLAG_BADGE01_GET + i);
+
+    InitHeap(gHeap, HEAP_SIZE);
+
+    // Parties are rolled from the battle's seed too, so a seed reproduces
+    // personalities and natures as well as the battle itself.
+    gRngValue = seed;
+    gRng2Value = seed ^ 0x5A5A5A5A;
+
+    ZeroPlayerPartyMons();
+    ZeroEnemyPartyMons();
+    for (side = 0; side < 2; side++)
+    {
+        struct Pokemon *party = (side == B_SIDE_PLAYER) ? gPlayerParty : gEnemyParty;
+
+        for (i = 0; i < spec->sides[side].partySize; i++)
+            CreateSimMon(&party[i], &spec->sides[side].party[i]);
+    }
+    CalculatePlayerPartyCount();
+    CalculateEnemyPartyCount();
+
+    // The debug battle path takes the parties as they are instead of
+    // building the opponent's from the trainer data.
+    gIsDebugBattle = TRUE;
+    gBattleTypeFlags = BATTLE_TYPE_TRAINER;
+    if (spec->isDouble)
+        gBattleTypeFlags |= BATTLE_TYPE_DOUBLE;
+    gTrainerBattleOpponent_A = spec->trainerId;
+    gBattleTerrain = spec->terrain;
+    gMain.savedCallback = CB2_SimBattleOver;
+}
+
+static u8 CountLivingMons(struct Pokemon *party)
+{
+    u8 count = 0;
+    s32 i;
+
+    for (i = 0; i < PARTY_SIZE; i++)
+    {
+        if (GetMonData(party, MON_DATA_SPECIES) != SPECIES_NONE && GetMonData(party, MON_DATA_HP) != 0)
+            count++;
+        party++;
+    }
+    return count;
+}
+
+void RunSimBattle(u32 seed, struct SimResult *result)
+{
+    u64 start = SimTimeNow();
+    u32 frames = 0;
+
+    SetUpSimBattle(seed);
+    CB2_InitBattle();
+    while (gMain.callback2 != CB2_SimBattleOver && frames < gSimSpec->maxFrames)
+    {
+        // The few prompts the engine shows the player itself, like learning a
+        // move over a full moveset, are answered "no" by pressing B.
+        gMain.newKeys = B_BUTTON;
+        if (gMain.callback1 != NULL)
+            gMain.callback1();
+        gMain.callback2();
+        frames++;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->seed = seed;
+    result->outcome = (frames < gSimSpec->maxFrames) ? gBattleOutcome : 0;
+    result->turns = gBattleResults.battleTurnCounter;
+    result->monsLeft[B_SIDE_PLAYER] = CountLivingMons(gPlayerParty);
+    result->monsLeft[B_SIDE_OPPONENT] = CountLivingMons(gEnemyParty);
+    result->frames = frames;
+    result->levelUps = gSimBattle.levelUps;
+    result->rngState = gRngValue;
+    result->time = SimTimeNow() - start;
+    result->stats = gSimStats;
+}
@@ -0,0 +1,465 @@
+// Headless battle controller. Every battler, on both sides, is driven by
+// this one controller: decisions go through the game's own trainer AI and
+// every presentation command (animations, text, health bars, sounds)
+// completes on the spot.
+
+#include "global.h"
+#include "battle.h"
+#include "battle_ai_script_commands.h"
+#include "battle_ai_switch_items.h"
+#include "battle_anim.h"
+#include "battle_controllers.h"
+#include "data.h"
+#include "debug.h"
+#include "pokemon.h"
+#include "string_util.h"
+#include "tx_randomizer_and_challenges.h"
+#include "util.h"
+#include "constants/battle_ai.h"
+#include "constants/moves.h"
+#include "sim.h"
+
+static void SimBufferRunCommand(void);
+static void SimBufferExecCompleted(void);
+static void SimHandleGetMonData(void);
+static void SimHandleGetRawMonData(void);
+static void SimHandleSetMonData(void);
+static void SimHandleSetRawMonData(void);
+static void SimHandleSwitchInAnim(void);
+static void SimHandleChooseAction(void);
+static void SimHandleChooseMove(void);
+static void SimHandleChooseItem(void);
+static void SimHandleChoosePokemon(void);
+static void SimHandleExpUpdate(void);
+static void SimCmdEnd(void);
+
+static void (*const sSimBufferCommands[CONTROLLER_CMDS_COUNT])(void) =
+{
+    [CONTROLLER_GETMONDATA]       = SimHandleGetMonData,
+    [CONTROLLER_GETRAWMONDATA]    = SimHandleGetRawMonData,
+    [CONTROLLER_SETMONDATA]       = SimHandleSetMonData,
+    [CONTROLLER_SETRAWMONDATA]    = SimHandleSetRawMonData,
+    [CONTROLLER_SWITCHINANIM]     = SimHandleSwitchInAnim,
+    [CONTROLLER_CHOOSEACTION]     = SimHandleChooseAction,
+    [CONTROLLER_CHOOSEMOVE]       = SimHandleChooseMove,
+    [CONTROLLER_OPENBAG]          = SimHandleChooseItem,
+    [CONTROLLER_CHOOSEPOKEMON]    = SimHandleChoosePokemon,
+    [CONTROLLER_EXPUPDATE]        = SimHandleExpUpdate,
+    [CONTROLLER_TERMINATOR_NOP]   = SimCmdEnd,
+};
+
+void SetControllerToPlayer(void)
+{
+    gBattlerControllerFuncs[gActiveBattler] = SimBufferRunCommand;
+}
+
+void SetControllerToOpponent(void)
+{
+    gBattlerControllerFuncs[gActiveBattler] = SimBufferRunCommand;
+}
+
+void SetControllerToPlayerPartner(void)
+{
+    gBattlerControllerFuncs[gActiveBattler] = SimBufferRunCommand;
+}
+
+void BattleControllerDummy(void)
+{
+}
+
+static void SimBufferRunCommand(void)
+{
+    if (gBattleControllerExecFlags & gBitTable[gActiveBattler])
+    {
+        u8 cmd = gBattleBufferA[gActiveBattler][0];
+
+        if (cmd < ARRAY_COUNT(sSimBufferCommands) && sSimBufferCommands[cmd] != NULL)
+            sSimBufferCommands[cmd]();
+        else
+            SimBufferExecCompleted();
+    }
+}
+
+static void SimBufferExecCompleted(void)
+{
+    gBattlerControllerFuncs[gActiveBattler] = SimBufferRunCommand;
+    gBattleControllerExecFlags &= ~gBitTable[gActiveBattler];
+}
+
+static struct Pokemon *GetActiveBattlerParty(void)
+{
+    if (GetBattlerSide(gActiveBattler) == B_SIDE_PLAYER)
+        return gPlayerParty;
+    else
+        return gEnemyParty;
+}
+
+// The engine only ever requests whole battle mons; see the calls to
+// BtlController_EmitGetMonData.
+static u32 GetSimMonData(u8 monId, u8 *dst)
+{
+    struct Pokemon *mon = &GetActiveBattlerParty()[monId];
+    struct BattlePokemon battleMon;
+    u8 nickname[POKEMON_NAME_BUFFER_SIZE];
+    s32 i;
+
+    if (gBattleBufferA[gActiveBattler][1] != REQUEST_ALL_BATTLE)
+        return 0;
+
+    memset(&battleMon, 0, sizeof(battleMon));
+    battleMon.species = GetMonData(mon, MON_DATA_SPECIES);
+    battleMon.item = GetMonData(mon, MON_DATA_HELD_ITEM);
+    for (i = 0; i < MAX_MON_MOVES; i++)
+    {
+        battleMon.moves[i] = GetMonData(mon, MON_DATA_MOVE1 + i);
+        battleMon.pp[i] = GetMonData(mon, MON_DATA_PP1 + i);
+    }
+    battleMon.ppBonuses = GetMonData(mon, MON_DATA_PP_BONUSES);
+    battleMon.friendship = GetMonData(mon, MON_DATA_FRIENDSHIP);
+    battleMon.experience = GetMonData(mon, MON_DATA_EXP);
+    battleMon.hpIV = GetMonData(mon, MON_DATA_HP_IV);
+    battleMon.attackIV = GetMonData(mon, MON_DATA_ATK_IV);
+    battleMon.defenseIV = GetMonData(mon, MON_DATA_DEF_IV);
+    battleMon.speedIV = GetMonData(mon, MON_DATA_SPEED_IV);
+    battleMon.spAttackIV = GetMonData(mon, MON_DATA_SPATK_IV);
+    battleMon.spDefenseIV = GetMonData(mon, MON_DATA_SPDEF_IV);
+    battleMon.personality = GetMonData(mon, MON_DATA_PERSONALITY);
+    battleMon.status1 = GetMonData(mon, MON_DATA_STATUS);
+    battleMon.level = GetMonData(mon, MON_DATA_LEVEL);
+    battleMon.hp = GetMonData(mon, MON_DATA_HP);
+    battleMon.maxHP = GetMonData(mon, MON_DATA_MAX_HP);
+    battleMon.attack = GetMonData(mon, MON_DATA_ATK);
+    battleMon.defense = GetMonData(mon, MON_DATA_DEF);
+    battleMon.speed = GetMonData(mon, MON_DATA_SPEED);
+    battleMon.spAttack = GetMonData(mon, MON_DATA_SPATK);
+    battleMon.spDefense = GetMonData(mon, MON_DATA_SPDEF);
+    battleMon.isEgg = GetMonData(mon, MON_DATA_IS_EGG);
+    battleMon.abilityNum = GetMonData(mon, MON_DATA_ABILITY_NUM);
+    battleMon.otId = GetMonData(mon, MON_DATA_OT_ID);
+    GetMonData(mon, MON_DATA_NICKNAME, nickname);
+    StringCopy_Nickname(battleMon.nickname, nickname);
+    GetMonData(mon, MON_DATA_OT_NAME, battleMon.otName);
+    memcpy(dst, &battleMon, sizeof(battleMon));
+    return sizeof(battleMon);
+}
+
+static void SimHandleGetMonData(void)
+{
+    u8 monData[sizeof(struct Pokemon) * 2 + 56];
+    u32 size = 0;
+    u8 monToCheck;
+    s32 i;
+
+    if (gBattleBufferA[gActiveBattler][2] == 0)
+    {
+        size += GetSimMonData(gBattlerPartyIndexes[gActiveBattler], monData);
+    }
+    else
+    {
+        monToCheck = gBattleBufferA[gActiveBattler][2];
+        for (i = 0; i < PARTY_SIZE; i++)
+        {
+            if (monToCheck & 1)
+                size += GetSimMonData(i, monData + size);
+            monToCheck >>= 1;
+        }
+    }
+    BtlController_EmitDataTransfer(BUFFER_B, size, monData);
+    SimBufferExecCompleted();
+}
+
+static void SimHandleGetRawMonData(void)
+{
+    struct BattlePokemon battleMon;
+    u8 *src = (u8 *)&GetActiveBattlerParty()[gBattlerPartyIndexes[gActiveBattler]] + gBattleBufferA[gActiveBattler][1];
+    u8 *dst = (u8 *)&battleMon + gBattleBufferA[gActiveBattler][1];
+    u8 i;
+
+    for (i = 0; i < gBattleBufferA[gActiveBattler][2]; i++)
+        dst[i] = src[i];
+
+    BtlController_EmitDataTransfer(BUFFER_B, gBattleBufferA[gActiveBattler][2], dst);
+    SimBufferExecCompleted();
+}
+
+static void SetSimMonData(u8 monId)
+{
+    struct Pokemon *mon = &GetActiveBattlerParty()[monId];
+    struct BattlePokemon *battlePokemon = (struct BattlePokemon *)&gBattleBufferA[gActiveBattler][3];
+    struct MovePpInfo *moveData = (struct MovePpInfo *)&gBattleBufferA[gActiveBattler][3];
+    u8 *data = &gBattleBufferA[gActiveBattler][3];
+    u8 request = gBattleBufferA[gActiveBattler][1];
+    s32 i;
+
+    switch (request)
+    {
+    case REQUEST_ALL_BATTLE:
+        SetMonData(mon, MON_DATA_SPECIES, &battlePokemon->species);
+        SetMonData(mon, MON_DATA_HELD_ITEM, &battlePokemon->item);
+        for (i = 0; i < MAX_MON_MOVES; i++)
+        {
+            SetMonData(mon, MON_DATA_MOVE1 + i, &battlePokemon->moves[i]);
+            SetMonData(mon, MON_DATA_PP1 + i, &battlePokemon->pp[i]);
+        }
+        SetMonData(mon, MON_DATA_PP_BONUSES, &battlePokemon->ppBonuses);
+        SetMonData(mon, MON_DATA_STATUS, &battlePokemon->status1);
+        SetMonData(mon, MON_DATA_LEVEL, &battlePokemon->level);
+        SetMonData(mon, MON_DATA_HP, &battlePokemon->hp);
+        SetMonData(mon, MON_DATA_MAX_HP, &battlePokemon->maxHP);
+        SetMonData(mon, MON_DATA_ATK, &battlePokemon->attack);
+        SetMonData(mon, MON_DATA_DEF, &battlePokemon->defense);
+        SetMonData(mon, MON_DATA_SPEED, &battlePokemon->speed);
+        SetMonData(mon, MON_DATA_SPATK, &battlePokemon->spAttack);
+        SetMonData(mon, MON_DATA_SPDEF, &battlePokemon->spDefense);
+        break;
+    case REQUEST_SPECIES_BATTLE:
+        SetMonData(mon, MON_DATA_SPECIES, data);
+        break;
+    case REQUEST_HELDITEM_BATTLE:
+        SetMonData(mon, MON_DATA_HELD_ITEM, data);
+        break;
+    case REQUEST_MOVES_PP_BATTLE:
+        for (i = 0; i < MAX_MON_MOVES; i++)
+        {
+            SetMonData(mon, MON_DATA_MOVE1 + i, &moveData->moves[i]);
+            SetMonData(mon, MON_DATA_PP1 + i, &moveData->pp[i]);
+        }
+        SetMonData(mon, MON_DATA_PP_BONUSES, &moveData->ppBonuses);
+        break;
+    case REQUEST_MOVE1_BATTLE:
+    case REQUEST_MOVE2_BATTLE:
+    case REQUEST_MOVE3_BATTLE:
+    case REQUEST_MOVE4_BATTLE:
+        SetMonData(mon, MON_DATA_MOVE1 + request - REQUEST_MOVE1_BATTLE, data);
+        break;
+    case REQUEST_PP_DATA_BATTLE:
+        for (i = 0; i < MAX_MON_MOVES; i++)
+            SetMonData(mon, MON_DATA_PP1 + i, &data[i]);
+        SetMonData(mon, MON_DATA_PP_BONUSES, &data[MAX_MON_MOVES]);
+        break;
+    case REQUEST_PPMOVE1_BATTLE:
+    case REQUEST_PPMOVE2_BATTLE:
+    case REQUEST_PPMOVE3_BATTLE:
+    case REQUEST_PPMOVE4_BATTLE:
+        SetMonData(mon, MON_DATA_PP1 + request - REQUEST_PPMOVE1_BATTLE, data);
+        break;
+    case REQUEST_STATUS_BATTLE:
+        SetMonData(mon, MON_DATA_STATUS, data);
+        break;
+    case REQUEST_HP_BATTLE:
+        SetMonData(mon, MON_DATA_HP, data);
+        break;
+    default:
+        SimLog("unhandled SETMONDATA request %d\n", request);
+        break;
+    }
+}
+
+static void SimHandleSetMonData(void)
+{
+    u8 monToCheck;
+    u8 i;
+
+    if (gBattleBufferA[gActiveBattler][2] == 0)
+    {
+        SetSimMonData(gBattlerPartyIndexes[gActiveBattler]);
+    }
+    else
+    {
+        monToCheck = gBattleBufferA[gActiveBattler][2];
+        for (i = 0; i < PARTY_SIZE; i++)
+        {
+            if (monToCheck & 1)
+                SetSimMonData(i);
+            monToCheck >>= 1;
+        }
+    }
+    SimBufferExecCompleted();
+}
+
+static void SimHandleSetRawMonData(void)
+{
+    u8 *dst = (u8 *)&GetActiveBattlerParty()[gBattlerPartyIndexes[gActiveBattler]] + gBattleBufferA[gActiveBattler][1];
+    u8 i;
+
+    for (i = 0; i < gBattleBufferA[gActiveBattler][2]; i++)
+        dst[i] = gBattleBufferA[gActiveBattler][3 + i];
+
+    SimBufferExecCompleted();
+}
+
+static void SimHandleSwitchInAnim(void)
+{
+    *(gBattleStruct->monToSwitchIntoId + gActiveBattler) = PARTY_SIZE;
+    gBattlerPartyIndexes[gActiveBattler] = gBattleBufferA[gActiveBattler][1];
+    SimBufferExecCompleted();
+}
+
+static void SimHandleChooseAction(void)
+{
+    u64 start = SimTimeNow();
+
+    AI_TrySwitchOrUseItem();
+    gSimStats.aiTime += SimTimeNow() - start;
+    SimBufferExecCompleted();
+}
+
+// Scripted sides name the move to use each turn; anything that is not
+// usable right now falls back to the AI.
+static s32 GetScriptedMoveId(const struct ChooseMoveStruct *moveInfo)
+{
+    const struct SimSide *side = &gSimSpec->sides[GetBattlerSide(gActiveBattler)];
+    u16 move;
+    s32 i;
+
+    if (gSimBattle.scriptPos[gActiveBattler] >= side->scriptLength)
+        return -1;
+
+    move = side->script[gSimBattle.scriptPos[gActiveBattler]++];
+    for (i = 0; i < MAX_MON_MOVES; i++)
+    {
+        if (moveInfo->moves[i] == move && moveInfo->currentPp[i] != 0)
+            return i;
+    }
+    return -1;
+}
+
+static u8 GetDefaultTarget(void)
+{
+    u8 target = GetBattlerAtPosition(BATTLE_OPPOSITE(GetBattlerPosition(gActiveBattler)));
+
+    if (gAbsentBattlerFlags & gBitTable[target])
+        target = GetBattlerAtPosition(BATTLE_PARTNER(BATTLE_OPPOSITE(GetBattlerPosition(gActiveBattler))));
+    return target;
+}
+
+static void SimHandleChooseMove(void)
+{
+    struct ChooseMoveStruct *moveInfo = (struct ChooseMoveStruct *)(&gBattleBufferA[gActiveBattler][4]);
+    s32 chosenMoveId;
+    u64 start;
+
+    chosenMoveId = GetScriptedMoveId(moveInfo);
+    if (chosenMoveId >= 0)
+    {
+        gBattlerTarget = GetDefaultTarget();
+    }
+    else
+    {
+        start = SimTimeNow();
+        gDebugAIFlags = gSimSpec->sides[GetBattlerSide(gActiveBattler)].aiFlags;
+        BattleAI_SetupAIData(ALL_MOVES_MASK);
+        chosenMoveId = BattleAI_ChooseMoveOrAction();
+        gSimStats.aiTime += SimTimeNow() - start;
+        gSimStats.aiCalls++;
+    }
+
+    switch (chosenMoveId)
+    {
+    case AI_CHOICE_WATCH:
+        BtlController_EmitTwoReturnValues(BUFFER_B, B_ACTION_SAFARI_WATCH_CAREFULLY, 0);
+        break;
+    case AI_CHOICE_FLEE:
+        BtlController_EmitTwoReturnValues(BUFFER_B, B_ACTION_RUN, 0);
+        break;
+    default:
+        if (gBattleMoves[moveInfo->moves[chosenMoveId]].target & (MOVE_TARGET_USER_OR_SELECTED | MOVE_TARGET_USER))
+            gBattlerTarget = gActiveBattler;
+        if (gBattleMoves[moveInfo->moves[chosenMoveId]].target & MOVE_TARGET_BOTH)
+            gBattlerTarget = GetDefaultTarget();
+        BtlController_EmitTwoReturnValues(BUFFER_B, 10, chosenMoveId | (gBattlerTarget << 8));
+        break;
+    }
+    SimBufferExecCompleted();
+}
+
+static void SimHandleChooseItem(void)
+{
+    BtlController_EmitOneReturnValue(BUFFER_B, *(gBattleStruct->chosenItem + (gActiveBattler / 2) * 2));
+    SimBufferExecCompleted();
+}
+
+static void SimHandleChoosePokemon(void)
+{
+    struct Pokemon *party = GetActiveBattlerParty();
+    s32 chosenMonId;
+
+    if (*(gBattleStruct->AI_monToSwitchIntoId + gActiveBattler) == PARTY_SIZE)
+    {
+        chosenMonId = GetMostSuitableMonToSwitchInto();
+
+        if (chosenMonId == PARTY_SIZE)
+        {
+            u8 battler1 = GetBattlerAtPosition(GetBattlerPosition(gActiveBattler) & BIT_SIDE);
+            u8 battler2 = battler1;
+
+            if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
+                battler2 = GetBattlerAtPosition(BATTLE_PARTNER(GetBattlerPosition(battler1)));
+
+            for (chosenMonId = 0; chosenMonId < PARTY_SIZE; chosenMonId++)
+            {
+                if (GetMonData(&party[chosenMonId], MON_DATA_HP) != 0
+                    && chosenMonId != gBattlerPartyIndexes[battler1]
+                    && chosenMonId != gBattlerPartyIndexes[battler2])
+                {
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        chosenMonId = *(gBattleStruct->AI_monToSwitchIntoId + gActiveBattler);
+        *(gBattleStruct->AI_monToSwitchIntoId + gActiveBattler) = PARTY_SIZE;
+    }
+
+    // The opponent controller passes NULL here, which only works because the
+    // GBA reads the BIOS at address 0. Hand back the current order instead.
+    *(gBattleStruct->monToSwitchIntoId + gActiveBattler) = chosenMonId;
+    BtlController_EmitChosenMonReturnValue(BUFFER_B, chosenMonId, gBattleStruct->battlerPartyOrders[gActiveBattler]);
+    SimBufferExecCompleted();
+}
+
+// Mirrors the player controller's experience task without the exp bar:
+// one level at a time, reporting each level up back to the engine, and
+// nothing past the party level cap.
+static void SimHandleExpUpdate(void)
+{
+    u8 monId = gBattleBufferA[gActiveBattler][1];
+    s16 gainedExp = T1_READ_16(&gBattleBufferA[gActiveBattler][2]);
+    struct Pokemon *mon = &gPlayerParty[monId];
+    u16 species;
+    u8 level;
+    u32 currExp, nextLvlExp;
+
+    if (GetBattlerSide(gActiveBattler) != B_SIDE_PLAYER
+        || GetMonData(mon, MON_DATA_LEVEL) >= GetCurrentPartyLevelCap())
+    {
+        SimBufferExecCompleted();
+        return;
+    }
+
+    species = GetMonData(mon, MON_DATA_SPECIES);
+    level = GetMonData(mon, MON_DATA_LEVEL);
+    currExp = GetMonData(mon, MON_DATA_EXP);
+    nextLvlExp = gExperienceTables[gSpeciesInfo[species].growthRate][level + 1];
+
+    if (currExp + gainedExp >= nextLvlExp)
+    {
+        SetMonData(mon, MON_DATA_EXP, &nextLvlExp);
+        CalculateMonStats(mon);
+        gainedExp -= nextLvlExp - currExp;
+        BtlController_EmitTwoReturnValues(BUFFER_B, RET_VALUE_LEVELED_UP, gainedExp);
+        gSimBattle.levelUps++;
+    }
+    else
+    {
+        currExp += gainedExp;
+        SetMonData(mon, MON_DATA_EXP, &currExp);
+    }
+    SimBufferExecCompleted();
+}
+
+static void SimCmdEnd(void)
+{
+}
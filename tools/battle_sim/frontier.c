@@ -0,0 +1,254 @@
+// --frontier-parties: fills Battle Frontier, Battle Tent and Battle Factory
+// parties with the game's own code over a range of seeds, and checks every
+// party against the facility rules: no empty slots, no repeated species, no
+// repeated held item other than ITEM_NONE, and only mons the facility and
+// level mode allow.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "global.h"
+#include "battle_factory.h"
+#include "battle_setup.h"
+#include "battle_tower.h"
+#include "event_data.h"
+#include "pokemon.h"
+#include "random.h"
+#include "constants/battle_factory.h"
+#include "constants/battle_frontier.h"
+#include "constants/battle_frontier_mons.h"
+#include "constants/battle_frontier_trainers.h"
+#include "constants/battle_tent_trainers.h"
+#include "constants/items.h"
+#include "constants/species.h"
+#include "sim.h"
+
+// Only the first few violations are printed.
+#define MAX_REPORTED_VIOLATIONS 20
+
+static struct SaveBlock1 sSaveBlock1;
+static struct SaveBlock2 sSaveBlock2;
+
+static u32 sPartiesChecked;
+static u32 sViolations;
+
+static void ReportViolation(const char *facility, u32 seed, const char *fmt, ...)
+{
+    va_list args;
+
+    if (sViolations++ >= MAX_REPORTED_VIOLATIONS)
+        return;
+
+    fprintf(stderr, "battle_sim: %s, seed %u, style %u, level mode %u: ",
+            facility, seed, sSaveBlock2.optionStyle, sSaveBlock2.frontier.lvlMode);
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+static bool32 IsHighTierMon(u16 monId)
+{
+    return sSaveBlock2.frontier.lvlMode == FRONTIER_LVL_OPEN && monId > FRONTIER_MONS_HIGH_TIER;
+}
+
+static u16 GetFacilityMonItem(u16 monId)
+{
+    return gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+}
+
+static void CheckParty(const char *facility, u32 seed, const u16 *species, const u16 *items, u32 count)
+{
+    u32 i, j;
+
+    sPartiesChecked++;
+    for (i = 0; i < count; i++)
+    {
+        if (species[i] == SPECIES_NONE)
+            ReportViolation(facility, seed, "slot %u is empty", i);
+        for (j = 0; j < i; j++)
+        {
+            if (species[i] != SPECIES_NONE && species[j] == species[i])
+                ReportViolation(facility, seed, "species %u is on the party twice", species[i]);
+            if (items[i] != ITEM_NONE && items[j] == items[i])
+                ReportViolation(facility, seed, "item %u is on the party twice", items[i]);
+        }
+    }
+}
+
+// A trainer's mon has to be a member of the set it was drawn from, with the
+// same species, item and moves, that the level mode allows.
+static bool32 IsFromMonSet(struct Pokemon *mon, const u16 *monSet, bool32 checkTier)
+{
+    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
+    u16 heldItem = GetMonData(mon, MON_DATA_HELD_ITEM, NULL);
+    u32 i, j;
+
+    for (i = 0; monSet[i] != 0xFFFF; i++)
+    {
+        const struct FacilityMon *setMon = &gFacilityTrainerMons[monSet[i]];
+
+        if (checkTier && IsHighTierMon(monSet[i]))
+            continue;
+        if (setMon->species != species || GetFacilityMonItem(monSet[i]) != heldItem)
+            continue;
+        for (j = 0; j < MAX_MON_MOVES; j++)
+        {
+            if (GetMonData(mon, MON_DATA_MOVE1 + j, NULL) != setMon->moves[j])
+                break;
+        }
+        if (j == MAX_MON_MOVES)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// Checks the listed gEnemyParty slots as one party drawn from monSet.
+static void CheckTrainerParty(const char *facility, u32 seed, const u16 *monSet, bool32 checkTier, const u8 *slots, u32 count)
+{
+    u16 species[PARTY_SIZE];
+    u16 items[PARTY_SIZE];
+    u32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        struct Pokemon *mon = &gEnemyParty[slots[i]];
+
+        species[i] = GetMonData(mon, MON_DATA_SPECIES, NULL);
+        items[i] = GetMonData(mon, MON_DATA_HELD_ITEM, NULL);
+        if (species[i] != SPECIES_NONE && !IsFromMonSet(mon, monSet, checkTier))
+            ReportViolation(facility, seed, "species %u in slot %u isn't in the trainer's set", species[i], slots[i]);
+    }
+    CheckParty(facility, seed, species, items, count);
+}
+
+static void CheckTowerParties(u32 seed)
+{
+    static const u8 sSingleSlots[] = {0, 1, 2};
+    static const u8 sMultiSlots[] = {0, 1, 3, 4};
+    u16 trainerId;
+
+    for (trainerId = 0; trainerId < FRONTIER_TRAINERS_COUNT; trainerId++)
+    {
+        gTrainerBattleOpponent_A = trainerId;
+        FillFrontierTrainerParty(FRONTIER_PARTY_SIZE);
+        CheckTrainerParty("tower", seed, gFacilityTrainers[trainerId].monSet, TRUE, sSingleSlots, ARRAY_COUNT(sSingleSlots));
+    }
+
+    // Both multi battle opponents draw from the first opponent's set, and
+    // the second can't repeat what the first one has.
+    gTrainerBattleOpponent_A = Random() % FRONTIER_TRAINERS_COUNT;
+    gTrainerBattleOpponent_B = Random() % FRONTIER_TRAINERS_COUNT;
+    FillFrontierTrainersParties(FRONTIER_MULTI_PARTY_SIZE);
+    CheckTrainerParty("tower multi", seed, gFacilityTrainers[gTrainerBattleOpponent_A].monSet, TRUE, sMultiSlots, ARRAY_COUNT(sMultiSlots));
+}
+
+static void CheckTentParties(u32 seed)
+{
+    static const u8 sTentFacilities[] = {FRONTIER_FACILITY_PALACE, FRONTIER_FACILITY_ARENA};
+    static const u8 sSlots[] = {0, 1, 2};
+    u16 trainerId;
+    u32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sTentFacilities); i++)
+    {
+        VarSet(VAR_FRONTIER_FACILITY, sTentFacilities[i]);
+        for (trainerId = 0; trainerId < NUM_BATTLE_TENT_TRAINERS; trainerId++)
+        {
+            gTrainerBattleOpponent_A = trainerId;
+            FillTentTrainerParty(FRONTIER_PARTY_SIZE);
+            CheckTrainerParty("tent", seed, gFacilityTrainers[trainerId].monSet, FALSE, sSlots, ARRAY_COUNT(sSlots));
+        }
+    }
+}
+
+static void CheckFactoryParties(u32 seed, u8 battleMode)
+{
+    u16 species[PARTY_SIZE];
+    u16 items[PARTY_SIZE];
+    u8 lvlMode = sSaveBlock2.frontier.lvlMode;
+    u32 i, j;
+
+    VarSet(VAR_FRONTIER_FACILITY, FRONTIER_FACILITY_FACTORY);
+    VarSet(VAR_FRONTIER_BATTLE_MODE, battleMode);
+    sSaveBlock2.frontier.curChallengeBattleNum = 0;
+    // Covers every challenge range and every rental rank.
+    sSaveBlock2.frontier.factoryWinStreaks[battleMode][lvlMode] = (seed % 9) * FRONTIER_STAGES_PER_CHALLENGE;
+    sSaveBlock2.frontier.factoryRentsCount[battleMode][lvlMode] = seed % 50;
+
+    gSpecialVar_0x8004 = BATTLE_FACTORY_FUNC_GENERATE_RENTAL_MONS;
+    CallBattleFactoryFunction();
+    for (i = 0; i < PARTY_SIZE; i++)
+    {
+        u16 monId = sSaveBlock2.frontier.rentalMons[i].monId;
+
+        species[i] = gFacilityTrainerMons[monId].species;
+        items[i] = GetFacilityMonItem(monId);
+        if (species[i] == SPECIES_UNOWN)
+            ReportViolation("factory rentals", seed, "Unown in slot %u", i);
+    }
+    CheckParty("factory rentals", seed, species, items, PARTY_SIZE);
+
+    gSpecialVar_0x8004 = BATTLE_FACTORY_FUNC_GENERATE_OPPONENT_MONS;
+    CallBattleFactoryFunction();
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        u16 monId = gFrontierTempParty[i];
+
+        species[i] = gFacilityTrainerMons[monId].species;
+        items[i] = GetFacilityMonItem(monId);
+        if (species[i] == SPECIES_UNOWN)
+            ReportViolation("factory opponent", seed, "Unown in slot %u", i);
+        if (IsHighTierMon(monId))
+            ReportViolation("factory opponent", seed, "high tier mon %u in slot %u", monId, i);
+        for (j = 0; j < PARTY_SIZE; j++)
+        {
+            if (species[i] == gFacilityTrainerMons[sSaveBlock2.frontier.rentalMons[j].monId].species)
+                ReportViolation("factory opponent", seed, "species %u is also a rental", species[i]);
+        }
+    }
+    CheckParty("factory opponent", seed, species, items, FRONTIER_PARTY_SIZE);
+
+    FillFactoryBrainParty();
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        species[i] = GetMonData(&gEnemyParty[i], MON_DATA_SPECIES, NULL);
+        items[i] = GetMonData(&gEnemyParty[i], MON_DATA_HELD_ITEM, NULL);
+        if (species[i] == SPECIES_UNOWN)
+            ReportViolation("factory brain", seed, "Unown in slot %u", i);
+    }
+    CheckParty("factory brain", seed, species, items, FRONTIER_PARTY_SIZE);
+}
+
+// Returns the process exit status.
+int CheckFrontierParties(u32 count, u32 seed)
+{
+    u32 i;
+    u8 style, lvlMode, battleMode;
+
+    gSaveBlock1Ptr = &sSaveBlock1;
+    gSaveBlock2Ptr = &sSaveBlock2;
+
+    for (i = 0; i < count; i++)
+    {
+        for (style = 0; style < 2; style++)
+        {
+            sSaveBlock2.optionStyle = style;
+            gRngValue = seed + i;
+
+            for (lvlMode = 0; lvlMode < FRONTIER_LVL_MODE_COUNT; lvlMode++)
+            {
+                sSaveBlock2.frontier.lvlMode = lvlMode;
+                VarSet(VAR_FRONTIER_FACILITY, FRONTIER_FACILITY_TOWER);
+                CheckTowerParties(seed + i);
+                for (battleMode = FRONTIER_MODE_SINGLES; battleMode <= FRONTIER_MODE_DOUBLES; battleMode++)
+                    CheckFactoryParties(seed + i, battleMode);
+            }
+
+            sSaveBlock2.frontier.lvlMode = FRONTIER_LVL_TENT;
+            CheckTentParties(seed + i);
+        }
+    }
+
+    printf("frontier parties  %u checked, %u violations\n", sPartiesChecked, sViolations);
+    return sViolations != 0;
+}
@@ -0,0 +1,175 @@
+// Host stand-ins for the GBA hardware: the memory-mapped regions the game
+// writes to directly, the BIOS calls, and the DMA channels.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "global.h"
+#include "sim.h"
+
+struct HostRegion
+{
+    uintptr_t address;
+    size_t size;
+};
+
+// Only the regions the engine pokes at through fixed addresses. RAM is
+// ordinary host memory.
+static const struct HostRegion sHostRegions[] =
+{
+    {REG_BASE, 0x1000},
+    {PLTT, PLTT_SIZE},
+    {VRAM, VRAM_SIZE},
+    {OAM, OAM_SIZE},
+};
+
+void HostInit(void)
+{
+    size_t i;
+
+    for (i = 0; i < ARRAY_COUNT(sHostRegions); i++)
+    {
+        void *region = mmap((void *)sHostRegions[i].address, sHostRegions[i].size,
+                            PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+        if (region != (void *)sHostRegions[i].address)
+        {
+            fprintf(stderr, "battle_sim: cannot map GBA region at 0x%08lx\n", (unsigned long)sHostRegions[i].address);
+            exit(1);
+        }
+    }
+}
+
+// Every battle starts from the program's data and bss as they were before
+// the first one, the way a battle on hardware starts from whatever RAM the
+// overworld left. Without this, leftovers from the previous battle in the
+// same worker would make results depend on how battles are split over
+// workers.
+extern u8 __data_start[], _end[];
+static u8 *sInitialState;
+
+void HostSaveState(void)
+{
+    sInitialState = malloc(_end - __data_start);
+    if (sInitialState == NULL)
+    {
+        fprintf(stderr, "battle_sim: out of memory\n");
+        exit(1);
+    }
+    memcpy(sInitialState, __data_start, _end - __data_start);
+}
+
+void HostRestoreState(void)
+{
+    u8 *initialState = sInitialState;
+
+    memcpy(__data_start, initialState, _end - __data_start);
+    sInitialState = initialState;
+}
+
+u64 SimTimeNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void SimLog(const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+static void HostTransfer(const void *src, void *dest, u32 count, u32 unitSize, bool32 fixedSrc)
+{
+    const u8 *s = src;
+    u8 *d = dest;
+    u32 i;
+
+    if (!fixedSrc)
+    {
+        memmove(d, s, count * unitSize);
+        return;
+    }
+    for (i = 0; i < count; i++)
+        memcpy(d + i * unitSize, s, unitSize);
+}
+
+void HostDmaSet(int dmaNum, const void *src, void *dest, u32 control)
+{
+    u32 count = control & 0xFFFF;
+    u32 flags = control >> 16;
+
+    if (count == 0)
+        count = (dmaNum == 3) ? 0x10000 : 0x4000;
+
+    if (!(flags & DMA_ENABLE) || (flags & (DMA_START_VBLANK | DMA_START_HBLANK | DMA_START_SPECIAL | DMA_REPEAT)))
+        return; // timed transfers only feed the display, which doesn't exist here
+
+    HostTransfer(src, dest, count, (flags & DMA_32BIT) ? 4 : 2, flags & DMA_SRC_FIXED);
+}
+
+void (CpuSet)(const void *src, void *dest, u32 control)
+{
+    HostTransfer(src, dest, control & 0x1FFFFF, (control & CPU_SET_32BIT) ? 4 : 2, control & CPU_SET_SRC_FIXED);
+}
+
+void (CpuFastSet)(const void *src, void *dest, u32 control)
+{
+    // Word count rounded up to whole 8-word blocks, as on hardware.
+    HostTransfer(src, dest, ((control & 0x1FFFFF) + 7) & ~7, 4, control & CPU_FAST_SET_SRC_FIXED);
+}
+
+void LZ77UnCompWram(const u32 *src, void *dest)
+{
+}
+
+void LZ77UnCompVram(const u32 *src, void *dest)
+{
+}
+
+void RLUnCompWram(const void *src, void *dest)
+{
+}
+
+void RLUnCompVram(const void *src, void *dest)
+{
+}
+
+s32 Div(s32 num, s32 denom)
+{
+    return num / denom;
+}
+
+s32 Mod(s32 num, s32 denom)
+{
+    return num % denom;
+}
+
+u16 Sqrt(u32 num)
+{
+    u32 root = 0;
+
+    while ((root + 1) * (root + 1) <= num)
+        root++;
+    return root;
+}
+
+void VBlankIntrWait(void)
+{
+}
+
+void SoftReset(u32 resetFlags)
+{
+    exit(1);
+}
+
+void RegisterRamReset(u32 resetFlags)
+{
+}
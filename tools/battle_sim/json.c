@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "json.h"
+
+struct JsonParser
+{
+    const char *pos;
+    const char *start;
+    char *error;
+    int errorSize;
+};
+
+static struct JsonNode *ParseValue(struct JsonParser *parser);
+
+static void SetError(struct JsonParser *parser, const char *message)
+{
+    int line = 1;
+    const char *c;
+
+    if (parser->error[0] != '\0')
+        return;
+    for (c = parser->start; c < parser->pos; c++)
+    {
+        if (*c == '\n')
+            line++;
+    }
+    snprintf(parser->error, parser->errorSize, "line %d: %s", line, message);
+}
+
+static void SkipSpace(struct JsonParser *parser)
+{
+    while (*parser->pos == ' ' || *parser->pos == '\t' || *parser->pos == '\n' || *parser->pos == '\r')
+        parser->pos++;
+}
+
+static struct JsonNode *NewNode(int type)
+{
+    struct JsonNode *node = calloc(1, sizeof(*node));
+
+    node->type = type;
+    return node;
+}
+
+static char *ParseString(struct JsonParser *parser)
+{
+    const char *end;
+    char *string, *out;
+
+    parser->pos++; // opening quote
+    for (end = parser->pos; *end != '"'; end++)
+    {
+        if (*end == '\0')
+        {
+            SetError(parser, "unterminated string");
+            return NULL;
+        }
+        if (*end == '\\' && end[1] != '\0')
+            end++;
+    }
+
+    string = out = malloc(end - parser->pos + 1);
+    while (parser->pos < end)
+    {
+        if (*parser->pos == '\\')
+        {
+            parser->pos++;
+            switch (*parser->pos)
+            {
+            case 'n':
+                *out++ = '\n';
+                break;
+            case 't':
+                *out++ = '\t';
+                break;
+            default:
+                *out++ = *parser->pos;
+                break;
+            }
+            parser->pos++;
+        }
+        else
+        {
+            *out++ = *parser->pos++;
+        }
+    }
+    *out = '\0';
+    parser->pos++; // closing quote
+    return string;
+}
+
+static struct JsonNode *ParseContainer(struct JsonParser *parser, int type, char close)
+{
+    struct JsonNode *node = NewNode(type);
+    struct JsonNode **tail = &node->children;
+
+    parser->pos++;
+    SkipSpace(parser);
+    if (*parser->pos == close)
+    {
+        parser->pos++;
+        return node;
+    }
+
+    while (1)
+    {
+        char *key = NULL;
+        struct JsonNode *child;
+
+        SkipSpace(parser);
+        if (type == JSON_OBJECT)
+        {
+            if (*parser->pos != '"')
+            {
+                SetError(parser, "expected member name");
+                break;
+            }
+            key = ParseString(parser);
+            if (key == NULL)
+                break;
+            SkipSpace(parser);
+            if (*parser->pos != ':')
+            {
+                free(key);
+                SetError(parser, "expected ':'");
+                break;
+            }
+            parser->pos++;
+        }
+
+        child = ParseValue(parser);
+        if (child == NULL)
+        {
+            free(key);
+            break;
+        }
+        child->key = key;
+        *tail = child;
+        tail = &child->next;
+
+        SkipSpace(parser);
+        if (*parser->pos == ',')
+        {
+            parser->pos++;
+            continue;
+        }
+        if (*parser->pos == close)
+        {
+            parser->pos++;
+            return node;
+        }
+        SetError(parser, type == JSON_OBJECT ? "expected ',' or '}'" : "expected ',' or ']'");
+        break;
+    }
+
+    JsonFree(node);
+    return NULL;
+}
+
+static struct JsonNode *ParseValue(struct JsonParser *parser)
+{
+    struct JsonNode *node;
+    char *end;
+
+    SkipSpace(parser);
+    switch (*parser->pos)
+    {
+    case '{':
+        return ParseContainer(parser, JSON_OBJECT, '}');
+    case '[':
+        return ParseContainer(parser, JSON_ARRAY, ']');
+    case '"':
+        node = NewNode(JSON_STRING);
+        node->string = ParseString(parser);
+        if (node->string == NULL)
+        {
+            JsonFree(node);
+            return NULL;
+        }
+        return node;
+    }
+
+    if (strncmp(parser->pos, "true", 4) == 0 || strncmp(parser->pos, "false", 5) == 0)
+    {
+        node = NewNode(JSON_BOOL);
+        node->number = (*parser->pos == 't');
+        parser->pos += node->number ? 4 : 5;
+        return node;
+    }
+    if (strncmp(parser->pos, "null", 4) == 0)
+    {
+        parser->pos += 4;
+        return NewNode(JSON_NULL);
+    }
+
+    node = NewNode(JSON_NUMBER);
+    node->number = strtod(parser->pos, &end);
+    if (end == parser->pos)
+    {
+        SetError(parser, "unexpected character");
+        JsonFree(node);
+        return NULL;
+    }
+    parser->pos = end;
+    return node;
+}
+
+struct JsonNode *JsonParse(const char *text, char *error, int errorSize)
+{
+    struct JsonParser parser;
+    struct JsonNode *root;
+
+    parser.pos = parser.start = text;
+    parser.error = error;
+    parser.errorSize = errorSize;
+    error[0] = '\0';
+
+    root = ParseValue(&parser);
+    if (root != NULL)
+    {
+        SkipSpace(&parser);
+        if (*parser.pos != '\0')
+        {
+            SetError(&parser, "trailing characters");
+            JsonFree(root);
+            root = NULL;
+        }
+    }
+    return root;
+}
+
+void JsonFree(struct JsonNode *node)
+{
+    while (node != NULL)
+    {
+        struct JsonNode *next = node->next;
+
+        JsonFree(node->children);
+        free(node->key);
+        free(node->string);
+        free(node);
+        node = next;
+    }
+}
+
+struct JsonNode *JsonGet(const struct JsonNode *object, const char *key)
+{
+    struct JsonNode *child;
+
+    if (object == NULL || object->type != JSON_OBJECT)
+        return NULL;
+    for (child = object->children; child != NULL; child = child->next)
+    {
+        if (strcmp(child->key, key) == 0)
+            return child;
+    }
+    return NULL;
+}
+
+int JsonCount(const struct JsonNode *node)
+{
+    struct JsonNode *child;
+    int count = 0;
+
+    if (node == NULL)
+        return 0;
+    for (child = node->children; child != NULL; child = child->next)
+        count++;
+    return count;
+}
@@ -0,0 +1,32 @@
+#ifndef GUARD_BATTLE_SIM_JSON_H
+#define GUARD_BATTLE_SIM_JSON_H
+
+// Just enough JSON for battle specs: the whole document is parsed into a
+// tree that stays alive until JsonFree.
+
+enum
+{
+    JSON_NULL,
+    JSON_BOOL,
+    JSON_NUMBER,
+    JSON_STRING,
+    JSON_ARRAY,
+    JSON_OBJECT,
+};
+
+struct JsonNode
+{
+    int type;
+    char *key;                 // set for members of an object
+    char *string;
+    double number;
+    struct JsonNode *children; // array elements or object members
+    struct JsonNode *next;
+};
+
+struct JsonNode *JsonParse(const char *text, char *error, int errorSize);
+void JsonFree(struct JsonNode *node);
+struct JsonNode *JsonGet(const struct JsonNode *object, const char *key);
+int JsonCount(const struct JsonNode *node);
+
+#endif // GUARD_BATTLE_SIM_JSON_H
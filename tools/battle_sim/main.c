@@ -0,0 +1,203 @@
+// battle_sim: runs AI-vs-AI battles from a JSON spec on the host, spread
+// over worker processes, and reports outcomes and engine timings.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "global.h"
+#include "sim.h"
+
+static void Usage(void)
+{
+    fprintf(stderr,
+        "usage: battle_sim [options] SPEC.json\n"
+        "       battle_sim [-n COUNT] [-s SEED] --frontier-parties\n"
+        "  -n COUNT        number of battles (default: from the spec)\n"
+        "  -s SEED         seed of the first battle; battle i uses SEED + i\n"
+        "  -j JOBS         worker processes (default: one per core)\n"
+        "  --csv           print one line per battle\n"
+        "  --list-options  list the options a spec may set\n"
+        "  --frontier-parties\n"
+        "                  check the frontier parties of COUNT seeds (default: 100)\n");
+    exit(2);
+}
+
+static void RunWorker(struct SimResult *results, u32 count, u32 seed, u32 worker, u32 jobs)
+{
+    u32 i;
+
+    for (i = worker; i < count; i += jobs)
+        RunSimBattle(seed + i, &results[i]);
+}
+
+static void PrintCsv(const struct SimResult *results, u32 count)
+{
+    u32 i;
+
+    printf("seed,outcome,turns,player_left,opponent_left,frames,level_ups,rng,time_ns,ai_calls,ai_ns,damage_calls,damage_ns\n");
+    for (i = 0; i < count; i++)
+    {
+        const struct SimResult *r = &results[i];
+
+        printf("%u,%u,%u,%u,%u,%u,%u,%08x,%llu,%u,%llu,%u,%llu\n",
+               r->seed, r->outcome, r->turns, r->monsLeft[B_SIDE_PLAYER], r->monsLeft[B_SIDE_OPPONENT],
+               r->frames, r->levelUps, r->rngState, (unsigned long long)r->time,
+               r->stats.aiCalls, (unsigned long long)r->stats.aiTime,
+               r->stats.damageCalls, (unsigned long long)r->stats.damageTime);
+    }
+}
+
+static void PrintSummary(const struct SimResult *results, u32 count, u32 jobs, u64 wallTime)
+{
+    u32 outcomes[B_OUTCOME_FORFEITED + 2] = {0};
+    u64 turns = 0, frames = 0, battleTime = 0, aiTime = 0, damageTime = 0;
+    u64 aiCalls = 0, damageCalls = 0;
+    u32 digest = 2166136261;
+    u32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        const struct SimResult *r = &results[i];
+
+        outcomes[min(r->outcome, B_OUTCOME_FORFEITED + 1)]++;
+        turns += r->turns;
+        frames += r->frames;
+        battleTime += r->time;
+        aiTime += r->stats.aiTime;
+        aiCalls += r->stats.aiCalls;
+        damageTime += r->stats.damageTime;
+        damageCalls += r->stats.damageCalls;
+
+        // Changes if any battle plays out differently.
+        digest = (digest ^ r->outcome) * 16777619;
+        digest = (digest ^ r->turns) * 16777619;
+        digest = (digest ^ r->rngState) * 16777619;
+    }
+
+    printf("battles        %u in %.2fs on %u workers (%.0f battles/s)\n",
+           count, wallTime / 1e9, jobs, count / (wallTime / 1e9));
+    printf("player won     %u (%.1f%%)\n", outcomes[B_OUTCOME_WON], 100.0 * outcomes[B_OUTCOME_WON] / count);
+    printf("player lost    %u (%.1f%%)\n", outcomes[B_OUTCOME_LOST], 100.0 * outcomes[B_OUTCOME_LOST] / count);
+    printf("drew           %u\n", outcomes[B_OUTCOME_DREW]);
+    printf("other          %u\n", count - outcomes[B_OUTCOME_WON] - outcomes[B_OUTCOME_LOST] - outcomes[B_OUTCOME_DREW] - outcomes[0]);
+    printf("timed out      %u\n", outcomes[0]);
+    printf("turns          %.2f per battle\n", (double)turns / count);
+    printf("frames         %.0f per battle\n", (double)frames / count);
+    printf("battle time    %.1f us per battle, %.2f us per turn\n",
+           battleTime / 1e3 / count, turns ? battleTime / 1e3 / turns : 0.0);
+    printf("ai             %.2f calls per turn, %.2f us per call, %.2f us per turn\n",
+           turns ? (double)aiCalls / turns : 0.0, aiCalls ? aiTime / 1e3 / aiCalls : 0.0,
+           turns ? aiTime / 1e3 / turns : 0.0);
+    printf("damage calc    %.2f calls per turn, %.0f ns per call\n",
+           turns ? (double)damageCalls / turns : 0.0, damageCalls ? (double)damageTime / damageCalls : 0.0);
+    printf("digest         %08x\n", digest);
+}
+
+int main(int argc, char **argv)
+{
+    static struct SimSpec spec;
+    struct SimResult *results;
+    const char *specPath = NULL;
+    bool8 csv = FALSE;
+    bool8 frontierParties = FALSE;
+    s32 count = -1, jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    s64 seed = -1;
+    u64 start;
+    s32 i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            count = strtol(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            seed = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            jobs = strtol(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--csv") == 0)
+            csv = TRUE;
+        else if (strcmp(argv[i], "--list-options") == 0)
+            return ListSimOptions(), 0;
+        else if (strcmp(argv[i], "--frontier-parties") == 0)
+            frontierParties = TRUE;
+        else if (argv[i][0] != '-' && specPath == NULL)
+            specPath = argv[i];
+        else
+            Usage();
+    }
+    if (frontierParties)
+    {
+        if (specPath != NULL)
+            Usage();
+        HostInit();
+        return CheckFrontierParties(count >= 0 ? count : 100, seed >= 0 ? seed : 0);
+    }
+    if (specPath == NULL)
+        Usage();
+
+    if (!LoadSimSpec(specPath, &spec))
+        return 1;
+    if (count >= 0)
+        spec.battles = count;
+    if (seed >= 0)
+        spec.seed = seed;
+    if (spec.battles == 0)
+        return 0;
+    if (jobs < 1)
+        jobs = 1;
+    if ((u32)jobs > spec.battles)
+        jobs = spec.battles;
+
+    HostInit();
+    gSimSpec = &spec;
+    HostSaveState();
+
+    // Workers fill in their share of one array shared with the parent.
+    results = mmap(NULL, sizeof(*results) * spec.battles, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (results == MAP_FAILED)
+    {
+        perror("battle_sim: mmap");
+        return 1;
+    }
+
+    start = SimTimeNow();
+    if (jobs == 1)
+    {
+        RunWorker(results, spec.battles, spec.seed, 0, 1);
+    }
+    else
+    {
+        for (i = 0; i < jobs; i++)
+        {
+            pid_t pid = fork();
+
+            if (pid < 0)
+            {
+                perror("battle_sim: fork");
+                return 1;
+            }
+            if (pid == 0)
+            {
+                RunWorker(results, spec.battles, spec.seed, i, jobs);
+                _exit(0);
+            }
+        }
+        for (i = 0; i < jobs; i++)
+        {
+            int status;
+
+            if (wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                fprintf(stderr, "battle_sim: a worker crashed\n");
+                return 1;
+            }
+        }
+    }
+
+    if (csv)
+        PrintCsv(results, spec.battles);
+    else
+        PrintSummary(results, spec.battles, jobs, SimTimeNow() - start);
+    return 0;
+}
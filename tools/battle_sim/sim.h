@@ -0,0 +1,100 @@
+#ifndef GUARD_BATTLE_SIM_H
+#define GUARD_BATTLE_SIM_H
+
+#include "constants/battle.h"
+
+#define SIM_MAX_SCRIPT 64
+#define SIM_MAX_OPTIONS 32
+
+struct SimMon
+{
+    u16 species;
+    u8 level;
+    u8 abilityNum;
+    u16 moves[MAX_MON_MOVES];
+    u16 item;
+    u8 nature;     // NUM_NATURES picks one at random
+    u8 ivs[NUM_STATS];
+    u8 evs[NUM_STATS];
+};
+
+struct SimSide
+{
+    u32 aiFlags;
+    u8 partySize;
+    u8 scriptLength;
+    struct SimMon party[PARTY_SIZE];
+    u16 script[SIM_MAX_SCRIPT];
+};
+
+struct SimOption
+{
+    u8 id;
+    u32 value;
+};
+
+struct SimSpec
+{
+    u32 seed;
+    u32 battles;
+    u32 maxFrames;
+    bool8 isDouble;
+    u8 badges;
+    u8 terrain;
+    u8 optionCount;
+    u16 trainerId;
+    struct SimOption options[SIM_MAX_OPTIONS];
+    struct SimSide sides[2]; // indexed by B_SIDE_*
+};
+
+// Per-battle counters, reset before every battle.
+struct SimStats
+{
+    u64 aiTime;
+    u64 damageTime;
+    u32 aiCalls;
+    u32 damageCalls;
+};
+
+struct SimBattleState
+{
+    u8 scriptPos[MAX_BATTLERS_COUNT];
+    u32 levelUps;
+};
+
+struct SimResult
+{
+    u32 seed;
+    u8 outcome;
+    u8 turns;
+    u8 monsLeft[2];
+    u32 frames;
+    u32 levelUps;
+    u32 rngState;
+    u64 time;
+    struct SimStats stats;
+};
+
+extern const struct SimSpec *gSimSpec;
+extern struct SimStats gSimStats;
+extern struct SimBattleState gSimBattle;
+
+// host.c
+void HostInit(void);
+void HostSaveState(void);
+void HostRestoreState(void);
+u64 SimTimeNow(void);
+void SimLog(const char *fmt, ...);
+
+// spec.c
+bool8 LoadSimSpec(const char *path, struct SimSpec *spec);
+void ApplySimOption(const struct SimOption *option);
+void ListSimOptions(void);
+
+// battle.c
+void RunSimBattle(u32 seed, struct SimResult *result);
+
+// frontier.c
+int CheckFrontierParties(u32 count, u32 seed);
+
+#endif // GUARD_BATTLE_SIM_H
@@ -0,0 +1,357 @@
+// Battle specs: JSON files naming both parties, the AI driving each side
+// and the randomizer/difficulty options the battles run under.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "global.h"
+#include "constants/battle.h"
+#include "constants/battle_ai.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/opponents.h"
+#include "json.h"
+#include "sim.h"
+
+struct SimConstant
+{
+    const char *name;
+    u32 value;
+};
+
+// Generated from the constants headers by the Makefile.
+static const struct SimConstant sSimConstants[] =
+{
+#include "sim_constants.h"
+};
+
+#define SIM_OPTIONS                         \
+    X(tx_Random_Chaos)                      \
+    X(tx_Random_Type)                       \
+    X(tx_Random_TypeEffectiveness)          \
+    X(tx_Random_Abilities)                  \
+    X(tx_Random_Moves)                      \
+    X(tx_Challenges_EvoLimit)               \
+    X(tx_Challenges_OneTypeChallenge)       \
+    X(tx_Challenges_NoItemPlayer)           \
+    X(tx_Challenges_NoItemTrainer)          \
+    X(tx_Challenges_BaseStatEqualizer)      \
+    X(tx_Challenges_LevelCap)               \
+    X(tx_Challenges_ExpMultiplier)          \
+    X(tx_Challenges_NoEVs)                  \
+    X(tx_Challenges_TrainerScalingIVs)      \
+    X(tx_Challenges_TrainerScalingEVs)      \
+    X(tx_Challenges_MaxPartyIVs)            \
+    X(tx_Mode_PoisonSurvive)                \
+    X(tx_Mode_New_Citrus)                   \
+    X(tx_Mode_Fairy_Types)                  \
+    X(tx_Mode_Sturdy)                       \
+    X(tx_Mode_Modern_Moves)                 \
+    X(tx_Mode_Legendary_Abilities)          \
+    X(tx_Mode_TypeEffectiveness)            \
+    X(tx_Difficulty_HardExp)                \
+    X(tx_Features_LimitDifficulty)
+
+#define X(field) static void SetOption_##field(u32 value) { gSaveBlock1Ptr->field = value; }
+SIM_OPTIONS
+#undef X
+
+static const struct
+{
+    const char *name;
+    void (*set)(u32 value);
+} sSimOptions[] =
+{
+#define X(field) {#field, SetOption_##field},
+    SIM_OPTIONS
+#undef X
+};
+
+static s32 FindSimOption(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < ARRAY_COUNT(sSimOptions); i++)
+    {
+        // The "tx_" prefix is optional in specs.
+        if (strcmp(name, sSimOptions[i].name) == 0 || strcmp(name, sSimOptions[i].name + 3) == 0)
+            return i;
+    }
+    return -1;
+}
+
+void ApplySimOption(const struct SimOption *option)
+{
+    sSimOptions[option->id].set(option->value);
+}
+
+void ListSimOptions(void)
+{
+    size_t i;
+
+    for (i = 0; i < ARRAY_COUNT(sSimOptions); i++)
+        printf("%s\n", sSimOptions[i].name);
+}
+
+static const char *sSpecPath;
+
+static bool8 SpecError(const char *fmt, const char *arg)
+{
+    fprintf(stderr, "%s: ", sSpecPath);
+    fprintf(stderr, fmt, arg);
+    fputc('\n', stderr);
+    return FALSE;
+}
+
+// Accepts a number, a full constant name ("MOVE_SURF") or the name without
+// its prefix in any case ("surf", "Ice Beam").
+static bool8 ReadConstant(const struct JsonNode *node, const char *prefix, u32 *value)
+{
+    char name[64];
+    size_t i, len;
+
+    if (node->type == JSON_NUMBER || node->type == JSON_BOOL)
+    {
+        *value = node->number;
+        return TRUE;
+    }
+    if (node->type != JSON_STRING)
+        return SpecError("expected a number or a %s name", prefix);
+
+    len = snprintf(name, sizeof(name), "%s", node->string);
+    if (strncmp(name, prefix, strlen(prefix)) != 0)
+        len = snprintf(name, sizeof(name), "%s%s", prefix, node->string);
+    for (i = 0; i < len && i < sizeof(name); i++)
+        name[i] = (name[i] == ' ' || name[i] == '-') ? '_' : toupper((unsigned char)name[i]);
+
+    for (i = 0; i < ARRAY_COUNT(sSimConstants); i++)
+    {
+        if (strcmp(name, sSimConstants[i].name) == 0)
+        {
+            *value = sSimConstants[i].value;
+            return TRUE;
+        }
+    }
+    return SpecError("unknown constant %s", name);
+}
+
+static bool8 ReadStatArray(const struct JsonNode *node, u8 *stats, u32 max)
+{
+    const struct JsonNode *child;
+    s32 i;
+
+    if (node->type == JSON_NUMBER)
+    {
+        for (i = 0; i < NUM_STATS; i++)
+            stats[i] = min(node->number, max);
+        return TRUE;
+    }
+    if (node->type != JSON_ARRAY || JsonCount(node) != NUM_STATS)
+        return SpecError("%s", "stats must be a number or an array of six");
+    for (child = node->children, i = 0; child != NULL; child = child->next, i++)
+        stats[i] = min(child->number, max);
+    return TRUE;
+}
+
+static bool8 ReadMon(const struct JsonNode *node, struct SimMon *mon)
+{
+    const struct JsonNode *field, *child;
+    u32 value;
+    s32 i;
+
+    memset(mon, 0, sizeof(*mon));
+    mon->level = 50;
+    mon->nature = NUM_NATURES;
+    for (i = 0; i < NUM_STATS; i++)
+        mon->ivs[i] = MAX_PER_STAT_IVS;
+
+    if ((field = JsonGet(node, "species")) == NULL)
+        return SpecError("%s", "party member without species");
+    if (!ReadConstant(field, "SPECIES_", &value))
+        return FALSE;
+    mon->species = value;
+
+    if ((field = JsonGet(node, "level")) != NULL)
+        mon->level = field->number;
+    if ((field = JsonGet(node, "ability")) != NULL)
+        mon->abilityNum = field->number;
+    if ((field = JsonGet(node, "item")) != NULL)
+    {
+        if (!ReadConstant(field, "ITEM_", &value))
+            return FALSE;
+        mon->item = value;
+    }
+    if ((field = JsonGet(node, "nature")) != NULL)
+    {
+        if (!ReadConstant(field, "NATURE_", &value))
+            return FALSE;
+        mon->nature = value;
+    }
+    if ((field = JsonGet(node, "ivs")) != NULL && !ReadStatArray(field, mon->ivs, MAX_PER_STAT_IVS))
+        return FALSE;
+    if ((field = JsonGet(node, "evs")) != NULL && !ReadStatArray(field, mon->evs, MAX_PER_STAT_EVS))
+        return FALSE;
+
+    // Without a move list the mon keeps its level-up moves.
+    if ((field = JsonGet(node, "moves")) != NULL)
+    {
+        for (child = field->children, i = 0; child != NULL && i < MAX_MON_MOVES; child = child->next, i++)
+        {
+            if (!ReadConstant(child, "MOVE_", &value))
+                return FALSE;
+            mon->moves[i] = value;
+        }
+    }
+    return TRUE;
+}
+
+static bool8 ReadSide(const struct JsonNode *node, struct SimSide *side)
+{
+    const struct JsonNode *field, *child;
+    u32 value;
+
+    if (node == NULL)
+        return SpecError("%s", "both \"player\" and \"opponent\" are required");
+
+    side->aiFlags = AI_SCRIPT_CHECK_BAD_MOVE | AI_SCRIPT_TRY_TO_FAINT | AI_SCRIPT_CHECK_VIABILITY;
+    if ((field = JsonGet(node, "ai")) != NULL)
+    {
+        if (field->type == JSON_ARRAY)
+        {
+            side->aiFlags = 0;
+            for (child = field->children; child != NULL; child = child->next)
+            {
+                if (!ReadConstant(child, "AI_SCRIPT_", &value))
+                    return FALSE;
+                side->aiFlags |= value;
+            }
+        }
+        else if (!ReadConstant(field, "AI_SCRIPT_", &side->aiFlags))
+        {
+            return FALSE;
+        }
+    }
+
+    field = JsonGet(node, "party");
+    if (field == NULL || field->type != JSON_ARRAY || JsonCount(field) == 0 || JsonCount(field) > PARTY_SIZE)
+        return SpecError("%s", "\"party\" must list one to six pokemon");
+    for (child = field->children; child != NULL; child = child->next)
+    {
+        if (!ReadMon(child, &side->party[side->partySize++]))
+            return FALSE;
+    }
+
+    // Moves to use in order, one per turn, before the AI takes over.
+    if ((field = JsonGet(node, "script")) != NULL)
+    {
+        for (child = field->children; child != NULL && side->scriptLength < SIM_MAX_SCRIPT; child = child->next)
+        {
+            if (!ReadConstant(child, "MOVE_", &value))
+                return FALSE;
+            side->script[side->scriptLength++] = value;
+        }
+    }
+    return TRUE;
+}
+
+static char *ReadFile(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *text;
+    long size;
+
+    if (file == NULL)
+        return NULL;
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    text = malloc(size + 1);
+    if (fread(text, 1, size, file) != (size_t)size)
+    {
+        free(text);
+        fclose(file);
+        return NULL;
+    }
+    text[size] = '\0';
+    fclose(file);
+    return text;
+}
+
+bool8 LoadSimSpec(const char *path, struct SimSpec *spec)
+{
+    struct JsonNode *root, *field, *child;
+    char error[128];
+    char *text;
+    bool8 ok = FALSE;
+    u32 value;
+
+    sSpecPath = path;
+    memset(spec, 0, sizeof(*spec));
+    spec->seed = 1;
+    spec->battles = 1;
+    spec->maxFrames = 200000;
+    spec->terrain = BATTLE_TERRAIN_BUILDING;
+    spec->trainerId = TRAINER_SAWYER_1;
+
+    if ((text = ReadFile(path)) == NULL)
+        return SpecError("%s", "cannot read file");
+    root = JsonParse(text, error, sizeof(error));
+    free(text);
+    if (root == NULL)
+        return SpecError("%s", error);
+
+    if ((field = JsonGet(root, "seed")) != NULL)
+        spec->seed = field->number;
+    if ((field = JsonGet(root, "battles")) != NULL)
+        spec->battles = field->number;
+    if ((field = JsonGet(root, "maxFrames")) != NULL)
+        spec->maxFrames = field->number;
+    if ((field = JsonGet(root, "badges")) != NULL)
+        spec->badges = min(field->number, 8);
+    if ((field = JsonGet(root, "format")) != NULL)
+        spec->isDouble = (field->type == JSON_STRING && strcmp(field->string, "double") == 0);
+    if ((field = JsonGet(root, "terrain")) != NULL)
+    {
+        if (!ReadConstant(field, "BATTLE_TERRAIN_", &value))
+            goto done;
+        spec->terrain = value;
+    }
+    if ((field = JsonGet(root, "trainer")) != NULL)
+    {
+        if (!ReadConstant(field, "TRAINER_", &value))
+            goto done;
+        spec->trainerId = value;
+    }
+
+    if ((field = JsonGet(root, "options")) != NULL)
+    {
+        for (child = field->children; child != NULL && spec->optionCount < SIM_MAX_OPTIONS; child = child->next)
+        {
+            struct SimOption *option = &spec->options[spec->optionCount++];
+            s32 id = FindSimOption(child->key);
+
+            if (id < 0)
+            {
+                SpecError("unknown option %s (see --list-options)", child->key);
+                goto done;
+            }
+            option->id = id;
+            option->value = child->number;
+        }
+    }
+
+    if (!ReadSide(JsonGet(root, "player"), &spec->sides[B_SIDE_PLAYER]))
+        goto done;
+    if (!ReadSide(JsonGet(root, "opponent"), &spec->sides[B_SIDE_OPPONENT]))
+        goto done;
+    if (spec->isDouble && (spec->sides[B_SIDE_PLAYER].partySize < 2 || spec->sides[B_SIDE_OPPONENT].partySize < 2))
+    {
+        SpecError("%s", "double battles need at least two pokemon per side");
+        goto done;
+    }
+    ok = TRUE;
+
+done:
+    JsonFree(root);
+    return ok;
+}
@@ -0,0 +1,1163 @@
+// Everything the battle engine calls outside the files the simulator
+// compiles. Graphics, sound, link and overworld code has no bearing on how
+// a battle plays out, so it is reduced to no-ops that report "done" or
+// "nothing here"; the few pieces of game logic the engine depends on are
+// carried over from their original files.
+
+#include "global.h"
+#include "apprentice.h"
+#include "battle.h"
+#include "battle_anim.h"
+#include "battle_arena.h"
+#include "battle_bg.h"
+#include "battle_controllers.h"
+#include "battle_factory.h"
+#include "battle_gfx_sfx_util.h"
+#include "battle_interface.h"
+#include "battle_message.h"
+#include "battle_pike.h"
+#include "battle_pyramid.h"
+#include "battle_pyramid_bag.h"
+#include "battle_setup.h"
+#include "battle_tower.h"
+#include "bg.h"
+#include "cable_club.h"
+#include "debug.h"
+#include "event_data.h"
+#include "evolution_scene.h"
+#include "field_specials.h"
+#include "field_weather.h"
+#include "fieldmap.h"
+#include "frontier_util.h"
+#include "gpu_regs.h"
+#include "international_string_util.h"
+#include "item_menu.h"
+#include "item_use.h"
+#include "link.h"
+#include "link_rfu.h"
+#include "load_save.h"
+#include "m4a.h"
+#include "main.h"
+#include "menu.h"
+#include "menu_specialized.h"
+#include "money.h"
+#include "naming_screen.h"
+#include "new_game.h"
+#include "overworld.h"
+#include "palette.h"
+#include "party_menu.h"
+#include "pokeblock.h"
+#include "pokedex.h"
+#include "pokemon_icon.h"
+#include "pokemon_storage_system.h"
+#include "pokemon_summary_screen.h"
+#include "recorded_battle.h"
+#include "reshow_battle_screen.h"
+#include "roamer.h"
+#include "rtc.h"
+#include "safari_zone.h"
+#include "scanline_effect.h"
+#include "secret_base.h"
+#include "sound.h"
+#include "sprite.h"
+#include "string_util.h"
+#include "strings.h"
+#include "task.h"
+#include "text.h"
+#include "trainer_hill.h"
+#include "tv.h"
+#include "window.h"
+#include "constants/apprentice.h"
+#include "constants/map_types.h"
+#include "constants/party_menu.h"
+#include "constants/weather.h"
+#include "sim.h"
+
+// main.c
+const u8 gGameVersion = GAME_VERSION;
+const u8 gGameLanguage = GAME_LANGUAGE;
+struct Main gMain;
+
+void SetMainCallback2(MainCallback callback)
+{
+    gMain.callback2 = callback;
+    gMain.state = 0;
+}
+
+void SetVBlankCallback(IntrCallback callback)
+{
+}
+
+void SetHBlankCallback(IntrCallback callback)
+{
+}
+
+// load_save.c
+struct SaveBlock1 *gSaveBlock1Ptr;
+struct SaveBlock2 *gSaveBlock2Ptr;
+
+void MoveSaveBlocks_ResetHeap(void)
+{
+}
+
+// debug.c
+EWRAM_DATA bool8 gIsDebugBattle;
+EWRAM_DATA u32 gDebugAIFlags;
+
+// data/event_scripts.s
+static u16 sUnusedSpecialVar;
+
+u16 *const gSpecialVars[] =
+{
+    &gSpecialVar_0x8000,
+    &gSpecialVar_0x8001,
+    &gSpecialVar_0x8002,
+    &gSpecialVar_0x8003,
+    &gSpecialVar_0x8004,
+    &gSpecialVar_0x8005,
+    &gSpecialVar_0x8006,
+    &gSpecialVar_0x8007,
+    &gSpecialVar_0x8008,
+    &gSpecialVar_0x8009,
+    &gSpecialVar_0x800A,
+    &gSpecialVar_0x800B,
+    &gSpecialVar_Facing,
+    &gSpecialVar_Result,
+    &sUnusedSpecialVar, // gSpecialVar_ItemId
+    &gSpecialVar_LastTalked,
+    &sUnusedSpecialVar, // gSpecialVar_ContestRank
+    &sUnusedSpecialVar, // gSpecialVar_ContestCategory
+    &gSpecialVar_MonBoxId,
+    &gSpecialVar_MonBoxPos,
+    &gSpecialVar_Unused_0x8014,
+    &gTrainerBattleOpponent_A,
+};
+
+// data/text/pc_transfer.inc
+const u8 gText_PkmnTransferredSomeonesPC[] = {EOS};
+const u8 gText_PkmnTransferredBillsPC[] = {EOS};
+const u8 gText_PkmnTransferredSomeonesPCBoxFull[] = {EOS};
+const u8 gText_PkmnTransferredBillsPCBoxFull[] = {EOS};
+
+// battle_setup.c
+EWRAM_DATA u16 gTrainerBattleOpponent_A;
+EWRAM_DATA u16 gTrainerBattleOpponent_B;
+EWRAM_DATA u16 gPartnerTrainerId;
+EWRAM_DATA u8 NuzlockeIsCaptureBlocked;
+EWRAM_DATA u8 NuzlockeIsSpeciesClauseActive;
+EWRAM_DATA u8 OneTypeChallengeCaptureBlocked;
+
+u8 BattleSetup_GetTerrainId(void)
+{
+    return gSimSpec->terrain;
+}
+
+u8 GetScaledLevel(u8 lvl)
+{
+    return lvl;
+}
+
+const u8 *GetTrainerALoseText(void)
+{
+    return gText_EmptyString3;
+}
+
+const u8 *GetTrainerBLoseText(void)
+{
+    return gText_EmptyString3;
+}
+
+// party_menu.c
+EWRAM_DATA u8 gBattlePartyCurrentOrder[PARTY_SIZE / 2];
+
+static void BufferBattlePartyOrderBySide(u8 *partyBattleOrder, u8 flankId, u8 battlerId)
+{
+    u8 partyIndexes[PARTY_SIZE];
+    int i, j;
+    u8 leftBattler;
+    u8 rightBattler;
+
+    if (GetBattlerSide(battlerId) == B_SIDE_PLAYER)
+    {
+        leftBattler = GetBattlerAtPosition(B_POSITION_PLAYER_LEFT);
+        rightBattler = GetBattlerAtPosition(B_POSITION_PLAYER_RIGHT);
+    }
+    else
+    {
+        leftBattler = GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT);
+        rightBattler = GetBattlerAtPosition(B_POSITION_OPPONENT_RIGHT);
+    }
+
+    if (IsDoubleBattle() == FALSE)
+    {
+        j = 1;
+        partyIndexes[0] = gBattlerPartyIndexes[leftBattler];
+        for (i = 0; i < PARTY_SIZE; i++)
+        {
+            if (i != partyIndexes[0])
+            {
+                partyIndexes[j] = i;
+                j++;
+            }
+        }
+    }
+    else
+    {
+        j = 2;
+        partyIndexes[0] = gBattlerPartyIndexes[leftBattler];
+        partyIndexes[1] = gBattlerPartyIndexes[rightBattler];
+        for (i = 0; i < PARTY_SIZE; i++)
+        {
+            if (i != partyIndexes[0] && i != partyIndexes[1])
+            {
+                partyIndexes[j] = i;
+                j++;
+            }
+        }
+    }
+
+    for (i = 0; i < 3; i++)
+        partyBattleOrder[i] = (partyIndexes[0 + (i * 2)] << 4) | partyIndexes[1 + (i * 2)];
+}
+
+void BufferBattlePartyCurrentOrderBySide(u8 battlerId, u8 flankId)
+{
+    BufferBattlePartyOrderBySide(gBattleStruct->battlerPartyOrders[battlerId], flankId, battlerId);
+}
+
+static u8 GetPartyIdFromBattleSlot(u8 slot)
+{
+    u8 modResult = slot & 1;
+    u8 retVal;
+
+    slot /= 2;
+    if (modResult != 0)
+        retVal = gBattlePartyCurrentOrder[slot] & 0xF;
+    else
+        retVal = gBattlePartyCurrentOrder[slot] >> 4;
+    return retVal;
+}
+
+static void SetPartyIdAtBattleSlot(u8 slot, u8 setVal)
+{
+    bool32 modResult = slot & 1;
+
+    slot /= 2;
+    if (modResult != 0)
+        gBattlePartyCurrentOrder[slot] = (gBattlePartyCurrentOrder[slot] & 0xF0) | setVal;
+    else
+        gBattlePartyCurrentOrder[slot] = (gBattlePartyCurrentOrder[slot] & 0xF) | (setVal << 4);
+}
+
+void SwitchPartyMonSlots(u8 slot, u8 slot2)
+{
+    u8 partyId = GetPartyIdFromBattleSlot(slot);
+    SetPartyIdAtBattleSlot(slot, GetPartyIdFromBattleSlot(slot2));
+    SetPartyIdAtBattleSlot(slot2, partyId);
+}
+
+u8 GetPartyIdFromBattlePartyId(u8 battlePartyId)
+{
+    u8 i, j;
+
+    for (j = i = 0; i < (int)ARRAY_COUNT(gBattlePartyCurrentOrder); j++, i++)
+    {
+        if ((gBattlePartyCurrentOrder[i] >> 4) != battlePartyId)
+        {
+            j++;
+            if ((gBattlePartyCurrentOrder[i] & 0xF) == battlePartyId)
+                return j;
+        }
+        else
+        {
+            return j;
+        }
+    }
+    return 0;
+}
+
+void SwitchPartyOrderLinkMulti(u8 battlerId, u8 slot, u8 arrayIndex)
+{
+}
+
+bool8 IsMultiBattle(void)
+{
+    return FALSE;
+}
+
+bool8 MonKnowsMove(struct Pokemon *mon, u16 move)
+{
+    u8 i;
+
+    for (i = 0; i < MAX_MON_MOVES; i++)
+    {
+        if (GetMonData(mon, MON_DATA_MOVE1 + i) == move)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+u8 *GetMonNickname(struct Pokemon *mon, u8 *dest)
+{
+    GetMonData(mon, MON_DATA_NICKNAME, dest);
+    return StringGet_Nickname(dest);
+}
+
+u8 GetMonAilment(struct Pokemon *mon)
+{
+    return AILMENT_NONE;
+}
+
+void ShowPartyMenuToShowcaseMultiBattleParty(void)
+{
+}
+
+// battle_interface.c
+u8 GetScaledHPFraction(s16 hp, s16 maxhp, u8 scale)
+{
+    u8 result = hp * scale / maxhp;
+
+    if (result == 0 && hp > 0)
+        return 1;
+
+    return result;
+}
+
+// new_game.c
+u32 GetTrainerId(u8 *trainerId)
+{
+    return (trainerId[3] << 24) | (trainerId[2] << 16) | (trainerId[1] << 8) | (trainerId[0]);
+}
+
+// battle_bg.c
+static const struct WindowTemplate sSimBattleWindows[32];
+
+const struct WindowTemplate *const gBattleWindowTemplates[] =
+{
+    sSimBattleWindows,
+    sSimBattleWindows,
+};
+
+void InitBattleBgsVideo(void)
+{
+}
+
+void LoadBattleTextboxAndBackground(void)
+{
+}
+
+void DrawBattleEntryBackground(void)
+{
+}
+
+void InitLinkBattleVsScreen(u8 taskId)
+{
+}
+
+// battle_gfx_sfx_util.c
+bool8 BattleInitAllSprites(u8 *state1, u8 *battlerId)
+{
+    return TRUE;
+}
+
+void AllocateBattleSpritesData(void)
+{
+}
+
+void FreeBattleSpritesData(void)
+{
+}
+
+void AllocateMonSpritesGfx(void)
+{
+}
+
+void FreeMonSpritesGfx(void)
+{
+}
+
+void ClearTemporarySpeciesSpriteData(u8 battlerId, bool8 dontClearSubstitute)
+{
+}
+
+void FillAroundBattleWindows(void)
+{
+}
+
+void HandleLowHpMusicChange(struct Pokemon *mon, u8 battlerId)
+{
+}
+
+void BattleStopLowHpSound(void)
+{
+}
+
+// battle_anim.c
+void ClearBattleAnimationVars(void)
+{
+}
+
+// reshow_battle_screen.c
+void ReshowBattleScreenAfterMenu(void)
+{
+}
+
+// menu_specialized.c
+void GetMonLevelUpWindowStats(struct Pokemon *mon, u16 *currStats)
+{
+}
+
+void DrawLevelUpWindowPg1(u16 windowId, u16 *statsBefore, u16 *statsAfter, u8 bgClr, u8 fgClr, u8 shadowClr)
+{
+}
+
+void DrawLevelUpWindowPg2(u16 windowId, u16 *currStats, u8 bgClr, u8 fgClr, u8 shadowClr)
+{
+}
+
+// Controllers the simulator never selects.
+void SetControllerToLinkOpponent(void)
+{
+}
+
+void SetControllerToLinkPartner(void)
+{
+}
+
+void SetControllerToRecordedPlayer(void)
+{
+}
+
+void SetControllerToRecordedOpponent(void)
+{
+}
+
+void SetControllerToSafari(void)
+{
+}
+
+void SetControllerToWally(void)
+{
+}
+
+// recorded_battle.c
+EWRAM_DATA u32 gRecordedBattleRngSeed;
+EWRAM_DATA u32 gBattlePalaceMoveSelectionRngValue;
+EWRAM_DATA u8 gRecordedBattleMultiplayerId;
+
+void RecordedBattle_Init(u8 mode)
+{
+}
+
+void RecordedBattle_SetTrainerInfo(void)
+{
+}
+
+void RecordedBattle_SetBattlerAction(u8 battlerId, u8 action)
+{
+}
+
+void RecordedBattle_ClearBattlerAction(u8 battlerId, u8 bytesToClear)
+{
+}
+
+u8 RecordedBattle_BufferNewBattlerData(u8 *dst)
+{
+    return 0;
+}
+
+bool8 RecordedBattle_CanStopPlayback(void)
+{
+    return FALSE;
+}
+
+void RecordedBattle_SetPlaybackFinished(void)
+{
+}
+
+void RecordedBattle_SaveParties(void)
+{
+}
+
+void RecordedBattle_CopyBattlerMoves(void)
+{
+}
+
+void RecordedBattle_CheckMovesetChanges(u8 mode)
+{
+}
+
+void RecordedBattle_ClearFrontierPassFlag(void)
+{
+}
+
+void RecordedBattle_SetFrontierPassFlagFromHword(u16 flags)
+{
+}
+
+u32 GetAiScriptsInRecordedBattle(void)
+{
+    return 0;
+}
+
+u8 GetBattleSceneInRecordedBattle(void)
+{
+    return 0;
+}
+
+u8 GetTextSpeedInRecordedBattle(void)
+{
+    return 0;
+}
+
+// Battle Frontier and Trainer Hill.
+void BattleArena_InitPoints(void)
+{
+}
+
+void BattleArena_AddMindPoints(u8 battler)
+{
+}
+
+void BattleArena_AddSkillPoints(u8 battler)
+{
+}
+
+u8 BattleArena_ShowJudgmentWindow(u8 *state)
+{
+    return 0;
+}
+
+void DrawArenaRefereeTextBox(void)
+{
+}
+
+void EraseArenaRefereeTextBox(void)
+{
+}
+
+u32 GetAiScriptsInBattleFactory(void)
+{
+    return 0;
+}
+
+bool8 InBattlePike(void)
+{
+    return FALSE;
+}
+
+u8 InBattlePyramid(void)
+{
+    return FALSE;
+}
+
+u16 GetBattlePyramidPickupItemId(void)
+{
+    return ITEM_NONE;
+}
+
+u8 GetPyramidRunMultiplier(void)
+{
+    return 0;
+}
+
+EWRAM_DATA struct PyramidBagMenuState gPyramidBagMenuState;
+
+void GetFrontierTrainerName(u8 *dst, u16 trainerId)
+{
+    dst[0] = EOS;
+}
+
+void GetBattleTowerTrainerLanguage(u8 *dst, u16 trainerId)
+{
+    *dst = GAME_LANGUAGE;
+}
+
+void TrySetLinkBattleTowerEnemyPartyLevel(void)
+{
+}
+
+u8 GetFrontierOpponentClass(u16 trainerId)
+{
+    return 0;
+}
+
+u8 GetEreaderTrainerClassId(void)
+{
+    return 0;
+}
+
+void GetEreaderTrainerName(u8 *dst)
+{
+    dst[0] = EOS;
+}
+
+u8 GetFrontierBrainTrainerClass(void)
+{
+    return 0;
+}
+
+void CopyFrontierBrainTrainerName(u8 *dst)
+{
+    dst[0] = EOS;
+}
+
+void CopyFrontierTrainerText(u8 whichText, u16 trainerId)
+{
+    gStringVar4[0] = EOS;
+}
+
+// Apprentices only come from record mixing.
+const struct ApprenticeTrainer gApprentices[NUM_APPRENTICES];
+
+const u8 *GetApprenticeNameInLanguage(u32 apprenticeId, s32 language)
+{
+    static const u8 sName[] = {EOS};
+
+    return sName;
+}
+
+void InitTrainerHillBattleStruct(void)
+{
+}
+
+void FreeTrainerHillBattleStruct(void)
+{
+}
+
+u8 GetTrainerHillOpponentClass(u16 trainerId)
+{
+    return 0;
+}
+
+void GetTrainerHillTrainerName(u8 *dst, u16 trainerId)
+{
+    dst[0] = EOS;
+}
+
+void CopyTrainerHillTrainerText(u8 which, u16 trainerId)
+{
+    gStringVar4[0] = EOS;
+}
+
+// Link play.
+EWRAM_DATA struct LinkPlayer gLinkPlayers[MAX_RFU_PLAYERS];
+EWRAM_DATA u16 gBlockRecvBuffer[MAX_RFU_PLAYERS][BLOCK_BUFFER_SIZE / 2];
+EWRAM_DATA bool8 gReceivedRemoteLinkPlayers;
+EWRAM_DATA u8 gWirelessCommType;
+
+void OpenLink(void)
+{
+}
+
+void SetWirelessCommType1(void)
+{
+}
+
+u8 GetMultiplayerId(void)
+{
+    return 0;
+}
+
+u8 GetLinkPlayerCount(void)
+{
+    return 1;
+}
+
+u8 GetLinkPlayerCount_2(void)
+{
+    return 1;
+}
+
+bool8 IsLinkMaster(void)
+{
+    return TRUE;
+}
+
+u8 BitmaskAllOtherLinkPlayers(void)
+{
+    return 0;
+}
+
+bool8 SendBlock(u8 unused, const void *src, u16 size)
+{
+    return TRUE;
+}
+
+u8 GetBlockReceivedStatus(void)
+{
+    return 0;
+}
+
+void ResetBlockReceivedFlags(void)
+{
+}
+
+void CheckShouldAdvanceLinkState(void)
+{
+}
+
+bool8 IsLinkTaskFinished(void)
+{
+    return TRUE;
+}
+
+bool8 IsLinkRfuTaskFinished(void)
+{
+    return TRUE;
+}
+
+void SetLinkStandbyCallback(void)
+{
+}
+
+void SetCloseLinkCallback(void)
+{
+}
+
+void Task_WaitForLinkPlayerConnection(u8 taskId)
+{
+    DestroyTask(taskId);
+}
+
+void LoadWirelessStatusIndicatorSpriteGfx(void)
+{
+}
+
+void CreateWirelessStatusIndicatorSprite(u8 x, u8 y)
+{
+}
+
+// Overworld state the engine reads or updates when a battle ends.
+EWRAM_DATA struct MapHeader gMapHeader;
+struct Time gLocalTime;
+EWRAM_DATA u8 gNumSafariBalls;
+
+u8 GetCurrentMapType(void)
+{
+    return MAP_TYPE_ROUTE;
+}
+
+u8 GetCurrentRegionMapSectionId(void)
+{
+    return 0;
+}
+
+u8 NuzlockeGetCurrentRegionMapSectionId(void)
+{
+    return 0;
+}
+
+u8 GetCurrentWeather(void)
+{
+    return WEATHER_NONE;
+}
+
+u8 UpdateTimeOfDay(void)
+{
+    return 0;
+}
+
+bool8 CurMapIsSecretBase(void)
+{
+    return FALSE;
+}
+
+void IncrementGameStat(u8 index)
+{
+}
+
+void AddMoney(u32 *moneyPtr, u32 toAdd)
+{
+}
+
+void RemoveMoney(u32 *moneyPtr, u32 toSub)
+{
+}
+
+void SetRoamerInactive(void)
+{
+}
+
+void UpdateRoamerHPStatus(struct Pokemon *mon)
+{
+}
+
+void TryPutBreakingNewsOnAir(void)
+{
+}
+
+void TryPutPokemonTodayOnAir(void)
+{
+}
+
+u8 GetPlayerTextSpeedDelay(void)
+{
+    return 0;
+}
+
+u8 GetItemListPosition(u8 pocketId)
+{
+    return 0;
+}
+
+s8 GetSetPokedexFlag(u16 nationalNum, u8 caseId)
+{
+    return 0;
+}
+
+u16 GetPokedexHeightWeight(u16 dexNum, u8 data)
+{
+    return 0;
+}
+
+u8 DisplayCaughtMonDexPage(u16 species, u32 otId, u32 personality)
+{
+    return 0;
+}
+
+void DoNamingScreen(u8 templateNum, u8 *destBuffer, u16 monSpecies, u16 monGender, u32 monPersonality, MainCallback returnCallback)
+{
+    SetMainCallback2(returnCallback);
+}
+
+void (*gCB2_AfterEvolution)(void);
+
+void BeginEvolutionScene(struct Pokemon *mon, u16 speciesToEvolve, bool8 canStopEvo, u8 partyID)
+{
+}
+
+void EvolutionScene(struct Pokemon *mon, u16 speciesToEvolve, bool8 canStopEvo, u8 partyID)
+{
+}
+
+u8 GetMoveSlotToReplace(void)
+{
+    return MAX_MON_MOVES;
+}
+
+void ShowSelectMovePokemonSummaryScreen(struct Pokemon *mons, u8 monIndex, u8 maxMonIndex, void (*callback)(void), u16 newMove)
+{
+    SetMainCallback2(callback);
+}
+
+// The simulator never catches anything, so the PC is always empty.
+static struct BoxPokemon sBoxMon;
+
+u8 StorageGetCurrentBox(void)
+{
+    return 0;
+}
+
+struct BoxPokemon *GetBoxedMonPtr(u8 boxId, u8 boxPosition)
+{
+    return &sBoxMon;
+}
+
+const struct BoxMonSummary *GetBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    static struct BoxMonSummary summary;
+
+    return &summary;
+}
+
+u8 *GetBoxNamePtr(u8 boxId)
+{
+    static u8 name[] = {EOS};
+
+    return name;
+}
+
+s16 CompactPartySlots(void)
+{
+    return -1;
+}
+
+void PurgeMonOrBoxMon(u8 boxId, u8 position)
+{
+}
+
+u16 GetPCBoxToSendMon(void)
+{
+    return 0;
+}
+
+void SetPCBoxToSendMon(u8 boxId)
+{
+}
+
+bool8 ShouldShowBoxWasFullMessage(void)
+{
+    return FALSE;
+}
+
+const s8 gPokeblockFlavorCompatibilityTable[NUM_NATURES * FLAVOR_COUNT];
+
+// item_use.c, referenced from the item table.
+#define ITEM_USE_FUNCS(X)                    \
+    X(ItemUseInBattle_EnigmaBerry)           \
+    X(ItemUseInBattle_Escape)                \
+    X(ItemUseInBattle_Medicine)              \
+    X(ItemUseInBattle_PPRecovery)            \
+    X(ItemUseInBattle_PokeBall)              \
+    X(ItemUseInBattle_StatIncrease)          \
+    X(ItemUseOutOfBattle_Bike)               \
+    X(ItemUseOutOfBattle_BlackWhiteFlute)    \
+    X(ItemUseOutOfBattle_CannotUse)          \
+    X(ItemUseOutOfBattle_CoinCase)           \
+    X(ItemUseOutOfBattle_EnigmaBerry)        \
+    X(ItemUseOutOfBattle_EscapeRope)         \
+    X(ItemUseOutOfBattle_EvolutionStone)     \
+    X(ItemUseOutOfBattle_ExpShare)           \
+    X(ItemUseOutOfBattle_Fertilizer)         \
+    X(ItemUseOutOfBattle_HealingHeart)       \
+    X(ItemUseOutOfBattle_InfiniteRareCandies) \
+    X(ItemUseOutOfBattle_InfiniteRepel)      \
+    X(ItemUseOutOfBattle_Itemfinder)         \
+    X(ItemUseOutOfBattle_Mail)               \
+    X(ItemUseOutOfBattle_Medicine)           \
+    X(ItemUseOutOfBattle_Mints)              \
+    X(ItemUseOutOfBattle_PPRecovery)         \
+    X(ItemUseOutOfBattle_PPUp)               \
+    X(ItemUseOutOfBattle_PokeBall)           \
+    X(ItemUseOutOfBattle_PokeblockCase)      \
+    X(ItemUseOutOfBattle_PowderJar)          \
+    X(ItemUseOutOfBattle_Radio)              \
+    X(ItemUseOutOfBattle_RareCandy)          \
+    X(ItemUseOutOfBattle_ReduceEV)           \
+    X(ItemUseOutOfBattle_Repel)              \
+    X(ItemUseOutOfBattle_Rod)                \
+    X(ItemUseOutOfBattle_SacredAsh)          \
+    X(ItemUseOutOfBattle_SootSack)           \
+    X(ItemUseOutOfBattle_TMHM)               \
+    X(ItemUseOutOfBattle_WailmerPail)
+
+#define ITEM_USE_STUB(name) void name(u8 taskId) {}
+ITEM_USE_FUNCS(ITEM_USE_STUB)
+
+// Sound.
+struct MusicPlayerInfo gMPlayInfo_BGM;
+struct MusicPlayerInfo gMPlayInfo_SE1;
+struct MusicPlayerInfo gMPlayInfo_SE2;
+
+void PlayBGM(u16 songNum)
+{
+}
+
+void PlaySE(u16 songNum)
+{
+}
+
+void FadeOutMapMusic(u8 speed)
+{
+}
+
+bool8 IsCryFinished(void)
+{
+    return TRUE;
+}
+
+void StopCryAndClearCrySongs(void)
+{
+}
+
+void m4aMPlayStop(struct MusicPlayerInfo *mplayInfo)
+{
+}
+
+void m4aMPlayVolumeControl(struct MusicPlayerInfo *mplayInfo, u16 trackBits, u16 volume)
+{
+}
+
+void m4aSongNumStop(u16 n)
+{
+}
+
+// Display: sprites, palettes, backgrounds, windows and text. Sprites are
+// never created, so callers always get the dummy sprite slot back.
+EWRAM_DATA struct Sprite gSprites[MAX_SPRITES + 1];
+u8 gReservedSpritePaletteCount;
+struct PaletteFadeControl gPaletteFade;
+struct ScanlineEffect gScanlineEffect;
+EWRAM_DATA u16 ALIGNED(4) gScanlineEffectRegBuffers[2][0x3C0];
+TextFlags gTextFlags;
+
+static const union AnimCmd sDummyAnim = {.type = 0xFFFF}; // ANIM_END
+static const union AffineAnimCmd sDummyAffineAnim = {.type = 0x7FFF}; // AFFINE_ANIM_END
+const union AnimCmd *const gDummySpriteAnimTable[] = {&sDummyAnim};
+const union AffineAnimCmd *const gDummySpriteAffineAnimTable[] = {&sDummyAffineAnim};
+
+u8 CreateSprite(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority)
+{
+    return MAX_SPRITES;
+}
+
+void DestroySprite(struct Sprite *sprite)
+{
+}
+
+void ResetSpriteData(void)
+{
+}
+
+void AnimateSprites(void)
+{
+}
+
+void BuildOamBuffer(void)
+{
+}
+
+void LoadOam(void)
+{
+}
+
+void ProcessSpriteCopyRequests(void)
+{
+}
+
+u16 LoadSpriteSheet(const struct SpriteSheet *sheet)
+{
+    return 0;
+}
+
+u8 LoadSpritePalette(const struct SpritePalette *palette)
+{
+    return 0;
+}
+
+void FreeSpriteTilesByTag(u16 tag)
+{
+}
+
+void FreeSpritePaletteByTag(u16 tag)
+{
+}
+
+void FreeAllSpritePalettes(void)
+{
+}
+
+const u8 *GetMonIconPtr(u16 speciesId, u32 personality, u32 frameNo)
+{
+    return NULL;
+}
+
+const u16 *GetValidMonIconPalettePtr(u16 speciesId)
+{
+    return NULL;
+}
+
+void LoadPalette(const void *src, u16 offset, u16 size)
+{
+}
+
+bool8 BeginNormalPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 targetY, u16 blendColor)
+{
+    return FALSE;
+}
+
+void BeginFastPaletteFade(u8 submode)
+{
+}
+
+u8 UpdatePaletteFade(void)
+{
+    return PALETTE_FADE_STATUS_DONE;
+}
+
+void ResetPaletteFade(void)
+{
+}
+
+void ResetPaletteFadeControl(void)
+{
+}
+
+void TransferPlttBuffer(void)
+{
+}
+
+void ScanlineEffect_Clear(void)
+{
+}
+
+void ScanlineEffect_SetParams(struct ScanlineEffectParams params)
+{
+}
+
+void ScanlineEffect_InitHBlankDmaTransfer(void)
+{
+}
+
+void SetGpuReg(u8 regOffset, u16 value)
+{
+}
+
+void ShowBg(u8 bg)
+{
+}
+
+void SetBgAttribute(u8 bg, u8 attributeId, u8 value)
+{
+}
+
+void CopyBgTilemapBufferToVram(u8 bg)
+{
+}
+
+void CopyToBgTilemapBufferRect_ChangePalette(u8 bg, const void *src, u8 destX, u8 destY, u8 rectWidth, u8 rectHeight, u8 palette)
+{
+}
+
+bool8 IsDma3ManagerBusyWithBgCopy(void)
+{
+    return FALSE;
+}
+
+void PutWindowTilemap(u8 windowId)
+{
+}
+
+void ClearWindowTilemap(u8 windowId)
+{
+}
+
+void FillWindowPixelBuffer(u8 windowId, u8 fillValue)
+{
+}
+
+void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOffset)
+{
+}
+
+void CopyWindowToVram(u8 windowId, u8 mode)
+{
+}
+
+void FreeAllWindowBuffers(void)
+{
+}
+
+bool16 AddTextPrinter(struct TextPrinterTemplate *template, u8 speed, void (*callback)(struct TextPrinterTemplate *, u16))
+{
+    return TRUE;
+}
+
+void RunTextPrinters(void)
+{
+}
+
+bool16 IsTextPrinterActive(u8 id)
+{
+    return FALSE;
+}
+
+int GetStringCenterAlignXOffsetWithLetterSpacing(int fontId, const u8 *str, int totalWidth, int letterSpacing)
+{
+    return 0;
+}
+
+void PadNameString(u8 *dest, u8 padChar)
+{
+}
@@ -0,0 +1,433 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "global.h"
+#include "util.h"
+#include "batch.h"
+
+// Each manifest line is "INPUT_PATH OUTPUT_PATH [options...]", the same arguments
+// gbagfx takes on its command line. Blank lines and lines starting with '#' are
+// ignored. A line whose input is another line's output (e.g. png -> 4bpp -> lz)
+// runs after that line on the same worker thread; every other line is independent.
+// The Makefile still runs gbagfx once per file; batch mode is for bulk conversions
+// run by hand or by scripts.
+
+#define NO_STEP (-1)
+
+struct BatchStep {
+    int argc;
+    char **argv;
+    uint64_t key;
+    uint64_t cachedKey;
+    bool hasCachedKey;
+    int firstDependent;
+    int nextSibling;
+    bool isRoot;
+};
+
+struct StringIndex {
+    char **keys;
+    int *values;
+    int capacity;
+};
+
+struct Batch {
+    struct BatchStep *steps;
+    int numSteps;
+    int *roots;
+    int numRoots;
+    struct StringIndex outputIndex;
+    atomic_int nextRoot;
+    atomic_int numConverted;
+};
+
+static uint64_t HashBytes(uint64_t hash, const unsigned char *data, size_t size)
+{
+    // 64-bit FNV-1a
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+static uint64_t HashString(const char *s)
+{
+    return HashBytes(0xCBF29CE484222325ull, (const unsigned char *)s, strlen(s));
+}
+
+// Options whose value names another file the conversion reads.
+static const char *const sFileOptions[] = {
+    "-palette",
+    "-tilemap",
+};
+
+static char *GetOptionInputPath(struct BatchStep *step, int argIndex)
+{
+    if (argIndex < 3 || argIndex >= step->argc)
+        return NULL;
+
+    for (size_t i = 0; i < sizeof(sFileOptions) / sizeof(sFileOptions[0]); i++)
+        if (strcmp(step->argv[argIndex - 1], sFileOptions[i]) == 0)
+            return step->argv[argIndex];
+
+    return NULL;
+}
+
+static void InitStringIndex(struct StringIndex *index, int count)
+{
+    index->capacity = 16;
+
+    while (index->capacity < count * 2)
+        index->capacity *= 2;
+
+    index->keys = calloc(index->capacity, sizeof(char *));
+    index->values = malloc(index->capacity * sizeof(int));
+
+    if (index->keys == NULL || index->values == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch index.\n");
+}
+
+static void FreeStringIndex(struct StringIndex *index)
+{
+    free(index->keys);
+    free(index->values);
+}
+
+static int *FindStringIndexSlot(struct StringIndex *index, char *key, bool insert)
+{
+    int slot = HashString(key) & (index->capacity - 1);
+
+    while (index->keys[slot] != NULL) {
+        if (strcmp(index->keys[slot], key) == 0)
+            return &index->values[slot];
+
+        slot = (slot + 1) & (index->capacity - 1);
+    }
+
+    if (!insert)
+        return NULL;
+
+    index->keys[slot] = key;
+    index->values[slot] = NO_STEP;
+    return &index->values[slot];
+}
+
+static int LookupString(struct StringIndex *index, char *key)
+{
+    int *value = FindStringIndexSlot(index, key, false);
+
+    return value != NULL ? *value : NO_STEP;
+}
+
+static char *ReadTextFile(char *path)
+{
+    int size;
+    unsigned char *buffer = ReadWholeFileZeroPadded(path, &size, 1);
+
+    return (char *)buffer;
+}
+
+static int SplitFields(char *line, char **fields, int maxFields)
+{
+    int numFields = 0;
+    char *s = line;
+
+    for (;;) {
+        while (*s == ' ' || *s == '\t' || *s == '\r')
+            s++;
+
+        if (*s == 0)
+            break;
+
+        if (fields != NULL && numFields < maxFields)
+            fields[numFields] = s;
+
+        numFields++;
+
+        while (*s != 0 && *s != ' ' && *s != '\t' && *s != '\r')
+            s++;
+
+        if (*s != 0 && fields != NULL)
+            *s++ = 0;
+    }
+
+    return numFields;
+}
+
+static void ReadManifest(struct Batch *batch, char *manifest)
+{
+    int maxSteps = 1;
+
+    for (char *s = manifest; *s != 0; s++)
+        if (*s == '\n')
+            maxSteps++;
+
+    batch->steps = malloc(maxSteps * sizeof(struct BatchStep));
+
+    if (batch->steps == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch steps.\n");
+
+    batch->numSteps = 0;
+
+    char *line = manifest;
+
+    while (line != NULL) {
+        char *lineEnd = strchr(line, '\n');
+
+        if (lineEnd != NULL)
+            *lineEnd = 0;
+
+        int numFields = SplitFields(line, NULL, 0);
+
+        if (numFields > 0 && line[strspn(line, " \t")] != '#') {
+            if (numFields < 2)
+                FATAL_ERROR("Manifest line \"%s\" has no output path.\n", line);
+
+            struct BatchStep *step = &batch->steps[batch->numSteps++];
+
+            step->argc = numFields + 1;
+            step->argv = malloc((step->argc + 1) * sizeof(char *));
+
+            if (step->argv == NULL)
+                FATAL_ERROR("Failed to allocate memory for batch step arguments.\n");
+
+            step->argv[0] = "gbagfx";
+            SplitFields(line, &step->argv[1], numFields);
+            step->argv[step->argc] = NULL;
+            step->key = 0;
+            step->hasCachedKey = false;
+            step->firstDependent = NO_STEP;
+            step->nextSibling = NO_STEP;
+            step->isRoot = true;
+        }
+
+        line = lineEnd != NULL ? lineEnd + 1 : NULL;
+    }
+}
+
+static void LinkSteps(struct Batch *batch)
+{
+    InitStringIndex(&batch->outputIndex, batch->numSteps);
+
+    for (int i = 0; i < batch->numSteps; i++) {
+        int *value = FindStringIndexSlot(&batch->outputIndex, batch->steps[i].argv[2], true);
+
+        if (*value != NO_STEP)
+            FATAL_ERROR("\"%s\" is the output of more than one manifest line.\n", batch->steps[i].argv[2]);
+
+        *value = i;
+    }
+
+    // Dependents are linked in reverse so that they run in manifest order.
+    for (int i = batch->numSteps - 1; i >= 0; i--) {
+        struct BatchStep *step = &batch->steps[i];
+        int producer = LookupString(&batch->outputIndex, step->argv[1]);
+
+        // A step only waits for the producer of its main input.
+        for (int j = 3; j < step->argc; j++) {
+            char *path = GetOptionInputPath(step, j);
+
+            if (path != NULL && LookupString(&batch->outputIndex, path) != NO_STEP)
+                FATAL_ERROR("\"%s\" is read through an option but written by another manifest line.\n", path);
+        }
+
+        if (producer != NO_STEP) {
+            step->isRoot = false;
+            step->nextSibling = batch->steps[producer].firstDependent;
+            batch->steps[producer].firstDependent = i;
+        }
+    }
+
+    batch->roots = malloc(batch->numSteps * sizeof(int));
+
+    if (batch->roots == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch roots.\n");
+
+    batch->numRoots = 0;
+
+    for (int i = 0; i < batch->numSteps; i++)
+        if (batch->steps[i].isRoot)
+            batch->roots[batch->numRoots++] = i;
+}
+
+static int CountReachableSteps(struct Batch *batch, int stepIndex)
+{
+    int count = 1;
+
+    for (int i = batch->steps[stepIndex].firstDependent; i != NO_STEP; i = batch->steps[i].nextSibling)
+        count += CountReachableSteps(batch, i);
+
+    return count;
+}
+
+static void CheckForCycles(struct Batch *batch)
+{
+    int count = 0;
+
+    for (int i = 0; i < batch->numRoots; i++)
+        count += CountReachableSteps(batch, batch->roots[i]);
+
+    if (count != batch->numSteps)
+        FATAL_ERROR("Manifest lines have a circular dependency.\n");
+}
+
+// The cache file has one "KEY OUTPUT_PATH" line per output, where KEY hashes the
+// contents of every file the step reads together with the output path and options.
+static void ReadCache(struct Batch *batch, char *cachePath)
+{
+    if (cachePath == NULL || access(cachePath, F_OK) != 0)
+        return;
+
+    char *cache = ReadTextFile(cachePath);
+    char *line = cache;
+
+    while (line != NULL) {
+        char *lineEnd = strchr(line, '\n');
+
+        if (lineEnd != NULL)
+            *lineEnd = 0;
+
+        char *fields[2];
+
+        if (SplitFields(line, fields, 2) == 2) {
+            int stepIndex = LookupString(&batch->outputIndex, fields[1]);
+
+            if (stepIndex != NO_STEP) {
+                batch->steps[stepIndex].cachedKey = strtoull(fields[0], NULL, 16);
+                batch->steps[stepIndex].hasCachedKey = true;
+            }
+        }
+
+        line = lineEnd != NULL ? lineEnd + 1 : NULL;
+    }
+
+    free(cache);
+}
+
+static void WriteCache(struct Batch *batch, char *cachePath)
+{
+    FILE *fp = fopen(cachePath, "w");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", cachePath);
+
+    for (int i = 0; i < batch->numSteps; i++)
+        fprintf(fp, "%016llx %s\n", (unsigned long long)batch->steps[i].key, batch->steps[i].argv[2]);
+
+    fclose(fp);
+}
+
+static uint64_t HashFile(uint64_t hash, char *path)
+{
+    int fileSize;
+    unsigned char *buffer = ReadWholeFile(path, &fileSize);
+
+    hash = HashBytes(hash, buffer, fileSize);
+    free(buffer);
+
+    return hash;
+}
+
+static uint64_t GetStepKey(struct BatchStep *step)
+{
+    uint64_t hash = HashFile(0xCBF29CE484222325ull, step->argv[1]);
+
+    for (int i = 2; i < step->argc; i++) {
+        char *path = GetOptionInputPath(step, i);
+
+        hash = HashBytes(hash, (const unsigned char *)step->argv[i], strlen(step->argv[i]) + 1);
+
+        if (path != NULL)
+            hash = HashFile(hash, path);
+    }
+
+    return hash;
+}
+
+static void RunStep(struct Batch *batch, int stepIndex)
+{
+    struct BatchStep *step = &batch->steps[stepIndex];
+
+    step->key = GetStepKey(step);
+
+    bool isCached = step->hasCachedKey
+        && step->cachedKey == step->key
+        && access(step->argv[2], F_OK) == 0;
+
+    if (!isCached) {
+        RunCommand(step->argc, step->argv);
+        batch->numConverted++;
+    }
+
+    for (int i = step->firstDependent; i != NO_STEP; i = batch->steps[i].nextSibling)
+        RunStep(batch, i);
+}
+
+static void *BatchWorker(void *arg)
+{
+    struct Batch *batch = arg;
+
+    for (int i = batch->nextRoot++; i < batch->numRoots; i = batch->nextRoot++)
+        RunStep(batch, batch->roots[i]);
+
+    return NULL;
+}
+
+// Runs every conversion in the manifest on a pool of worker threads. Outputs whose
+// input files and options are unchanged since the last run (according to the cache
+// file) are skipped. A failed conversion exits without writing the cache.
+void RunBatch(char *manifestPath, int numJobs, char *cachePath)
+{
+    struct Batch batch;
+    char *manifest = ReadTextFile(manifestPath);
+
+    ReadManifest(&batch, manifest);
+    LinkSteps(&batch);
+    CheckForCycles(&batch);
+    ReadCache(&batch, cachePath);
+
+    atomic_init(&batch.nextRoot, 0);
+    atomic_init(&batch.numConverted, 0);
+
+    if (numJobs == 0)
+        numJobs = sysconf(_SC_NPROCESSORS_ONLN);
+    if (numJobs < 1)
+        numJobs = 1;
+    if (numJobs > batch.numRoots)
+        numJobs = batch.numRoots > 0 ? batch.numRoots : 1;
+
+    pthread_t *workers = malloc(numJobs * sizeof(pthread_t));
+
+    if (workers == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch workers.\n");
+
+    for (int i = 1; i < numJobs; i++)
+        if (pthread_create(&workers[i], NULL, BatchWorker, &batch) != 0)
+            FATAL_ERROR("Failed to start batch worker thread.\n");
+
+    BatchWorker(&batch);
+
+    for (int i = 1; i < numJobs; i++)
+        pthread_join(workers[i], NULL);
+
+    if (cachePath != NULL)
+        WriteCache(&batch, cachePath);
+
+    printf("gbagfx: converted %d of %d files\n", (int)batch.numConverted, batch.numSteps);
+
+    for (int i = 0; i < batch.numSteps; i++)
+        free(batch.steps[i].argv);
+
+    free(workers);
+    free(batch.steps);
+    free(batch.roots);
+    FreeStringIndex(&batch.outputIndex);
+    free(manifest);
+}
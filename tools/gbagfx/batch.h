@@ -0,0 +1,7 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+void RunCommand(int argc, char **argv);
+void RunBatch(char *manifestPath, int numJobs, char *cachePath);
+
+#endif // BATCH_H
@@ -69,7 +69,215 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 14
+#define LZ_NO_POS (-1)
+
+// Chains every position with the same 3-byte hash together, most recent first, so
+// a match search only visits positions that can actually match at least 3 bytes.
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	int nextInsertPos;
+	int *head;
+	int *prev;
+};
+
+static unsigned int LZHash(unsigned char *src)
+{
+	unsigned int value = (src[0] << 16) | (src[1] << 8) | src[2];
+
+	return (value * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void LZInitMatchFinder(struct LZMatchFinder *finder, unsigned char *src, int srcSize, int minDistance)
+{
+	finder->src = src;
+	finder->srcSize = srcSize;
+	finder->minDistance = minDistance;
+	finder->nextInsertPos = 0;
+	finder->head = malloc(sizeof(int) << LZ_HASH_BITS);
+	finder->prev = malloc(sizeof(int) * srcSize);
+
+	if (finder->head == NULL || finder->prev == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ match finder.\n");
+
+	for (int i = 0; i < (1 << LZ_HASH_BITS); i++)
+		finder->head[i] = LZ_NO_POS;
+}
+
+static void LZFreeMatchFinder(struct LZMatchFinder *finder)
+{
+	free(finder->head);
+	free(finder->prev);
+}
+
+// Finds the longest match for srcPos, preferring the smallest distance when several
+// matches have the same length. This is the same match the original brute-force
+// search picked, so the greedy output is unchanged.
+static int LZFindMatch(struct LZMatchFinder *finder, int srcPos, int *matchDistance)
+{
+	unsigned char *src = finder->src;
+
+	// Every earlier position that has 3 bytes left to hash is a potential match.
+	while (finder->nextInsertPos < srcPos && finder->nextInsertPos + LZ_MIN_MATCH <= finder->srcSize) {
+		unsigned int hash = LZHash(&src[finder->nextInsertPos]);
+		finder->prev[finder->nextInsertPos] = finder->head[hash];
+		finder->head[hash] = finder->nextInsertPos;
+		finder->nextInsertPos++;
+	}
+
+	int maxLength = finder->srcSize - srcPos;
+
+	if (maxLength < LZ_MIN_MATCH)
+		return 0;
+
+	if (maxLength > LZ_MAX_MATCH)
+		maxLength = LZ_MAX_MATCH;
+
+	int bestLength = 0;
+	int bestDistance = 0;
+
+	for (int pos = finder->head[LZHash(&src[srcPos])]; pos != LZ_NO_POS; pos = finder->prev[pos]) {
+		int distance = srcPos - pos;
+
+		if (distance > LZ_MAX_DISTANCE)
+			break;
+
+		if (distance < finder->minDistance)
+			continue;
+
+		int length = 0;
+
+		while (length < maxLength && src[pos + length] == src[srcPos + length])
+			length++;
+
+		if (length > bestLength) {
+			bestLength = length;
+			bestDistance = distance;
+
+			if (length == maxLength)
+				break;
+		}
+	}
+
+	if (bestLength < LZ_MIN_MATCH)
+		return 0;
+
+	*matchDistance = bestDistance;
+	return bestLength;
+}
+
+struct LZWriter {
+	unsigned char *dest;
+	int destPos;
+	int flagsPos;
+	int numBlocks;
+};
+
+static void LZWriteFlag(struct LZWriter *writer, bool isMatch)
+{
+	// Each flags byte covers the next 8 blocks.
+	if (writer->numBlocks % 8 == 0) {
+		writer->flagsPos = writer->destPos++;
+		writer->dest[writer->flagsPos] = 0;
+	}
+
+	if (isMatch)
+		writer->dest[writer->flagsPos] |= (0x80 >> (writer->numBlocks % 8));
+
+	writer->numBlocks++;
+}
+
+static void LZWriteLiteral(struct LZWriter *writer, unsigned char value)
+{
+	LZWriteFlag(writer, false);
+	writer->dest[writer->destPos++] = value;
+}
+
+static void LZWriteMatch(struct LZWriter *writer, int length, int distance)
+{
+	LZWriteFlag(writer, true);
+	length -= 3;
+	distance--;
+	writer->dest[writer->destPos++] = (length << 4) | ((unsigned int)distance >> 8);
+	writer->dest[writer->destPos++] = (unsigned char)distance;
+}
+
+// Picks the sequence of literals and matches with the smallest encoded size.
+// A literal costs 9 bits and a match 17 bits (including the flag bit), and any
+// prefix of the longest match at a position is also a valid match.
+static void LZCompressOptimal(struct LZMatchFinder *finder, struct LZWriter *writer)
+{
+	int srcSize = finder->srcSize;
+	int *matchLengths = malloc(sizeof(int) * srcSize);
+	int *matchDistances = malloc(sizeof(int) * srcSize);
+	int *costs = malloc(sizeof(int) * (srcSize + 1));
+	int *choices = malloc(sizeof(int) * srcSize);
+
+	if (matchLengths == NULL || matchDistances == NULL || costs == NULL || choices == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ optimal parse.\n");
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos++)
+		matchLengths[srcPos] = LZFindMatch(finder, srcPos, &matchDistances[srcPos]);
+
+	costs[srcSize] = 0;
+
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		costs[srcPos] = 9 + costs[srcPos + 1];
+		choices[srcPos] = 1;
+
+		// Longer matches are tried first so that ties use fewer blocks.
+		for (int length = matchLengths[srcPos]; length >= LZ_MIN_MATCH; length--) {
+			int cost = 17 + costs[srcPos + length];
+
+			if (cost < costs[srcPos]) {
+				costs[srcPos] = cost;
+				choices[srcPos] = length;
+			}
+		}
+	}
+
+	int srcPos = 0;
+
+	while (srcPos < srcSize) {
+		if (choices[srcPos] >= LZ_MIN_MATCH) {
+			LZWriteMatch(writer, choices[srcPos], matchDistances[srcPos]);
+			srcPos += choices[srcPos];
+		} else {
+			LZWriteLiteral(writer, finder->src[srcPos]);
+			srcPos++;
+		}
+	}
+
+	free(matchLengths);
+	free(matchDistances);
+	free(costs);
+	free(choices);
+}
+
+static void LZCompressGreedy(struct LZMatchFinder *finder, struct LZWriter *writer)
+{
+	int srcPos = 0;
+
+	while (srcPos < finder->srcSize) {
+		int matchDistance;
+		int matchLength = LZFindMatch(finder, srcPos, &matchDistance);
+
+		if (matchLength >= LZ_MIN_MATCH) {
+			LZWriteMatch(writer, matchLength, matchDistance);
+			srcPos += matchLength;
+		} else {
+			LZWriteLiteral(writer, finder->src[srcPos]);
+			srcPos++;
+		}
+	}
+}
+
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, const bool optimal)
 {
 	if (srcSize <= 0)
 		goto fail;
@@ -90,64 +298,31 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 	dest[2] = (unsigned char)(srcSize >> 8);
 	dest[3] = (unsigned char)(srcSize >> 16);
 
-	int srcPos = 0;
-	int destPos = 4;
+	struct LZMatchFinder finder;
+	struct LZWriter writer = { dest, 4, 0, 0 };
 
-	for (;;) {
-		unsigned char *flags = &dest[destPos++];
-		*flags = 0;
+	LZInitMatchFinder(&finder, src, srcSize, minDistance);
 
-		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
+	if (optimal)
+		LZCompressOptimal(&finder, &writer);
+	else
+		LZCompressGreedy(&finder, &writer);
 
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
+	LZFreeMatchFinder(&finder);
 
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
+	int destPos = writer.destPos;
 
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
+	// Pad to multiple of 4 bytes.
+	int remainder = destPos % 4;
 
-					if (blockSize == 18)
-						break;
-				}
-
-				blockDistance++;
-			}
-
-			if (bestBlockSize >= 3) {
-				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
-			} else {
-				dest[destPos++] = src[srcPos++];
-			}
-
-			if (srcPos == srcSize) {
-				// Pad to multiple of 4 bytes.
-				int remainder = destPos % 4;
-
-				if (remainder != 0) {
-					for (int i = 0; i < 4 - remainder; i++)
-						dest[destPos++] = 0;
-				}
-
-				*compressedSize = destPos;
-				return dest;
-			}
-		}
+	if (remainder != 0) {
+		for (int i = 0; i < 4 - remainder; i++)
+			dest[destPos++] = 0;
 	}
 
+	*compressedSize = destPos;
+	return dest;
+
 fail:
 	FATAL_ERROR("Fatal error while compressing LZ file.\n");
 }
@@ -13,6 +13,7 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "batch.h"
 
 struct CommandHandler
 {
@@ -426,6 +427,7 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
 {
     int overflowSize = 0;
     int minDistance = 2; // default, for compatibility with LZ77UnCompVram()
+    bool optimal = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -457,6 +459,11 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
             if (minDistance < 1)
                 FATAL_ERROR("LZ min search distance must be positive.\n");
         }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            // Searches for the smallest encoding instead of always taking the longest match.
+            optimal = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option \"%s\".\n", option);
@@ -473,7 +480,7 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     unsigned char *buffer = ReadWholeFileZeroPadded(inputPath, &fileSize, overflowSize);
 
     int compressedSize;
-    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance, optimal);
 
     compressedData[1] = (unsigned char)fileSize;
     compressedData[2] = (unsigned char)(fileSize >> 8);
@@ -586,13 +593,12 @@ void HandleHuffDecompressCommand(char *inputPath, char *outputPath, int argc UNU
     free(uncompressedData);
 }
 
-int main(int argc, char **argv)
+// Runs one conversion. argv has the same layout as gbagfx's own command line, so
+// batch mode can run manifest lines through the same handlers.
+void RunCommand(int argc, char **argv)
 {
     char converted = 0;
 
-    if (argc < 3)
-        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
-
     struct CommandHandler handlers[] =
     {
         { "1bpp", "png", HandleGbaToPngCommand },
@@ -672,6 +678,59 @@ int main(int argc, char **argv)
 
     if (!converted)
         FATAL_ERROR("Don't know how to convert \"%s\" to \"%s\".\n", argv[1], argv[2]);
+}
+
+void HandleBatchCommand(int argc, char **argv)
+{
+    char *manifestPath = argv[2];
+    char *cachePath = NULL;
+    int numJobs = 0;
+
+    for (int i = 3; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No number of jobs following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numJobs))
+                FATAL_ERROR("Failed to parse number of jobs.\n");
+
+            if (numJobs < 1)
+                FATAL_ERROR("Number of jobs must be positive.\n");
+        }
+        else if (strcmp(option, "-cache") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No cache file path following \"-cache\".\n");
+
+            i++;
+
+            cachePath = argv[i];
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    RunBatch(manifestPath, numJobs, cachePath);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n"
+                    "       gbagfx --batch MANIFEST_PATH [-j JOBS] [-cache CACHE_PATH]\n");
+
+    if (strcmp(argv[1], "--batch") == 0)
+        HandleBatchCommand(argc, argv);
+    else
+        RunCommand(argc, argv);
 
     return 0;
 }
@@ -0,0 +1,334 @@
+// Generates the table the bag uses to sort items by name.
+//
+// Reads the item names from gItems in src/data/items.h, encodes them with charmap.txt
+// the way preproc does, and writes each item's position in alphabetical
+// order, so the game compares two numbers instead of two strings.
+//
+// Usage: itemrank ITEMS_H CHARMAP_TXT OUTPUT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define MAX_ENCODED_LENGTH 64
+
+struct CharmapEntry
+{
+    char *key;          // UTF-8 character, or constant name for {NAME}
+    bool isConstant;
+    unsigned char bytes[8];
+    int length;
+};
+
+struct ItemName
+{
+    char *constant;
+    unsigned char encoded[MAX_ENCODED_LENGTH];
+    int length;
+    int rank;
+};
+
+static struct CharmapEntry *sCharmap;
+static int sCharmapCount;
+static struct ItemName *sItems;
+static int sItemCount;
+
+static void *Realloc(void *ptr, size_t size)
+{
+    ptr = realloc(ptr, size);
+    if (ptr == NULL)
+        FATAL_ERROR("Out of memory\n");
+    return ptr;
+}
+
+static char *CopyString(const char *start, size_t length)
+{
+    char *str = Realloc(NULL, length + 1);
+
+    memcpy(str, start, length);
+    str[length] = 0;
+    return str;
+}
+
+static char *SkipSpace(char *s)
+{
+    while (*s == ' ' || *s == '\t')
+        s++;
+    return s;
+}
+
+static void ReadCharmap(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[512];
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading\n", path);
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        struct CharmapEntry entry;
+        char *s = SkipSpace(line);
+        char *end;
+
+        memset(&entry, 0, sizeof(entry));
+        if (*s == '\'')
+        {
+            s++;
+            if (s[0] == '\\' && s[1] == '\'')
+            {
+                entry.key = CopyString("'", 1);
+                s += 2;
+            }
+            else
+            {
+                end = strchr(s, '\'');
+                if (end == NULL)
+                    continue;
+                entry.key = CopyString(s, end - s);
+                s = end;
+            }
+            s++;
+        }
+        else if (isupper((unsigned char)*s) || *s == '_')
+        {
+            end = s;
+            while (isalnum((unsigned char)*end) || *end == '_')
+                end++;
+            entry.key = CopyString(s, end - s);
+            entry.isConstant = true;
+            s = end;
+        }
+        else
+        {
+            continue;
+        }
+
+        s = SkipSpace(s);
+        if (*s++ != '=')
+        {
+            free(entry.key);
+            continue;
+        }
+        for (;;)
+        {
+            unsigned long value;
+
+            s = SkipSpace(s);
+            if (!isxdigit((unsigned char)*s))
+                break;
+            value = strtoul(s, &end, 16);
+            if (entry.length == (int)sizeof(entry.bytes))
+                FATAL_ERROR("Charmap entry \"%s\" is too long\n", entry.key);
+            entry.bytes[entry.length++] = value;
+            s = end;
+        }
+        if (entry.length == 0)
+        {
+            free(entry.key);
+            continue;
+        }
+
+        sCharmap = Realloc(sCharmap, (sCharmapCount + 1) * sizeof(*sCharmap));
+        sCharmap[sCharmapCount++] = entry;
+    }
+    fclose(fp);
+}
+
+static const struct CharmapEntry *FindCharmapEntry(const char *key, size_t length, bool isConstant)
+{
+    int i;
+
+    for (i = 0; i < sCharmapCount; i++)
+    {
+        if (sCharmap[i].isConstant == isConstant
+         && strlen(sCharmap[i].key) == length
+         && memcmp(sCharmap[i].key, key, length) == 0)
+            return &sCharmap[i];
+    }
+    return NULL;
+}
+
+static int GetUtf8Length(unsigned char lead)
+{
+    if (lead < 0x80)
+        return 1;
+    if ((lead & 0xE0) == 0xC0)
+        return 2;
+    if ((lead & 0xF0) == 0xE0)
+        return 3;
+    return 4;
+}
+
+static void EncodeName(struct ItemName *item, const char *s, const char *end)
+{
+    while (s < end)
+    {
+        const struct CharmapEntry *entry;
+        size_t length;
+
+        if (*s == '{')
+        {
+            const char *close = memchr(s, '}', end - s);
+
+            if (close == NULL)
+                FATAL_ERROR("Unterminated {} in the name of %s\n", item->constant);
+            entry = FindCharmapEntry(s + 1, close - s - 1, true);
+            length = close - s + 1;
+        }
+        else
+        {
+            length = GetUtf8Length(*s);
+            entry = FindCharmapEntry(s, length, false);
+        }
+        if (entry == NULL)
+            FATAL_ERROR("Unknown character \"%.*s\" in the name of %s\n", (int)length, s, item->constant);
+        if (item->length + entry->length > MAX_ENCODED_LENGTH)
+            FATAL_ERROR("The name of %s is too long\n", item->constant);
+        memcpy(item->encoded + item->length, entry->bytes, entry->length);
+        item->length += entry->length;
+        s += length;
+    }
+}
+
+static struct ItemName *FindItem(const char *constant)
+{
+    int i;
+
+    for (i = 0; i < sItemCount; i++)
+    {
+        if (strcmp(sItems[i].constant, constant) == 0)
+            return &sItems[i];
+    }
+    return NULL;
+}
+
+// Only gItems is read. items.h also defines gItems2, whose names differ for
+// some items, but the bag shows the names from gItems.
+static void ReadItems(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[512];
+    char *constant = NULL;
+    bool inTable = false;
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading\n", path);
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        char *s = SkipSpace(line);
+        char *end;
+
+        if (!inTable)
+        {
+            if (strncmp(s, "const struct Item gItems[] =", 28) == 0)
+                inTable = true;
+            continue;
+        }
+        if (strncmp(s, "};", 2) == 0)
+            break;
+
+        if (strncmp(s, "[ITEM_", 6) == 0 && (end = strchr(s, ']')) != NULL)
+        {
+            free(constant);
+            constant = CopyString(s + 1, end - s - 1);
+        }
+        else if (strncmp(s, ".name = _(\"", 11) == 0 && constant != NULL)
+        {
+            struct ItemName *item;
+
+            s += 11;
+            end = strstr(s, "\")");
+            if (end == NULL)
+                FATAL_ERROR("Unterminated name for %s\n", constant);
+
+            if (FindItem(constant) != NULL)
+                FATAL_ERROR("%s is named more than once in gItems\n", constant);
+            sItems = Realloc(sItems, (sItemCount + 1) * sizeof(*sItems));
+            item = &sItems[sItemCount++];
+            memset(item, 0, sizeof(*item));
+            item->constant = constant;
+            constant = NULL;
+            EncodeName(item, s, end);
+        }
+    }
+    free(constant);
+    fclose(fp);
+
+    if (!inTable)
+        FATAL_ERROR("No gItems table in \"%s\"\n", path);
+}
+
+// Same order as the game's own string comparison: byte by byte, with a
+// name that ends first sorting before any longer one.
+static int CompareNames(const void *a, const void *b)
+{
+    const struct ItemName *item1 = *(const struct ItemName *const *)a;
+    const struct ItemName *item2 = *(const struct ItemName *const *)b;
+    int length = item1->length < item2->length ? item1->length : item2->length;
+    int result = memcmp(item1->encoded, item2->encoded, length);
+
+    if (result != 0)
+        return result;
+    return item1->length - item2->length;
+}
+
+static void RankItems(void)
+{
+    struct ItemName **sorted = Realloc(NULL, sItemCount * sizeof(*sorted));
+    int i;
+
+    for (i = 0; i < sItemCount; i++)
+        sorted[i] = &sItems[i];
+    qsort(sorted, sItemCount, sizeof(*sorted), CompareNames);
+    for (i = 0; i < sItemCount; i++)
+    {
+        if (i > 0 && CompareNames(&sorted[i - 1], &sorted[i]) == 0)
+            sorted[i]->rank = sorted[i - 1]->rank;
+        else
+            sorted[i]->rank = i;
+    }
+    free(sorted);
+}
+
+static void WriteRanks(const char *path)
+{
+    FILE *fp = fopen(path, "w");
+    int i;
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing\n", path);
+
+    fprintf(fp, "// Generated by tools/itemrank from src/data/items.h. Do not edit.\n\n");
+    fprintf(fp, "// Position of each item's name in alphabetical order. Items with the\n");
+    fprintf(fp, "// same name share a rank.\n");
+    fprintf(fp, "static const u16 sItemNameRanks[ITEMS_COUNT] =\n{\n");
+    for (i = 0; i < sItemCount; i++)
+        fprintf(fp, "    [%s] = %d,\n", sItems[i].constant, sItems[i].rank);
+    fprintf(fp, "};\n");
+    fclose(fp);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 4)
+        FATAL_ERROR("Usage: itemrank ITEMS_H CHARMAP_TXT OUTPUT_H\n");
+
+    ReadCharmap(argv[2]);
+    ReadItems(argv[1]);
+    if (sItemCount == 0)
+        FATAL_ERROR("No item names found in \"%s\"\n", argv[1]);
+    RankItems();
+    WriteRanks(argv[3]);
+    return 0;
+}
@@ -24,6 +24,12 @@ using std::ostringstream;
 #include <limits>
 using std::numeric_limits;
 
+#include <thread>
+using std::thread;
+
+#include <atomic>
+using std::atomic;
+
 #include "json11.h"
 using json11::Json;
 
@@ -60,6 +66,29 @@ void write_text_file(string filepath, string text) {
     out_file.close();
 }
 
+// Only rewrites the file if its contents differ, so that make sees stable timestamps
+// for outputs that did not change.
+bool write_text_file_if_changed(string filepath, string text) {
+    ifstream in_file(filepath, std::ifstream::binary);
+
+    if (in_file.is_open()) {
+        in_file.seekg(0, std::ios::end);
+        std::streamoff size = in_file.tellg();
+        if (size == (std::streamoff)text.size()) {
+            string existing;
+            existing.resize(size);
+            in_file.seekg(0, std::ios::beg);
+            in_file.read(&existing[0], existing.size());
+            if (existing == text)
+                return false;
+        }
+        in_file.close();
+    }
+
+    write_text_file(filepath, text);
+    return true;
+}
+
 
 string json_to_string(const Json &data, const string &field = "", bool silent = false) {
     const Json value = !field.empty() ? data[field] : data;
@@ -91,20 +120,34 @@ string json_to_string(const Json &data, const string &field = "", bool silent =
     return output;
 }
 
-string generate_map_header_text(Json map_data, Json layouts_data, string version) {
-    string map_layout_id = json_to_string(map_data, "layout");
+map<string, Json> build_layouts_index(Json layouts_data) {
+    map<string, Json> layouts_index;
+    map<string, int> id_counts;
 
-    vector<Json> matched;
+    for (auto &layout : layouts_data["layouts"].array_items()) {
+        string id = json_to_string(layout, "id");
+        layouts_index[id] = layout;
+        id_counts[id]++;
+    }
 
-    for (auto &field : layouts_data["layouts"].array_items()) {
-        if (map_layout_id == json_to_string(field, "id"))
-            matched.push_back(field);
+    // Duplicate ids can never be matched, same as the linear search this replaces.
+    for (auto &count : id_counts) {
+        if (count.second != 1)
+            layouts_index.erase(count.first);
     }
 
-    if (matched.size() != 1)
+    return layouts_index;
+}
+
+string generate_map_header_text(Json map_data, const map<string, Json> &layouts_index, string version) {
+    string map_layout_id = json_to_string(map_data, "layout");
+
+    auto matched = layouts_index.find(map_layout_id);
+
+    if (matched == layouts_index.end())
         FATAL_ERROR("Failed to find matching layout for %s.\n", map_layout_id.c_str());
 
-    Json layout = matched[0];
+    const Json &layout = matched->second;
 
     ostringstream text;
 
@@ -316,7 +359,7 @@ void process_map(string map_filepath, string layouts_filepath, string version) {
     if (layouts_data == Json())
         FATAL_ERROR("%s\n", layouts_err.c_str());
 
-    string header_text = generate_map_header_text(map_data, layouts_data, version);
+    string header_text = generate_map_header_text(map_data, build_layouts_index(layouts_data), version);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
 
@@ -326,6 +369,69 @@ void process_map(string map_filepath, string layouts_filepath, string version) {
     write_text_file(files_dir + "connections.inc", connections_text);
 }
 
+// Generates the header, events, and connections files for every map in map_groups.json.
+// layouts.json is only parsed once, and the maps are split between worker threads.
+void process_all_maps(string groups_filepath, string layouts_filepath, string version, unsigned int num_jobs) {
+    string groups_err, layouts_err;
+
+    Json groups_data = Json::parse(read_text_file(groups_filepath), groups_err);
+    if (groups_data == Json())
+        FATAL_ERROR("%s\n", groups_err.c_str());
+
+    Json layouts_data = Json::parse(read_text_file(layouts_filepath), layouts_err);
+    if (layouts_data == Json())
+        FATAL_ERROR("%s\n", layouts_err.c_str());
+
+    const map<string, Json> layouts_index = build_layouts_index(layouts_data);
+
+    string file_dir = get_directory_name(groups_filepath);
+    char dir_separator = file_dir.back();
+
+    vector<string> map_filepaths;
+    for (auto &group : groups_data["group_order"].array_items())
+    for (auto &map_name : groups_data[json_to_string(group)].array_items())
+        map_filepaths.push_back(file_dir + json_to_string(map_name) + dir_separator + "map.json");
+
+    if (num_jobs == 0)
+        num_jobs = thread::hardware_concurrency();
+    if (num_jobs == 0)
+        num_jobs = 1;
+    if (num_jobs > map_filepaths.size())
+        num_jobs = map_filepaths.size() > 0 ? map_filepaths.size() : 1;
+
+    atomic<size_t> next_map(0);
+    atomic<int> num_written(0);
+
+    auto worker = [&]() {
+        for (size_t i = next_map++; i < map_filepaths.size(); i = next_map++) {
+            const string &map_filepath = map_filepaths[i];
+            string err;
+
+            Json map_data = Json::parse(read_text_file(map_filepath), err);
+            if (map_data == Json())
+                FATAL_ERROR("%s: %s\n", map_filepath.c_str(), err.c_str());
+
+            string header_text = generate_map_header_text(map_data, layouts_index, version);
+            string events_text = generate_map_events_text(map_data);
+            string connections_text = generate_map_connections_text(map_data);
+
+            string files_dir = get_directory_name(map_filepath);
+            num_written += write_text_file_if_changed(files_dir + "header.inc", header_text);
+            num_written += write_text_file_if_changed(files_dir + "events.inc", events_text);
+            num_written += write_text_file_if_changed(files_dir + "connections.inc", connections_text);
+        }
+    };
+
+    vector<thread> workers;
+    for (unsigned int i = 1; i < num_jobs; i++)
+        workers.push_back(thread(worker));
+    worker();
+    for (thread &t : workers)
+        t.join();
+
+    cout << "mapjson: processed " << map_filepaths.size() << " maps, updated " << num_written << " files" << endl;
+}
+
 string generate_groups_text(Json groups_data) {
     ostringstream text;
 
@@ -424,6 +530,7 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
     text << "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from data/maps/map_groups.json\n//\n\n";
 
     int group_num = 0;
+    int max_map_count = 0;
     vector<int> map_count_vec; //DEBUG
 
     for (auto &group : groups_data["group_order"].array_items()) {
@@ -455,10 +562,13 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
         text << "\n";
 
         group_num++;
+        if (map_count > max_map_count)
+            max_map_count = map_count;
         map_count_vec.push_back(map_count); //DEBUG
     }
 
-    text << "#define MAP_GROUPS_COUNT " << group_num << "\n\n";
+    text << "#define MAP_GROUPS_COUNT " << group_num << "\n";
+    text << "#define MAP_GROUP_MAX_MAPS " << max_map_count << "\n\n";
 
     text << "// static const u8 MAP_GROUP_COUNT[] = {"; //DEBUG
     for(int i=0; i<group_num; i++){                     //DEBUG
@@ -581,8 +691,8 @@ int main(int argc, char *argv[]) {
 
     char *mode_arg = argv[1];
     string mode(mode_arg);
-    if (mode != "layouts" && mode != "map" && mode != "groups")
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', or 'groups'.\n");
+    if (mode != "layouts" && mode != "map" && mode != "maps-all" && mode != "groups")
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'maps-all', or 'groups'.\n");
 
     if (mode == "map") {
         if (argc != 5)
@@ -593,6 +703,16 @@ int main(int argc, char *argv[]) {
 
         process_map(filepath, layouts_filepath, version);
     }
+    else if (mode == "maps-all") {
+        if (argc != 5 && argc != 6)
+            FATAL_ERROR("USAGE: mapjson maps-all <game-version> <groups_file> <layouts_file> [num_jobs]\n");
+
+        string groups_filepath(argv[3]);
+        string layouts_filepath(argv[4]);
+        unsigned int num_jobs = argc == 6 ? std::stoul(argv[5]) : 0;
+
+        process_all_maps(groups_filepath, layouts_filepath, version, num_jobs);
+    }
     else if (mode == "groups") {
         if (argc != 4)
             FATAL_ERROR("USAGE: mapjson groups <game-version> <groups_file>\n");
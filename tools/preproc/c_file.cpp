@@ -23,6 +23,7 @@
 #include <stdexcept>
 #include <string>
 #include <memory>
+#include <vector>
 #include <cstring>
 #include <cerrno>
 #include "preproc.h"
@@ -31,7 +32,7 @@
 #include "utf8.h"
 #include "string_parser.h"
 
-CFile::CFile(const char * filenameCStr, bool isStdin)
+CFile::CFile(const char * filenameCStr, bool isStdin, bool incbinAsm)
 {
     FILE *fp;
 
@@ -84,6 +85,8 @@ CFile::CFile(const char * filenameCStr, bool isStdin)
     m_pos = 0;
     m_lineNum = 1;
     m_isStdin = isStdin;
+    m_incbinAsm = incbinAsm;
+    m_braceDepth = 0;
 }
 
 CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
@@ -93,6 +96,9 @@ CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
     m_size = other.m_size;
     m_lineNum = other.m_lineNum;
     m_isStdin = other.m_isStdin;
+    m_incbinAsm = other.m_incbinAsm;
+    m_braceDepth = other.m_braceDepth;
+    m_output = std::move(other.m_output);
 
     other.m_buffer = NULL;
 }
@@ -112,21 +118,21 @@ void CFile::Preproc()
         {
             if (m_buffer[m_pos] == stringChar)
             {
-                std::putchar(stringChar);
+                Emit(stringChar);
                 m_pos++;
                 stringChar = 0;
             }
             else if (m_buffer[m_pos] == '\\' && m_buffer[m_pos + 1] == stringChar)
             {
-                std::putchar('\\');
-                std::putchar(stringChar);
+                Emit('\\');
+                Emit(stringChar);
                 m_pos += 2;
             }
             else
             {
                 if (m_buffer[m_pos] == '\n')
                     m_lineNum++;
-                std::putchar(m_buffer[m_pos]);
+                Emit(m_buffer[m_pos]);
                 m_pos++;
             }
         }
@@ -140,7 +146,7 @@ void CFile::Preproc()
 
             char c = m_buffer[m_pos++];
 
-            std::putchar(c);
+            Emit(c);
 
             if (c == '\n')
                 m_lineNum++;
@@ -148,8 +154,48 @@ void CFile::Preproc()
                 stringChar = '"';
             else if (c == '\'')
                 stringChar = '\'';
+            else if (c == '{')
+                m_braceDepth++;
+            else if (c == '}')
+                m_braceDepth--;
         }
     }
+
+    FlushOutput();
+}
+
+void CFile::FlushOutput()
+{
+    if (m_output.size() != 0 && std::fwrite(m_output.data(), m_output.size(), 1, stdout) != 1)
+        FATAL_ERROR("Failed to write output for \"%s\".\n", m_filename.c_str());
+
+    m_output.clear();
+}
+
+// Appends a decimal integer. Unsigned values get a 'u' suffix, matching
+// what printf("%uu") used to produce for the INCBIN expansions.
+void CFile::EmitInteger(int value, bool isSigned)
+{
+    char buffer[16];
+    char *end = buffer + sizeof(buffer);
+    char *p = end;
+    unsigned int magnitude = value;
+
+    if (isSigned && value < 0)
+        magnitude = 0u - magnitude;
+    else if (!isSigned)
+        *--p = 'u';
+
+    do
+    {
+        *--p = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    if (isSigned && value < 0)
+        *--p = '-';
+
+    m_output.append(p, end - p);
 }
 
 bool CFile::ConsumeHorizontalWhitespace()
@@ -169,7 +215,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos += 2;
         m_lineNum++;
-        std::putchar('\n');
+        Emit('\n');
         return true;
     }
 
@@ -177,7 +223,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos++;
         m_lineNum++;
-        std::putchar('\n');
+        Emit('\n');
         return true;
     }
 
@@ -220,7 +266,7 @@ void CFile::TryConvertString()
 
     SkipWhitespace();
 
-    std::printf("{ ");
+    Emit("{ ");
 
     while (1)
     {
@@ -242,7 +288,11 @@ void CFile::TryConvertString()
             }
 
             for (int i = 0; i < length; i++)
-                printf("0x%02X, ", s[i]);
+            {
+                static const char hexDigits[] = "0123456789ABCDEF";
+                char hex[] = { '0', 'x', hexDigits[s[i] >> 4], hexDigits[s[i] & 0xF], ',', ' ', 0 };
+                Emit(hex);
+            }
         }
         else if (m_buffer[m_pos] == ')')
         {
@@ -261,9 +311,9 @@ void CFile::TryConvertString()
     }
 
     if (noTerminator)
-        std::printf(" }");
+        Emit(" }");
     else
-        std::printf("0xFF }");
+        Emit("0xFF }");
 }
 
 bool CFile::CheckIdentifier(const std::string& ident)
@@ -357,7 +407,12 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("{");
+    IncbinDeclaration decl;
+    bool asIncbinAsm = m_incbinAsm && ParseIncbinDeclaration(size, decl);
+    std::vector<std::string> paths;
+    int totalCount = 0;
+
+    Emit('{');
 
     while (true)
     {
@@ -404,17 +459,25 @@ void CFile::TryConvertIncbin()
             RaiseError("Size %d doesn't evenly divide file size %d.\n", size, fileSize);
 
         int count = fileSize / size;
-        int offset = 0;
 
-        for (int i = 0; i < count; i++)
+        if (asIncbinAsm)
         {
-            int data = ExtractData(buffer, offset, size);
-            offset += size;
+            // The assembler pulls the bytes in itself; only the size is needed here.
+            paths.push_back(path);
+            totalCount += count;
+        }
+        else
+        {
+            int offset = 0;
 
-            if (isSigned)
-                std::printf("%d,", data);
-            else
-                std::printf("%uu,", data);
+            for (int i = 0; i < count; i++)
+            {
+                int data = ExtractData(buffer, offset, size);
+                offset += size;
+
+                EmitInteger(data, isSigned);
+                Emit(',');
+            }
         }
 
         SkipWhitespace();
@@ -430,7 +493,189 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("}");
+    if (asIncbinAsm)
+        EmitIncbinAsm(decl, paths, totalCount);
+    else
+        Emit('}');
+}
+
+static bool IsIncbinElementType(const std::string& type, int size)
+{
+    switch (size)
+    {
+    case 1:
+        return type == "u8" || type == "s8";
+    case 2:
+        return type == "u16" || type == "s16";
+    case 4:
+        return type == "u32" || type == "s32";
+    }
+
+    return false;
+}
+
+// Checks whether the INCBIN about to be expanded initializes a plain top level
+// array, i.e. the output since the last ';', '{' or '}' is exactly
+// "[static] const TYPE NAME[] =" (ignoring line markers) and TYPE matches the
+// INCBIN element size. Anything else falls back to the text expansion.
+bool CFile::ParseIncbinDeclaration(int size, IncbinDeclaration& decl)
+{
+    if (m_braceDepth != 0)
+        return false;
+
+    std::size_t start = m_output.size();
+
+    while (start > 0)
+    {
+        char c = m_output[start - 1];
+
+        if (c == ';' || c == '{' || c == '}')
+            break;
+
+        start--;
+    }
+
+    std::vector<std::string> tokens;
+    std::size_t i = start;
+    bool lineStart = true;
+
+    while (i < m_output.size())
+    {
+        char c = m_output[i];
+
+        if (c == '\n')
+        {
+            lineStart = true;
+            i++;
+        }
+        else if (c == ' ' || c == '\t' || c == '\r')
+        {
+            i++;
+        }
+        else if (c == '#' && lineStart)
+        {
+            while (i < m_output.size() && m_output[i] != '\n')
+                i++;
+        }
+        else if (IsIdentifierStartingChar(c))
+        {
+            std::size_t identStart = i;
+
+            while (i < m_output.size() && IsIdentifierChar(m_output[i]))
+                i++;
+
+            tokens.push_back(m_output.substr(identStart, i - identStart));
+            lineStart = false;
+        }
+        else
+        {
+            tokens.push_back(std::string(1, c));
+            lineStart = false;
+            i++;
+        }
+    }
+
+    std::size_t t = 0;
+
+    decl.isStatic = (tokens.size() > 0 && tokens[0] == "static");
+
+    if (decl.isStatic)
+        t++;
+
+    if (tokens.size() - t != 6
+     || tokens[t] != "const"
+     || !IsIncbinElementType(tokens[t + 1], size)
+     || !IsIdentifierStartingChar(tokens[t + 2][0])
+     || tokens[t + 3] != "["
+     || tokens[t + 4] != "]"
+     || tokens[t + 5] != "=")
+        return false;
+
+    decl.start = start;
+    decl.type = tokens[t + 1];
+    decl.name = tokens[t + 2];
+
+    // An earlier "static const TYPE NAME[];" is a tentative definition that
+    // cc1 would emit on its own, clashing with the asm label.
+    if (decl.isStatic)
+    {
+        std::size_t pos = 0;
+
+        while ((pos = m_output.find(decl.name, pos)) < start)
+        {
+            std::size_t end = pos + decl.name.length();
+
+            if ((pos == 0 || !IsIdentifierChar(m_output[pos - 1])) && !IsIdentifierChar(m_output[end]))
+                return false;
+
+            pos = end;
+        }
+    }
+
+    return true;
+}
+
+// Replaces the declaration with a top level asm block that defines the symbol
+// with .incbin, plus an extern declaration of the right size, so cc1 never
+// sees the data. The array is placed in .rodata with the word alignment the
+// compiler would have given it.
+void CFile::EmitIncbinAsm(const IncbinDeclaration& decl, const std::vector<std::string>& paths, int count)
+{
+    // Keep the newlines and line markers of the declaration, so whatever
+    // follows stays on the same line of the same file, and put the
+    // replacement on the last line, where the INCBIN was.
+    std::string lines;
+    std::size_t i = decl.start;
+
+    while (i < m_output.size())
+    {
+        std::size_t lineEnd = m_output.find('\n', i);
+        bool lineStart = (i == 0 || m_output[i - 1] == '\n');
+        std::size_t first = m_output.find_first_not_of(" \t\r", i);
+
+        if (lineEnd == std::string::npos)
+            lineEnd = m_output.size();
+        if (lineStart && first < lineEnd && m_output[first] == '#')
+            lines.append(m_output, i, lineEnd - i);
+        if (lineEnd < m_output.size())
+            lines.push_back('\n');
+        i = lineEnd + 1;
+    }
+
+    m_output.resize(decl.start);
+    m_output.append(lines);
+
+    const char* name = decl.name.c_str();
+
+    Emit(" asm(\".pushsection .rodata\\n\\t.align 2\\n");
+    if (!decl.isStatic)
+    {
+        Emit("\\t.global ");
+        Emit(name);
+        Emit("\\n");
+    }
+    Emit("\\t.type ");
+    Emit(name);
+    Emit(", %object\\n");
+    Emit(name);
+    Emit(":\\n");
+    for (const std::string& path : paths)
+    {
+        Emit("\\t.incbin \\\"");
+        Emit(path.c_str());
+        Emit("\\\"\\n");
+    }
+    Emit("\\t.size ");
+    Emit(name);
+    Emit(", .-");
+    Emit(name);
+    Emit("\\n\\t.popsection\"); extern const ");
+    Emit(decl.type.c_str());
+    Emit(' ');
+    Emit(name);
+    Emit('[');
+    EmitInteger(count, true);
+    Emit(']');
 }
 
 // Reports a diagnostic message.
@@ -24,13 +24,23 @@
 #include <cstdarg>
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <memory>
 #include "preproc.h"
 
+// A top level "[static] const TYPE NAME[] =" that an INCBIN initializes.
+struct IncbinDeclaration
+{
+    std::size_t start;
+    bool isStatic;
+    std::string type;
+    std::string name;
+};
+
 class CFile
 {
 public:
-    CFile(const char * filenameCStr, bool isStdin);
+    CFile(const char * filenameCStr, bool isStdin, bool incbinAsm);
     CFile(CFile&& other);
     CFile(const CFile&) = delete;
     ~CFile();
@@ -43,7 +53,14 @@ private:
     long m_lineNum;
     std::string m_filename;
     bool m_isStdin;
+    bool m_incbinAsm;
+    int m_braceDepth;
+    std::string m_output;
 
+    void Emit(char c) { m_output.push_back(c); }
+    void Emit(const char* s) { m_output.append(s); }
+    void EmitInteger(int value, bool isSigned);
+    void FlushOutput();
     bool ConsumeHorizontalWhitespace();
     bool ConsumeNewline();
     void SkipWhitespace();
@@ -51,6 +68,8 @@ private:
     std::unique_ptr<unsigned char[]> ReadWholeFile(const std::string& path, int& size);
     bool CheckIdentifier(const std::string& ident);
     void TryConvertIncbin();
+    bool ParseIncbinDeclaration(int size, IncbinDeclaration& decl);
+    void EmitIncbinAsm(const IncbinDeclaration& decl, const std::vector<std::string>& paths, int count);
     void ReportDiagnostic(const char* type, const char* format, std::va_list args);
     void RaiseError(const char* format, ...);
     void RaiseWarning(const char* format, ...);
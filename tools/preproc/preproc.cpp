@@ -106,9 +106,9 @@ void PreprocAsmFile(std::string filename)
     }
 }
 
-void PreprocCFile(const char * filename, bool isStdin)
+void PreprocCFile(const char * filename, bool isStdin, bool incbinAsm)
 {
-    CFile cFile(filename, isStdin);
+    CFile cFile(filename, isStdin, incbinAsm);
     cFile.Preproc();
 }
 
@@ -135,9 +135,11 @@ char* GetFileExtension(char* filename)
 
 int main(int argc, char **argv)
 {
-    if (argc < 3 || argc > 4)
+    if (argc < 3 || argc > 5)
     {
-        std::fprintf(stderr, "Usage: %s SRC_FILE CHARMAP_FILE [-i]\nwhere -i denotes if input is from stdin\n", argv[0]);
+        std::fprintf(stderr, "Usage: %s SRC_FILE CHARMAP_FILE [-i] [-b]\n"
+                             "where -i denotes if input is from stdin\n"
+                             "and -b emits INCBIN arrays as assembler .incbin directives\n", argv[0]);
         return 1;
     }
 
@@ -151,15 +153,20 @@ int main(int argc, char **argv)
     if ((extension[0] == 's') && extension[1] == 0)
         PreprocAsmFile(argv[1]);
     else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0) {
-        if (argc == 4) {
-            if (argv[3][0] == '-' && argv[3][1] == 'i' && argv[3][2] == '\0') {
-                PreprocCFile(argv[1], true);
+        bool isStdin = false;
+        bool incbinAsm = false;
+
+        for (int i = 3; i < argc; i++) {
+            if (argv[i][0] == '-' && argv[i][1] == 'i' && argv[i][2] == '\0') {
+                isStdin = true;
+            } else if (argv[i][0] == '-' && argv[i][1] == 'b' && argv[i][2] == '\0') {
+                incbinAsm = true;
             } else {
-                FATAL_ERROR("unknown argument flag \"%s\".\n", argv[3]);
+                FATAL_ERROR("unknown argument flag \"%s\".\n", argv[i]);
             }
-        } else {
-            PreprocCFile(argv[1], false);
         }
+
+        PreprocCFile(argv[1], isStdin, incbinAsm);
     } else
         FATAL_ERROR("\"%s\" has an unknown file extension of \"%s\".\n", argv[1], extension);
 
@@ -0,0 +1,10 @@
+# 1 "incbin_line_marker.c"
+int gBefore;
+# 40 "incbin_line_marker.c"
+const u16 gMarkerBefore[] = INCBIN_U16("test/incbin.bin");
+int gAfterFirst;
+static const u16
+# 60 "incbin_line_marker.c"
+    gMarkerInside[] =
+    INCBIN_U16("test/incbin.bin");
+int gAfterSecond;
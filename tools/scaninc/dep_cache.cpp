@@ -0,0 +1,171 @@
+#include <cinttypes>
+#include <cstring>
+#include <ctime>
+#include <sys/stat.h>
+#include "dep_cache.h"
+#include "source_file.h"
+
+// Bumped whenever the cache file format changes.
+#define DEP_CACHE_VERSION 1
+
+static std::uint64_t HashFile(std::string path)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path.c_str());
+
+    // 64-bit FNV-1a
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    unsigned char buffer[0x4000];
+    std::size_t count;
+
+    while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            hash ^= buffer[i];
+            hash *= 0x100000001B3ULL;
+        }
+    }
+
+    std::fclose(fp);
+    return hash;
+}
+
+void DepCache::Load(std::string path)
+{
+    m_scanStartTime = std::time(NULL);
+
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        return;
+
+    char line[SCANINC_MAX_PATH + 64];
+    int version = 0;
+    std::int64_t lastScanTime = 0;
+    ScannedFile *current = NULL;
+
+    if (std::fgets(line, sizeof(line), fp) == NULL
+     || std::sscanf(line, "scaninc-cache %d %" SCNd64, &version, &lastScanTime) != 2
+     || version != DEP_CACHE_VERSION)
+    {
+        std::fclose(fp);
+        return;
+    }
+
+    m_lastScanTime = lastScanTime;
+
+    // Each file is an "F" line followed by its "B" (incbin) and "I" (include) lines.
+    while (std::fgets(line, sizeof(line), fp) != NULL)
+    {
+        std::size_t length = std::strlen(line);
+        if (length > 0 && line[length - 1] == '\n')
+            line[--length] = 0;
+
+        if (line[0] == 'F')
+        {
+            std::int64_t mtime, size;
+            std::uint64_t hash;
+            int pathStart;
+
+            if (std::sscanf(line, "F %" SCNd64 " %" SCNd64 " %" SCNx64 " %n", &mtime, &size, &hash, &pathStart) != 3)
+                break;
+
+            current = &m_files[std::string(line + pathStart)];
+            current->mtime = mtime;
+            current->size = size;
+            current->hash = hash;
+        }
+        else if (current != NULL && line[0] == 'B' && line[1] == ' ')
+        {
+            current->incbins.insert(std::string(line + 2));
+        }
+        else if (current != NULL && line[0] == 'I' && line[1] == ' ')
+        {
+            current->includes.insert(std::string(line + 2));
+        }
+        else
+        {
+            // Corrupt cache; start from scratch.
+            m_files.clear();
+            m_lastScanTime = 0;
+            break;
+        }
+    }
+
+    std::fclose(fp);
+}
+
+void DepCache::Save(std::string path)
+{
+    if (m_numUpdated == 0)
+        return;
+
+    FILE *fp = std::fopen(path.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path.c_str());
+
+    std::fprintf(fp, "scaninc-cache %d %" PRId64 "\n", DEP_CACHE_VERSION, m_scanStartTime);
+
+    for (const auto &entry : m_files)
+    {
+        const ScannedFile &file = entry.second;
+
+        std::fprintf(fp, "F %" PRId64 " %" PRId64 " %" PRIx64 " %s\n", file.mtime, file.size, file.hash, entry.first.c_str());
+        for (const std::string &incbin : file.incbins)
+            std::fprintf(fp, "B %s\n", incbin.c_str());
+        for (const std::string &include : file.includes)
+            std::fprintf(fp, "I %s\n", include.c_str());
+    }
+
+    std::fclose(fp);
+}
+
+const ScannedFile& DepCache::Get(std::string path)
+{
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path.c_str());
+
+    std::int64_t mtime = st.st_mtime;
+    std::int64_t size = st.st_size;
+
+    auto it = m_files.find(path);
+
+    if (it != m_files.end())
+    {
+        ScannedFile &cached = it->second;
+
+        // A file modified in the same second as the last scan can't be trusted by mtime alone.
+        if (cached.mtime == mtime && cached.size == size && mtime < m_lastScanTime)
+            return cached;
+
+        std::uint64_t hash = HashFile(path);
+
+        if (cached.size == size && cached.hash == hash)
+        {
+            if (cached.mtime != mtime)
+            {
+                cached.mtime = mtime;
+                m_numUpdated++;
+            }
+            return cached;
+        }
+    }
+
+    SourceFile source(path);
+    ScannedFile &scanned = m_files[path];
+
+    scanned.mtime = mtime;
+    scanned.size = size;
+    scanned.hash = HashFile(path);
+    scanned.incbins = source.GetIncbins();
+    scanned.includes = source.GetIncludes();
+    m_numUpdated++;
+
+    return scanned;
+}
@@ -0,0 +1,38 @@
+#ifndef DEP_CACHE_H
+#define DEP_CACHE_H
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include "scaninc.h"
+
+// The includes and incbins found in a single file, independent of include paths.
+struct ScannedFile
+{
+    std::int64_t mtime;
+    std::int64_t size;
+    std::uint64_t hash;
+    std::set<std::string> incbins;
+    std::set<std::string> includes;
+};
+
+// Remembers the scan results of every file between runs. A file is only rescanned
+// if its mtime or size changed and its content hash no longer matches.
+class DepCache
+{
+public:
+    DepCache() : m_lastScanTime(0), m_scanStartTime(0), m_numUpdated(0) {}
+    void Load(std::string path);
+    void Save(std::string path);
+    const ScannedFile& Get(std::string path);
+    int NumUpdated() { return m_numUpdated; }
+
+private:
+    std::map<std::string, ScannedFile> m_files;
+    std::int64_t m_lastScanTime;
+    std::int64_t m_scanStartTime;
+    int m_numUpdated;
+};
+
+#endif // DEP_CACHE_H
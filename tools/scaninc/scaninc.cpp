@@ -21,10 +21,14 @@
 #include <cstdio>
 #include <cstdlib>
 #include <list>
+#include <map>
 #include <queue>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 #include "scaninc.h"
+#include "dep_cache.h"
 #include "source_file.h"
 
 bool CanOpenFile(std::string path)
@@ -38,19 +42,152 @@ bool CanOpenFile(std::string path)
     return true;
 }
 
-const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] FILE_PATH\n";
+const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] FILE_PATH\n"
+                          "       scaninc -M DEPFILE [-I INCLUDE_PATH] FILE_PATH...\n";
 
-int main(int argc, char **argv)
+// Finds the includes and incbins of every file reachable from a set of sources.
+// Each file is only scanned and resolved once, no matter how many sources include it.
+class DepScanner
+{
+public:
+    DepScanner(DepCache& cache, std::vector<std::string>& includeDirs)
+        : m_cache(cache), m_includeDirs(includeDirs) {}
+    std::set<std::string> GetDependencies(std::string initialPath);
+
+private:
+    // A resolved include or incbin. Only includes that exist are scanned further.
+    struct Edge
+    {
+        std::string path;
+        bool scan;
+    };
+
+    DepCache& m_cache;
+    std::vector<std::string>& m_includeDirs;
+    std::map<std::string, std::vector<Edge>> m_edges;
+    std::map<std::string, bool> m_canOpen;
+
+    bool CanOpenFileCached(const std::string& path);
+    const std::vector<Edge>& GetEdges(const std::string& filePath);
+};
+
+bool DepScanner::CanOpenFileCached(const std::string& path)
+{
+    auto it = m_canOpen.find(path);
+
+    if (it != m_canOpen.end())
+        return it->second;
+
+    bool canOpen = CanOpenFile(path);
+    m_canOpen[path] = canOpen;
+    return canOpen;
+}
+
+const std::vector<DepScanner::Edge>& DepScanner::GetEdges(const std::string& filePath)
+{
+    auto it = m_edges.find(filePath);
+
+    if (it != m_edges.end())
+        return it->second;
+
+    std::string path(filePath);
+    const ScannedFile& file = m_cache.Get(path);
+    SourceFileType fileType = GetFileType(path);
+    std::vector<Edge>& edges = m_edges[filePath];
+
+    for (auto incbin : file.incbins)
+    {
+        edges.push_back(Edge{incbin, false});
+    }
+
+    m_includeDirs.push_back(GetDir(path));
+    for (auto include : file.includes)
+    {
+        bool exists = false;
+        std::string includePath("");
+        for (auto includeDir : m_includeDirs)
+        {
+            includePath = includeDir + include;
+            if (CanOpenFileCached(includePath))
+            {
+                exists = true;
+                break;
+            }
+        }
+        if (!exists && (fileType == SourceFileType::Asm || fileType == SourceFileType::Inc))
+        {
+            includePath = include;
+        }
+        edges.push_back(Edge{includePath, exists});
+    }
+    m_includeDirs.pop_back();
+
+    return edges;
+}
+
+std::set<std::string> DepScanner::GetDependencies(std::string initialPath)
 {
     std::queue<std::string> filesToProcess;
     std::set<std::string> dependencies;
 
+    filesToProcess.push(initialPath);
+
+    while (!filesToProcess.empty())
+    {
+        std::string filePath = filesToProcess.front();
+        filesToProcess.pop();
+
+        for (const Edge& edge : GetEdges(filePath))
+        {
+            bool inserted = dependencies.insert(edge.path).second;
+            if (inserted && edge.scan)
+            {
+                filesToProcess.push(edge.path);
+            }
+        }
+    }
+
+    return dependencies;
+}
+
+void WriteFileIfChanged(std::string path, const std::string& text)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp != NULL)
+    {
+        std::string existing;
+        char buffer[0x4000];
+        std::size_t count;
+
+        while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+            existing.append(buffer, count);
+
+        std::fclose(fp);
+
+        if (existing == text)
+            return;
+    }
+
+    fp = std::fopen(path.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path.c_str());
+
+    std::fwrite(text.data(), 1, text.size(), fp);
+    std::fclose(fp);
+}
+
+int main(int argc, char **argv)
+{
     std::vector<std::string> includeDirs;
+    std::vector<std::string> initialPaths;
+    std::string depFilePath;
 
     argc--;
     argv++;
 
-    while (argc > 1)
+    while (argc > 0)
     {
         std::string arg(argv[0]);
         if (arg.substr(0, 2) == "-I")
@@ -60,6 +197,8 @@ int main(int argc, char **argv)
             {
                 argc--;
                 argv++;
+                if (argc == 0)
+                    FATAL_ERROR(USAGE);
                 includeDir = std::string(argv[0]);
             }
             if (!includeDir.empty() && includeDir.back() != '/')
@@ -68,61 +207,62 @@ int main(int argc, char **argv)
             }
             includeDirs.push_back(includeDir);
         }
+        else if (arg.substr(0, 2) == "-M")
+        {
+            depFilePath = arg.substr(2);
+            if (depFilePath.empty())
+            {
+                argc--;
+                argv++;
+                if (argc == 0)
+                    FATAL_ERROR(USAGE);
+                depFilePath = std::string(argv[0]);
+            }
+        }
         else
         {
-            FATAL_ERROR(USAGE);
+            initialPaths.push_back(arg);
         }
         argc--;
         argv++;
     }
 
-    if (argc != 1) {
-        FATAL_ERROR(USAGE);
-    }
-
-    std::string initialPath(argv[0]);
-
-    filesToProcess.push(initialPath);
-
-    while (!filesToProcess.empty())
+    if (depFilePath.empty())
     {
-        std::string filePath = filesToProcess.front();
-        SourceFile file(filePath);
-        filesToProcess.pop();
+        if (initialPaths.size() != 1)
+            FATAL_ERROR(USAGE);
 
-        includeDirs.push_back(file.GetSrcDir());
-        for (auto incbin : file.GetIncbins())
+        DepCache cache;
+        DepScanner scanner(cache, includeDirs);
+
+        for (const std::string &path : scanner.GetDependencies(initialPaths[0]))
         {
-            dependencies.insert(incbin);
+            std::printf("%s\n", path.c_str());
         }
-        for (auto include : file.GetIncludes())
-        {
-            bool exists = false;
-            std::string path("");
-            for (auto includeDir : includeDirs)
-            {
-                path = includeDir + include;
-                if (CanOpenFile(path))
-                {
-                    exists = true;
-                    break;
-                }
-            }
-            if (!exists && (file.FileType() == SourceFileType::Asm || file.FileType() == SourceFileType::Inc))
-            {
-                path = include;
-            }
-            bool inserted = dependencies.insert(path).second;
-            if (inserted && exists)
-            {
-                filesToProcess.push(path);
-            }
-        }
-        includeDirs.pop_back();
+
+        return 0;
     }
 
-    for (const std::string &path : dependencies)
+    // Batch mode: scan every source in one pass and write the results as make
+    // variables named SCANINC_DEPS_<source>. The per-file scan results are cached
+    // next to the depfile so that unchanged files aren't read again next time.
+    std::string cacheFilePath = depFilePath + ".cache";
+    DepCache cache;
+    cache.Load(cacheFilePath);
+
+    DepScanner scanner(cache, includeDirs);
+    std::string text = "# DO NOT MODIFY THIS FILE! It is auto-generated by scaninc\n";
+
+    for (const std::string &initialPath : initialPaths)
     {
-        std::printf("%s\n", path.c_str());
+        text += "SCANINC_DEPS_" + initialPath + " :=";
+        for (const std::string &path : scanner.GetDependencies(initialPath))
+            text += " " + path;
+        text += "\n";
     }
+
+    cache.Save(cacheFilePath);
+    WriteFileIfChanged(depFilePath, text);
+
+    return 0;
 }